@@ -257,8 +257,11 @@ typedef void (*_daal_threader_for_int32ptr_t)(const int *, const int *, const vo
 typedef void (*_daal_threader_for_simple_t)(int, int, const void *, daal::functype);
 typedef void (*_daal_static_threader_for_t)(size_t, const void *, daal::functype_static);
 typedef void (*_daal_threader_for_blocked_t)(int, int, const void *, daal::functype2);
+typedef void (*_daal_threader_for_grain_t)(int, int, int, const void *, daal::functype);
+typedef void (*_daal_threader_for_blocked_grain_t)(int, int, int, const void *, daal::functype2);
 typedef int (*_daal_threader_get_max_threads_t)(void);
 typedef int (*_daal_threader_get_current_thread_index_t)(void);
+typedef void (*_daal_threader_execute_in_arena_t)(int, int, const void *, daal::functype_arena);
 typedef void (*_daal_threader_for_break_t)(int, int, const void *, daal::functype_break);
 
 typedef int64_t (*_daal_parallel_reduce_int32_int64_t)(int32_t, int64_t, const void *, daal::loop_functype_int32_int64, const void *,
@@ -322,9 +325,12 @@ static _daal_threader_for_int64_t _daal_threader_for_int64_ptr
 static _daal_threader_for_int32ptr_t _daal_threader_for_int32ptr_ptr                         = NULL;
 static _daal_static_threader_for_t _daal_static_threader_for_ptr                             = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr                           = NULL;
+static _daal_threader_for_grain_t _daal_threader_for_grain_ptr                               = NULL;
+static _daal_threader_for_blocked_grain_t _daal_threader_for_blocked_grain_ptr               = NULL;
 static _daal_threader_for_t _daal_threader_for_optional_ptr                                  = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr                   = NULL;
 static _daal_threader_get_current_thread_index_t _daal_threader_get_current_thread_index_ptr = NULL;
+static _daal_threader_execute_in_arena_t _daal_threader_execute_in_arena_ptr                 = NULL;
 static _daal_threader_for_break_t _daal_threader_for_break_ptr                               = NULL;
 
 static _daal_parallel_reduce_int32_int64_t _daal_parallel_reduce_int32_int64_ptr                     = NULL;
@@ -507,6 +513,26 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
     _daal_threader_for_blocked_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_grain(int n, int threads_request, int grain_size, const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_grain_ptr == NULL)
+    {
+        _daal_threader_for_grain_ptr = (_daal_threader_for_grain_t)load_daal_thr_func("_daal_threader_for_grain");
+    }
+    _daal_threader_for_grain_ptr(n, threads_request, grain_size, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_grain(int n, int threads_request, int grain_size, const void * a, daal::functype2 func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_blocked_grain_ptr == NULL)
+    {
+        _daal_threader_for_blocked_grain_ptr = (_daal_threader_for_blocked_grain_t)load_daal_thr_func("_daal_threader_for_blocked_grain");
+    }
+    _daal_threader_for_blocked_grain_ptr(n, threads_request, grain_size, a, func);
+}
+
 DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func)
 {
     load_daal_thr_dll();
@@ -584,6 +610,16 @@ DAAL_EXPORT int _daal_threader_get_current_thread_index()
     return _daal_threader_get_current_thread_index_ptr();
 }
 
+DAAL_EXPORT void _daal_threader_execute_in_arena(int max_concurrency, int numa_node_id, const void * a, daal::functype_arena func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_execute_in_arena_ptr == NULL)
+    {
+        _daal_threader_execute_in_arena_ptr = (_daal_threader_execute_in_arena_t)load_daal_thr_func("_daal_threader_execute_in_arena");
+    }
+    _daal_threader_execute_in_arena_ptr(max_concurrency, numa_node_id, a, func);
+}
+
 DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func)
 {
     load_daal_thr_dll();
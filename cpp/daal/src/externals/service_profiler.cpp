@@ -17,22 +17,358 @@
 
 #include "src/externals/service_profiler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
 namespace daal
 {
 namespace internal
 {
+namespace
+{
+/* Maximal number of trace events stored per thread, the later events are dropped */
+const size_t maxTraceEventCount = size_t(1) << 22;
+
+/* Node of the call tree of one thread, the children are kept as a linked list */
+struct ProfilerNode
+{
+    const char * name;
+    size_t parent;
+    size_t firstChild;
+    size_t nextSibling;
+    uint64_t count;
+    uint64_t totalTime;
+};
+
+struct ProfilerTraceEvent
+{
+    const char * name;
+    uint64_t start;
+    uint64_t end;
+};
+
+struct ProfilerOpenTask
+{
+    size_t node;
+    uint64_t start;
+};
+
+struct ProfilerThreadData
+{
+    size_t threadId;
+    std::vector<ProfilerNode> nodes;
+    std::vector<ProfilerOpenTask> stack;
+    std::vector<ProfilerTraceEvent> events;
+    size_t droppedEventCount;
+    ProfilerThreadData * next;
+};
+
+/* Node of the call tree merged over all threads */
+struct ProfilerMergedNode
+{
+    const char * name;
+    uint64_t count;
+    uint64_t totalTime;
+    std::vector<uint64_t> threadTimes;
+    std::vector<ProfilerMergedNode> children;
+};
+
+bool isSameName(const char * a, const char * b)
+{
+    return a == b || std::strcmp(a, b) == 0;
+}
+
+class ProfilerState
+{
+public:
+    ProfilerState() : _mode(readMode()), _origin(std::chrono::steady_clock::now()), _threads(nullptr), _threadCount(0) {}
+
+    ~ProfilerState()
+    {
+        const ProfilerMode mode = getMode();
+        if (mode == ProfilerMode::report)
+        {
+            FILE * file = openOutput(nullptr);
+            writeReport(file);
+            closeOutput(file);
+        }
+        else if (mode == ProfilerMode::trace)
+        {
+            FILE * file = openOutput("daal_profiler_trace.json");
+            writeTrace(file);
+            closeOutput(file);
+        }
+    }
+
+    ProfilerMode getMode() const { return _mode.load(std::memory_order_relaxed); }
+
+    void setMode(ProfilerMode mode) { _mode.store(mode, std::memory_order_relaxed); }
+
+    uint64_t now() const
+    {
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _origin).count());
+    }
+
+    /* Returns the buffer of the calling thread, the buffer is created on the first call in the thread
+       and is pushed to the lock-free list of all buffers */
+    ProfilerThreadData & getThreadData()
+    {
+        static thread_local ProfilerThreadData * local = nullptr;
+        if (!local)
+        {
+            local                    = new ProfilerThreadData();
+            local->threadId          = _threadCount.fetch_add(1);
+            local->droppedEventCount = 0;
+            local->nodes.push_back(ProfilerNode { "", 0, 0, 0, 0, 0 });
+
+            ProfilerThreadData * head = _threads.load();
+            do
+            {
+                local->next = head;
+            } while (!_threads.compare_exchange_weak(head, local));
+        }
+        return *local;
+    }
+
+private:
+    static ProfilerMode readMode()
+    {
+        const char * value = std::getenv("DAAL_PROFILER");
+        if (!value) return ProfilerMode::disabled;
+        if (std::strcmp(value, "report") == 0 || std::strcmp(value, "1") == 0) return ProfilerMode::report;
+        if (std::strcmp(value, "trace") == 0) return ProfilerMode::trace;
+        return ProfilerMode::disabled;
+    }
+
+    static FILE * openOutput(const char * defaultName)
+    {
+        const char * name = std::getenv("DAAL_PROFILER_OUTPUT");
+        if (!name) name = defaultName;
+        if (!name) return stderr;
+        FILE * file = std::fopen(name, "w");
+        return file ? file : stderr;
+    }
+
+    static void closeOutput(FILE * file)
+    {
+        if (file != stderr) std::fclose(file);
+    }
+
+    void mergeNode(const ProfilerThreadData & data, size_t nodeIndex, ProfilerMergedNode & merged)
+    {
+        const ProfilerNode & node = data.nodes[nodeIndex];
+        merged.count += node.count;
+        merged.totalTime += node.totalTime;
+        merged.threadTimes[data.threadId] += node.totalTime;
+
+        for (size_t child = node.firstChild; child != 0; child = data.nodes[child].nextSibling)
+        {
+            ProfilerMergedNode * mergedChild = nullptr;
+            for (auto & candidate : merged.children)
+            {
+                if (isSameName(candidate.name, data.nodes[child].name))
+                {
+                    mergedChild = &candidate;
+                    break;
+                }
+            }
+            if (!mergedChild)
+            {
+                merged.children.push_back(ProfilerMergedNode { data.nodes[child].name, 0, 0, std::vector<uint64_t>(_threadCount.load(), 0), {} });
+                mergedChild = &merged.children.back();
+            }
+            mergeNode(data, child, *mergedChild);
+        }
+    }
+
+    static void sortByTime(ProfilerMergedNode & node)
+    {
+        std::sort(node.children.begin(), node.children.end(),
+                  [](const ProfilerMergedNode & a, const ProfilerMergedNode & b) { return a.totalTime > b.totalTime; });
+        for (auto & child : node.children)
+        {
+            sortByTime(child);
+        }
+    }
+
+    static void printNode(FILE * file, const ProfilerMergedNode & node, size_t depth)
+    {
+        /* Imbalance is the ratio of the maximal time of a thread to the average time over
+           the threads that executed the task, 1 means perfectly balanced work */
+        size_t threadCount  = 0;
+        uint64_t maxTime    = 0;
+        uint64_t threadsSum = 0;
+        for (const uint64_t time : node.threadTimes)
+        {
+            if (time == 0) continue;
+            ++threadCount;
+            threadsSum += time;
+            maxTime = time > maxTime ? time : maxTime;
+        }
+        const double imbalance = threadCount ? double(maxTime) * threadCount / double(threadsSum) : 1.0;
+
+        const int indent = int(2 * depth);
+        std::fprintf(file, "%*s%-*s %10llu %14.3f %12.3f %8zu %10.2f\n", indent, "", 60 - indent, node.name, (unsigned long long)node.count,
+                     node.totalTime * 1e-6, node.count ? node.totalTime * 1e-6 / node.count : 0.0, threadCount, imbalance);
+
+        for (const auto & child : node.children)
+        {
+            printNode(file, child, depth + 1);
+        }
+    }
+
+public:
+    void writeReport(FILE * file)
+    {
+        ProfilerMergedNode root { "", 0, 0, std::vector<uint64_t>(_threadCount.load(), 0), {} };
+        for (ProfilerThreadData * data = _threads.load(); data; data = data->next)
+        {
+            mergeNode(*data, 0, root);
+        }
+        sortByTime(root);
+
+        std::fprintf(file, "%-60s %10s %14s %12s %8s %10s\n", "task", "calls", "total, ms", "avg, ms", "threads", "imbalance");
+        for (const auto & child : root.children)
+        {
+            printNode(file, child, 0);
+        }
+    }
+
+    void writeTrace(FILE * file)
+    {
+        std::fprintf(file, "{\"traceEvents\":[");
+        bool isFirst = true;
+        for (ProfilerThreadData * data = _threads.load(); data; data = data->next)
+        {
+            for (const auto & event : data->events)
+            {
+                std::fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}", isFirst ? "" : ",", event.name,
+                             data->threadId, event.start * 1e-3, (event.end - event.start) * 1e-3);
+                isFirst = false;
+            }
+            if (data->droppedEventCount)
+            {
+                std::fprintf(stderr, "DAAL profiler: %zu events of thread %zu are not stored in the trace\n", data->droppedEventCount,
+                             data->threadId);
+            }
+        }
+        std::fprintf(file, "\n]}\n");
+    }
+
+private:
+    std::atomic<ProfilerMode> _mode;
+    const std::chrono::steady_clock::time_point _origin;
+    std::atomic<ProfilerThreadData *> _threads;
+    std::atomic<size_t> _threadCount;
+};
+
+ProfilerState & getProfilerState()
+{
+    static ProfilerState state;
+    return state;
+}
+
+} // namespace
+
+bool Profiler::isEnabled()
+{
+    return getProfilerState().getMode() != ProfilerMode::disabled;
+}
+
+ProfilerMode Profiler::getMode()
+{
+    return getProfilerState().getMode();
+}
+
+void Profiler::setMode(ProfilerMode mode)
+{
+    getProfilerState().setMode(mode);
+}
+
+void Profiler::writeReport(FILE * file)
+{
+    getProfilerState().writeReport(file);
+}
+
+void Profiler::writeTrace(FILE * file)
+{
+    getProfilerState().writeTrace(file);
+}
+
 ProfilerTask Profiler::startTask(const char * taskName)
 {
     return ProfilerTask(taskName);
 }
 
-void Profiler::endTask(const char * taskName) {}
+void Profiler::beginTask(const char * taskName)
+{
+    ProfilerState & state    = getProfilerState();
+    ProfilerThreadData & data = state.getThreadData();
+
+    const size_t parent = data.stack.empty() ? 0 : data.stack.back().node;
+    size_t node         = data.nodes[parent].firstChild;
+    while (node != 0 && !isSameName(data.nodes[node].name, taskName))
+    {
+        node = data.nodes[node].nextSibling;
+    }
+    if (node == 0)
+    {
+        node = data.nodes.size();
+        data.nodes.push_back(ProfilerNode { taskName, parent, 0, data.nodes[parent].firstChild, 0, 0 });
+        data.nodes[parent].firstChild = node;
+    }
+
+    data.stack.push_back(ProfilerOpenTask { node, state.now() });
+}
+
+void Profiler::endTask(const char * taskName)
+{
+    /* The task is ended even if the profiler is disabled after it has started,
+       otherwise it stays on the stack and the next tasks are nested into it */
+    ProfilerState & state    = getProfilerState();
+    ProfilerThreadData & data = state.getThreadData();
+    if (data.stack.empty()) return;
+
+    const uint64_t end           = state.now();
+    const ProfilerOpenTask task = data.stack.back();
+    data.stack.pop_back();
 
-ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
+    ProfilerNode & node = data.nodes[task.node];
+    node.count += 1;
+    node.totalTime += end - task.start;
+
+    if (state.getMode() == ProfilerMode::trace)
+    {
+        if (data.events.size() < maxTraceEventCount)
+        {
+            data.events.push_back(ProfilerTraceEvent { node.name, task.start, end });
+        }
+        else
+        {
+            ++data.droppedEventCount;
+        }
+    }
+}
+
+ProfilerTask::ProfilerTask(const char * taskName) : _taskName(Profiler::isEnabled() ? taskName : nullptr)
+{
+    if (_taskName) Profiler::beginTask(_taskName);
+}
+
+ProfilerTask::ProfilerTask(ProfilerTask && other) : _taskName(other._taskName)
+{
+    other._taskName = nullptr;
+}
 
 ProfilerTask::~ProfilerTask()
 {
-    Profiler::endTask(_taskName);
+    if (_taskName) Profiler::endTask(_taskName);
 }
 
 } // namespace internal
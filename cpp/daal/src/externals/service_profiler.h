@@ -21,27 +21,73 @@
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
+#include <cstdio>
+
 namespace daal
 {
 namespace internal
 {
+enum class ProfilerMode
+{
+    disabled,
+    report,
+    trace
+};
+
+/* Scoped task of the profiler: the task starts in the constructor and ends in the destructor */
 class ProfilerTask
 {
 public:
     ProfilerTask(const char * taskName);
+    ProfilerTask(ProfilerTask && other);
     ~ProfilerTask();
 
+    ProfilerTask(const ProfilerTask &) = delete;
+    ProfilerTask & operator=(const ProfilerTask &) = delete;
+    ProfilerTask & operator=(ProfilerTask &&) = delete;
+
 private:
     const char * _taskName;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
+/* Profiler of the library kernels.
+   The profiler is enabled by the DAAL_PROFILER environment variable read at the first task:
+     DAAL_PROFILER=report  prints the hierarchical report of the tasks at exit,
+     DAAL_PROFILER=trace   writes the tasks in Chrome trace format at exit.
+   The output goes to the file set by DAAL_PROFILER_OUTPUT, the default is stderr for the report
+   and daal_profiler_trace.json for the trace.
+   The times of the tasks are recorded into the buffers of the threads, so the tasks running
+   in parallel do not synchronize with each other. */
 class Profiler
 {
 public:
     static ProfilerTask startTask(const char * taskName);
+    /* Ends the last started task of the thread, whatever the current mode is */
     static void endTask(const char * taskName);
+
+    static bool isEnabled();
+
+    static ProfilerMode getMode();
+
+    /* Overrides the mode set by DAAL_PROFILER, the tasks recorded so far are kept.
+       Nothing is written at exit if the mode is disabled */
+    static void setMode(ProfilerMode mode);
+
+    /* Write the tasks recorded so far as they are written at exit in the corresponding mode.
+       The tasks must not run while the output is written */
+    static void writeReport(FILE * file);
+    static void writeTrace(FILE * file);
+
+private:
+    static void beginTask(const char * taskName);
+
+    friend class ProfilerTask;
 };
 
 } // namespace internal
 } // namespace daal
+
+#endif // __SERVICE_PROFILER_H__
@@ -92,15 +92,111 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalCo
     return 1;
 }
 
-DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
-{
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
-        int i;
-        for (i = r.begin(); i < r.end(); i++)
+namespace
+{
+/* Returns true if the loop of n iterations should run in the calling thread:
+   it fits a single block of grain_size iterations or only one thread is allowed */
+inline bool is_serial_loop(int n, int threads_request, int grain_size)
+{
+    return n <= grain_size || threads_request == 1 || tbb::this_task_arena::max_concurrency() == 1;
+}
+
+/* Calls body(begin, end) for the blocks of [0, n) in parallel.
+   The blocks contain at most grain_size iterations. If threads_request is positive and
+   the loop can be split into more blocks, exactly threads_request equal blocks are created,
+   so at most threads_request threads work on the loop */
+template <typename Body>
+inline void parallel_for_blocks(int n, int threads_request, int grain_size, const Body & body)
+{
+    const int block_count = n / grain_size + !!(n % grain_size);
+    if (threads_request > 0 && threads_request < block_count)
+    {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, threads_request, 1),
+            [&](tbb::blocked_range<int> r) {
+                for (int i = r.begin(); i < r.end(); ++i)
+                {
+                    const int begin = int((int64_t(n) * i) / threads_request);
+                    const int end   = int((int64_t(n) * (i + 1)) / threads_request);
+                    body(begin, end);
+                }
+            },
+            tbb::simple_partitioner {});
+    }
+    else
+    {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, n, grain_size), [&](tbb::blocked_range<int> r) { body(r.begin(), r.end()); });
+    }
+}
+
+/* Runs the loop of n iterations on at most threads_request threads. The loop runs in
+   the calling arena if the limit does not restrict it: the limit is not positive, not
+   less than the concurrency of the arena or the loop has at most threads_request
+   iterations. Otherwise it runs in a task arena of threads_request slots, so the
+   partitioning of the loop stays the same */
+template <typename Loop>
+inline void execute_with_threads_limit(int n, int threads_request, const Loop & loop)
+{
+    if (threads_request > 0 && threads_request < n && threads_request < tbb::this_task_arena::max_concurrency())
+    {
+        tbb::task_arena arena(threads_request);
+        arena.execute(loop);
+    }
+    else
+    {
+        loop();
+    }
+}
+
+inline void threader_for_impl(int n, int threads_request, int grain_size, const void * a, daal::functype func)
+{
+    grain_size = grain_size > 0 ? grain_size : 1;
+    if (is_serial_loop(n, threads_request, grain_size))
+    {
+        for (int i = 0; i < n; i++)
         {
             func(i, a);
         }
+        return;
+    }
+    parallel_for_blocks(n, threads_request, grain_size, [&](int begin, int end) {
+        for (int i = begin; i < end; i++)
+        {
+            func(i, a);
+        }
+    });
+}
+
+inline void threader_for_blocked_impl(int n, int threads_request, int grain_size, const void * a, daal::functype2 func)
+{
+    grain_size = grain_size > 0 ? grain_size : 1;
+    if (n <= 0)
+    {
+        return;
+    }
+    if (is_serial_loop(n, threads_request, grain_size))
+    {
+        func(0, n, a);
+        return;
+    }
+    parallel_for_blocks(n, threads_request, grain_size, [&](int begin, int end) { func(begin, end - begin, a); });
+}
+} // namespace
+#endif
+
+DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__)
+    execute_with_threads_limit(n, threads_request, [&]() {
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
+            int i;
+            for (i = r.begin(); i < r.end(); i++)
+            {
+                func(i, a);
+            }
+        });
     });
 #elif defined(__DO_SEQ_LAYER__)
     int i;
@@ -111,6 +207,19 @@ DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a,
 #endif
 }
 
+DAAL_EXPORT void _daal_threader_for_grain(int n, int threads_request, int grain_size, const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__)
+    threader_for_impl(n, threads_request, grain_size, a, func);
+#elif defined(__DO_SEQ_LAYER__)
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        func(i, a);
+    }
+#endif
+}
+
 DAAL_EXPORT void _daal_threader_for_int64(int64_t n, const void * a, daal::functype_int64 func)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -133,16 +242,18 @@ DAAL_EXPORT void _daal_threader_for_int64(int64_t n, const void * a, daal::funct
 DAAL_EXPORT void _daal_threader_for_simple(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(
-        tbb::blocked_range<int>(0, n, 1),
-        [&](tbb::blocked_range<int> r) {
-            int i;
-            for (i = r.begin(); i < r.end(); i++)
-            {
-                func(i, a);
-            }
-        },
-        tbb::simple_partitioner {});
+    execute_with_threads_limit(n, threads_request, [&]() {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, n, 1),
+            [&](tbb::blocked_range<int> r) {
+                int i;
+                for (i = r.begin(); i < r.end(); i++)
+                {
+                    func(i, a);
+                }
+            },
+            tbb::simple_partitioner {});
+    });
 #elif defined(__DO_SEQ_LAYER__)
     int i;
     for (i = 0; i < n; i++)
@@ -268,7 +379,18 @@ DAAL_PARALLEL_SORT_IMPL(daal::IdxValType<double>, pair_fp64_uint64)
 DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) { func(r.begin(), r.end() - r.begin(), a); });
+    execute_with_threads_limit(n, threads_request, [&]() {
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) { func(r.begin(), r.end() - r.begin(), a); });
+    });
+#elif defined(__DO_SEQ_LAYER__)
+    func(0, n, a);
+#endif
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_grain(int n, int threads_request, int grain_size, const void * a, daal::functype2 func)
+{
+#if defined(__DO_TBB_LAYER__)
+    threader_for_blocked_impl(n, threads_request, grain_size, a, func);
 #elif defined(__DO_SEQ_LAYER__)
     func(0, n, a);
 #endif
@@ -339,6 +461,26 @@ DAAL_EXPORT int _daal_threader_get_current_thread_index()
 #endif
 }
 
+DAAL_EXPORT void _daal_threader_execute_in_arena(int max_concurrency, int numa_node_id, const void * a, daal::functype_arena func)
+{
+#if defined(__DO_TBB_LAYER__)
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12010
+    tbb::task_arena::constraints constraints;
+    constraints.max_concurrency = (max_concurrency > 0) ? max_concurrency : tbb::task_arena::automatic;
+    if (numa_node_id >= 0)
+    {
+        constraints.numa_id = numa_node_id;
+    }
+    tbb::task_arena arena(constraints);
+    #else
+    tbb::task_arena arena((max_concurrency > 0) ? max_concurrency : tbb::task_arena::automatic);
+    #endif
+    arena.execute([&]() { func(a); });
+#elif defined(__DO_SEQ_LAYER__)
+    func(a);
+#endif
+}
+
 DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func)
 {
 #if defined(__DO_TBB_LAYER__)
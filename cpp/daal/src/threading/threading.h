@@ -47,6 +47,7 @@ typedef void (*functype2)(int i, int n, const void * a);
 typedef void * (*tls_functype)(const void * a);
 typedef void (*tls_reduce_functype)(void * p, const void * a);
 typedef void (*functype_break)(int i, bool & needBreak, const void * a);
+typedef void (*functype_arena)(const void * a);
 typedef int64_t (*loop_functype_int32_int64)(int32_t start_idx_reduce, int32_t end_idx_reduce, int64_t value_for_reduce, const void * a);
 typedef int64_t (*loop_functype_int32ptr_int64)(const int32_t * start_idx_reduce, const int32_t * end_idx_reduce, int64_t value_for_reduce,
                                                 const void * a);
@@ -59,12 +60,15 @@ extern "C"
 {
     DAAL_EXPORT int _daal_threader_get_max_threads();
     DAAL_EXPORT int _daal_threader_get_current_thread_index();
+    DAAL_EXPORT void _daal_threader_execute_in_arena(int max_concurrency, int numa_node_id, const void * a, daal::functype_arena func);
     DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func);
+    DAAL_EXPORT void _daal_threader_for_grain(int n, int threads_request, int grain_size, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_int64(int64_t n, const void * a, daal::functype_int64 func);
     DAAL_EXPORT void _daal_threader_for_simple(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_int32ptr(const int * begin, const int * end, const void * a, daal::functype_int32ptr func);
     DAAL_EXPORT void _daal_static_threader_for(size_t n, const void * a, daal::functype_static func);
     DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func);
+    DAAL_EXPORT void _daal_threader_for_blocked_grain(int n, int threads_request, int grain_size, const void * a, daal::functype2 func);
     DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void * a, daal::functype_break func);
 
@@ -214,6 +218,8 @@ inline void threader_func_break(int i, bool & needBreak, const void * a)
     lambda(i, needBreak);
 }
 
+/* Runs the loop on at most threads_request threads (no limit if threads_request <= 0).
+   The partitioning of the loop does not depend on threads_request */
 template <typename F>
 inline void threader_for(int n, int threads_request, const F & lambda)
 {
@@ -222,6 +228,18 @@ inline void threader_for(int n, int threads_request, const F & lambda)
     _daal_threader_for(n, threads_request, a, threader_func<F>);
 }
 
+/* Runs the loop on at most threads_request threads (no limit if threads_request <= 0)
+   in blocks of at most grain_size iterations, or in threads_request equal blocks if there
+   would be more blocks than threads. Loops of at most grain_size iterations run in the
+   calling thread without spawning tasks */
+template <typename F>
+inline void threader_for(int n, int threads_request, int grain_size, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_grain(n, threads_request, grain_size, a, threader_func<F>);
+}
+
 template <typename F>
 inline void threader_for_int64(int64_t n, const F & lambda)
 {
@@ -230,6 +248,8 @@ inline void threader_for_int64(int64_t n, const F & lambda)
     _daal_threader_for_int64(n, a, threader_func<F>);
 }
 
+/* Runs the loop on at most threads_request threads (no limit if threads_request <= 0)
+   with the simple partitioner */
 template <typename F>
 inline void threader_for_simple(int n, int threads_request, const F & lambda)
 {
@@ -254,6 +274,8 @@ inline void static_threader_for(size_t n, const F & lambda)
     _daal_static_threader_for(n, a, static_threader_func<F>);
 }
 
+/* Runs the loop on at most threads_request threads (no limit if threads_request <= 0)
+   and passes the blocks of iterations to the lambda */
 template <typename F>
 inline void threader_for_blocked(int n, int threads_request, const F & lambda)
 {
@@ -262,6 +284,14 @@ inline void threader_for_blocked(int n, int threads_request, const F & lambda)
     _daal_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
 }
 
+template <typename F>
+inline void threader_for_blocked(int n, int threads_request, int grain_size, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_grain(n, threads_request, grain_size, a, threader_func_b<F>);
+}
+
 template <typename F>
 inline void threader_for_optional(int n, int threads_request, const F & lambda)
 {
@@ -36,12 +36,15 @@
 #include "oneapi/dal/graph/service_functions.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/reorder.hpp"
 
 /* I/O */
 #include "oneapi/dal/io/csv.hpp"
 #include "oneapi/dal/io/load_graph.hpp"
 
 /* Algos */
+#include "oneapi/dal/algo/breadth_first_search.hpp"
+#include "oneapi/dal/algo/connected_components.hpp"
 #include "oneapi/dal/algo/decision_forest.hpp"
 #include "oneapi/dal/algo/jaccard.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism.hpp"
@@ -0,0 +1,678 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "oneapi/dal/algo/breadth_first_search/common.hpp"
+#include "oneapi/dal/algo/breadth_first_search/traverse_types.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/container.hpp"
+
+namespace oneapi::dal::preview::breadth_first_search::backend {
+using namespace oneapi::dal::preview::detail;
+using namespace oneapi::dal::preview::backend;
+
+using vertex_type = std::int32_t;
+using edge_type = std::int64_t;
+using level_type = std::int32_t;
+using bitmap_word_type = std::uint64_t;
+
+constexpr std::int64_t bitmap_word_size = 64;
+
+/// The parent of each vertex is the smallest vertex of the previous level adjacent
+/// to it, so it does not depend on the order the threads visit the edges. The
+/// parents are reduced with the minimum over this placeholder and the placeholders
+/// left are replaced by -1 in the end
+constexpr vertex_type no_parent = std::numeric_limits<vertex_type>::max();
+
+/// The traversal switches from the top-down steps to the bottom-up ones when the
+/// edges outgoing from the frontier exceed 1/alpha of the unexplored edges, and
+/// switches back when the frontier has less than 1/beta of the vertices
+constexpr std::int64_t alpha = 15;
+constexpr std::int64_t beta = 18;
+
+struct adjacency {
+    const edge_type* rows = nullptr;
+    const vertex_type* cols = nullptr;
+};
+
+inline std::int64_t get_degree(const adjacency& a, vertex_type v) {
+    return a.rows[v + 1] - a.rows[v];
+}
+
+inline std::int64_t get_bitmap_word_count(std::int64_t bit_count) {
+    return (bit_count + bitmap_word_size - 1) / bitmap_word_size;
+}
+
+inline bool test_bit(const bitmap_word_type* bitmap, vertex_type v) {
+    return (bitmap[v / bitmap_word_size] >> (v % bitmap_word_size)) & 1;
+}
+
+template <typename Body>
+inline void for_each_bit(bitmap_word_type word, Body&& body) {
+    for (std::int64_t bit = 0; word != 0; ++bit, word >>= 1) {
+        if (word & 1) {
+            body(bit);
+        }
+    }
+}
+
+/// Lists of the incoming edges used by the bottom-up steps. The lists of an
+/// undirected graph are the outgoing ones, the lists of a directed graph are built
+/// on the first request and sorted to keep the traversal order deterministic.
+class in_adjacency {
+public:
+    in_adjacency(const adjacency& out,
+                 std::int64_t vertex_count,
+                 bool is_directed,
+                 byte_alloc_iface* alloc_ptr)
+            : out_(out),
+              vertex_count_(vertex_count),
+              is_directed_(is_directed),
+              edge_allocator_(alloc_ptr),
+              vertex_allocator_(alloc_ptr) {}
+
+    in_adjacency(const in_adjacency&) = delete;
+    in_adjacency& operator=(const in_adjacency&) = delete;
+
+    ~in_adjacency() {
+        if (rows_ != nullptr) {
+            deallocate(edge_allocator_, rows_, vertex_count_ + 1);
+            deallocate(vertex_allocator_, cols_, out_.rows[vertex_count_]);
+        }
+    }
+
+    const adjacency& get() {
+        if (!is_directed_) {
+            return out_;
+        }
+        if (rows_ == nullptr) {
+            build();
+        }
+        return in_;
+    }
+
+    /// Whether the first vertex found in the list is the smallest one
+    bool is_sorted() const {
+        return is_directed_;
+    }
+
+private:
+    void build() {
+        const std::int64_t vertex_count = vertex_count_;
+        rows_ = allocate(edge_allocator_, vertex_count + 1);
+        cols_ = allocate(vertex_allocator_, out_.rows[vertex_count]);
+        edge_type* cursors = allocate(edge_allocator_, vertex_count);
+
+        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t v) {
+            rows_[v] = 0;
+        });
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+            for (edge_type e = out_.rows[u]; e < out_.rows[u + 1]; ++e) {
+                dal::detail::atomic_increment(rows_[out_.cols[e] + 1]);
+            }
+        });
+        for (std::int64_t v = 0; v < vertex_count; ++v) {
+            rows_[v + 1] += rows_[v];
+        }
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+            cursors[v] = rows_[v];
+        });
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+            for (edge_type e = out_.rows[u]; e < out_.rows[u + 1]; ++e) {
+                const edge_type position =
+                    dal::detail::atomic_fetch_add(cursors[out_.cols[e]], edge_type(1));
+                cols_[position] = static_cast<vertex_type>(u);
+            }
+        });
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+            std::sort(cols_ + rows_[v], cols_ + rows_[v + 1]);
+        });
+
+        deallocate(edge_allocator_, cursors, vertex_count);
+        in_ = adjacency{ rows_, cols_ };
+    }
+
+    const adjacency out_;
+    const std::int64_t vertex_count_;
+    const bool is_directed_;
+    inner_alloc<edge_type> edge_allocator_;
+    inner_alloc<vertex_type> vertex_allocator_;
+    edge_type* rows_ = nullptr;
+    vertex_type* cols_ = nullptr;
+    adjacency in_;
+};
+
+/// Moves the vertices collected by the threads to the queue. Returns the size of
+/// the queue
+template <typename LocalQueues>
+inline std::int64_t merge_local_queues(LocalQueues& local_queues,
+                                       vertex_type* queue,
+                                       std::int64_t* offsets) {
+    const std::int64_t thread_count = local_queues.size();
+    offsets[0] = 0;
+    for (std::int64_t thread = 0; thread < thread_count; ++thread) {
+        offsets[thread + 1] = offsets[thread] + local_queues[thread].size();
+    }
+
+    dal::detail::threader_for(thread_count, thread_count, [&](std::int32_t thread) {
+        auto& local_queue = local_queues[thread];
+        if (!local_queue.empty()) {
+            copy(local_queue.begin(), local_queue.end(), queue + offsets[thread]);
+            local_queue.resize(0);
+        }
+    });
+    return offsets[thread_count];
+}
+
+inline void queue_to_bitmap(const vertex_type* queue,
+                            std::int64_t queue_size,
+                            bitmap_word_type* bitmap,
+                            std::int64_t word_count) {
+    dal::detail::threader_for_int64(word_count, [&](std::int64_t w) {
+        bitmap[w] = 0;
+    });
+    dal::detail::threader_for_int64(queue_size, [&](std::int64_t i) {
+        const vertex_type v = queue[i];
+        dal::detail::atomic_fetch_or(bitmap[v / bitmap_word_size],
+                                     bitmap_word_type(1) << (v % bitmap_word_size));
+    });
+}
+
+template <typename LocalQueues>
+inline std::int64_t bitmap_to_queue(const bitmap_word_type* bitmap,
+                                    std::int64_t word_count,
+                                    LocalQueues& local_queues,
+                                    vertex_type* queue,
+                                    std::int64_t* offsets) {
+    dal::detail::threader_for_int64(word_count, [&](std::int64_t w) {
+        if (bitmap[w] == 0) {
+            return;
+        }
+        auto& local_queue = local_queues[dal::detail::threader_get_current_thread_index()];
+        for_each_bit(bitmap[w], [&](std::int64_t bit) {
+            local_queue.push_back(static_cast<vertex_type>(w * bitmap_word_size + bit));
+        });
+    });
+    return merge_local_queues(local_queues, queue, offsets);
+}
+
+/// Visits the unvisited outgoing neighbors of the frontier. A vertex belongs to
+/// the thread that sets its level first. Every vertex of the frontier adjacent to
+/// the vertex visited at this level competes for its parent.
+/// Returns the number of the edges outgoing from the next frontier
+template <typename LocalQueues>
+inline std::int64_t top_down_step(const adjacency& out,
+                                  const vertex_type* frontier,
+                                  std::int64_t frontier_size,
+                                  level_type level,
+                                  level_type* levels,
+                                  vertex_type* parents,
+                                  LocalQueues& local_queues) {
+    return dal::detail::parallel_reduce_int32_int64_t(
+        dal::detail::integral_cast<std::int32_t>(frontier_size),
+        std::int64_t(0),
+        [&](std::int64_t begin, std::int64_t end, std::int64_t scout_count) -> std::int64_t {
+            auto& local_queue = local_queues[dal::detail::threader_get_current_thread_index()];
+            for (std::int64_t i = begin; i < end; ++i) {
+                const vertex_type u = frontier[i];
+                for (edge_type e = out.rows[u]; e < out.rows[u + 1]; ++e) {
+                    const vertex_type v = out.cols[e];
+                    level_type v_level = dal::detail::atomic_load_relaxed(levels[v]);
+                    if (v_level < 0) {
+                        if (dal::detail::atomic_compare_exchange(levels[v], v_level, level)) {
+                            v_level = level;
+                            local_queue.push_back(v);
+                            scout_count += get_degree(out, v);
+                        }
+                    }
+                    if (parents != nullptr && v_level == level) {
+                        dal::detail::atomic_min(parents[v], u);
+                    }
+                }
+            }
+            return scout_count;
+        },
+        [](std::int64_t a, std::int64_t b) {
+            return a + b;
+        });
+}
+
+/// Looks for a parent in the frontier for each unvisited vertex. The vertices
+/// of a word of the bitmap are processed by one thread, so the next frontier is
+/// written without atomics. The search stops at the first parent found unless the
+/// smallest one is required from the unsorted lists.
+/// Returns the number of the visited vertices
+inline std::int64_t bottom_up_step(const adjacency& in,
+                                   bool is_sorted,
+                                   std::int64_t vertex_count,
+                                   const bitmap_word_type* frontier,
+                                   bitmap_word_type* next,
+                                   level_type level,
+                                   level_type* levels,
+                                   vertex_type* parents) {
+    return dal::detail::parallel_reduce_int32_int64_t(
+        dal::detail::integral_cast<std::int32_t>(get_bitmap_word_count(vertex_count)),
+        std::int64_t(0),
+        [&](std::int64_t begin, std::int64_t end, std::int64_t awake_count) -> std::int64_t {
+            const bool find_smallest = parents != nullptr && !is_sorted;
+            for (std::int64_t w = begin; w < end; ++w) {
+                bitmap_word_type word = 0;
+                const std::int64_t first = w * bitmap_word_size;
+                const std::int64_t last = std::min(first + bitmap_word_size, vertex_count);
+                for (std::int64_t v = first; v < last; ++v) {
+                    if (levels[v] >= 0) {
+                        continue;
+                    }
+                    for (edge_type e = in.rows[v]; e < in.rows[v + 1]; ++e) {
+                        const vertex_type u = in.cols[e];
+                        if (!test_bit(frontier, u)) {
+                            continue;
+                        }
+                        if (levels[v] < 0) {
+                            levels[v] = level;
+                            word |= bitmap_word_type(1) << (v - first);
+                            ++awake_count;
+                        }
+                        if (parents != nullptr) {
+                            parents[v] = std::min(parents[v], u);
+                        }
+                        if (!find_smallest) {
+                            break;
+                        }
+                    }
+                }
+                next[w] = word;
+            }
+            return awake_count;
+        },
+        [](std::int64_t a, std::int64_t b) {
+            return a + b;
+        });
+}
+
+/// Visits the outgoing neighbors of the frontier for all sources at once. The bit
+/// `b` of the masks corresponds to the source `b`. A vertex is added to the next
+/// frontier by the thread that sets its first bit, the parents are reduced with
+/// the atomic minimum
+template <typename LocalQueues>
+inline void multi_source_top_down_step(const adjacency& out,
+                                       const vertex_type* queue,
+                                       std::int64_t queue_size,
+                                       const bitmap_word_type* seen,
+                                       const bitmap_word_type* frontier,
+                                       bitmap_word_type* next,
+                                       std::int64_t source_count,
+                                       vertex_type* parents,
+                                       LocalQueues& local_queues) {
+    dal::detail::threader_for_int64(queue_size, [&](std::int64_t i) {
+        auto& local_queue = local_queues[dal::detail::threader_get_current_thread_index()];
+        const vertex_type u = queue[i];
+        const bitmap_word_type sources = frontier[u];
+        for (edge_type e = out.rows[u]; e < out.rows[u + 1]; ++e) {
+            const vertex_type v = out.cols[e];
+            const bitmap_word_type new_sources = sources & ~seen[v];
+            if (new_sources == 0) {
+                continue;
+            }
+            const bitmap_word_type previous = dal::detail::atomic_fetch_or(next[v], new_sources);
+            if (previous == 0) {
+                local_queue.push_back(v);
+            }
+            if (parents != nullptr) {
+                for_each_bit(new_sources, [&](std::int64_t b) {
+                    dal::detail::atomic_min(parents[v * source_count + b], u);
+                });
+            }
+        }
+    });
+}
+
+/// Collects the frontier bits of the incoming neighbors for each vertex that is
+/// not yet seen by all sources
+template <typename LocalQueues>
+inline void multi_source_bottom_up_step(const adjacency& in,
+                                        bool is_sorted,
+                                        std::int64_t vertex_count,
+                                        bitmap_word_type all_sources,
+                                        const bitmap_word_type* seen,
+                                        const bitmap_word_type* frontier,
+                                        bitmap_word_type* next,
+                                        std::int64_t source_count,
+                                        vertex_type* parents,
+                                        LocalQueues& local_queues) {
+    dal::detail::threader_for_int64(get_bitmap_word_count(vertex_count), [&](std::int64_t w) {
+        auto& local_queue = local_queues[dal::detail::threader_get_current_thread_index()];
+        const bool find_smallest = parents != nullptr && !is_sorted;
+        const std::int64_t first = w * bitmap_word_size;
+        const std::int64_t last = std::min(first + bitmap_word_size, vertex_count);
+        for (std::int64_t v = first; v < last; ++v) {
+            const bitmap_word_type missing = all_sources & ~seen[v];
+            if (missing == 0) {
+                continue;
+            }
+            bitmap_word_type found = 0;
+            for (edge_type e = in.rows[v];
+                 e < in.rows[v + 1] && (find_smallest || found != missing);
+                 ++e) {
+                const vertex_type u = in.cols[e];
+                const bitmap_word_type sources = frontier[u] & missing;
+                const bitmap_word_type new_sources = find_smallest ? sources : sources & ~found;
+                if (new_sources != 0) {
+                    found |= new_sources;
+                    if (parents != nullptr) {
+                        for_each_bit(new_sources, [&](std::int64_t b) {
+                            auto& parent = parents[v * source_count + b];
+                            parent = std::min(parent, u);
+                        });
+                    }
+                }
+            }
+            if (found != 0) {
+                next[v] = found;
+                local_queue.push_back(static_cast<vertex_type>(v));
+            }
+        }
+    });
+}
+
+inline void finalize_parents(vertex_type* parents, std::int64_t size) {
+    if (parents == nullptr) {
+        return;
+    }
+    dal::detail::threader_for_int64(size, [&](std::int64_t i) {
+        if (parents[i] == no_parent) {
+            parents[i] = -1;
+        }
+    });
+}
+
+template <typename Task>
+inline traverse_result<Task> make_result(const detail::descriptor_base<Task>& desc,
+                                         const array<level_type>& levels_arr,
+                                         const array<vertex_type>& parents_arr,
+                                         std::int64_t vertex_count,
+                                         std::int64_t source_count) {
+    traverse_result<Task> result;
+    if (desc.get_optional_results() & optional_results::levels) {
+        result.set_levels(dal::detail::homogen_table_builder{}
+                              .reset(levels_arr, vertex_count, source_count)
+                              .build());
+    }
+    if (desc.get_optional_results() & optional_results::parents) {
+        result.set_parents(dal::detail::homogen_table_builder{}
+                               .reset(parents_arr, vertex_count, source_count)
+                               .build());
+    }
+    return result;
+}
+
+template <typename Cpu, typename Task>
+struct direction_optimizing_bfs;
+
+/// Direction-optimizing breadth first search. The frontier is kept as a queue in
+/// the top-down steps and as a bitmap in the bottom-up ones
+template <typename Cpu>
+struct direction_optimizing_bfs<Cpu, task::one_to_all> {
+    traverse_result<task::one_to_all> operator()(
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        bool is_directed,
+        byte_alloc_iface* alloc_ptr) {
+        using vertex_allocator_type = inner_alloc<vertex_type>;
+        using offset_allocator_type = inner_alloc<std::int64_t>;
+        using word_allocator_type = inner_alloc<bitmap_word_type>;
+        using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
+        using v1a_t = inner_alloc<v1v_t>;
+        using v2v_t = vector_container<v1v_t, v1a_t>;
+
+        const std::int64_t vertex_count = t.get_vertex_count();
+        const auto source = dal::detail::integral_cast<vertex_type>(desc.get_source());
+        const bool compute_parents =
+            static_cast<bool>(desc.get_optional_results() & optional_results::parents);
+        const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+        const std::int64_t word_count = get_bitmap_word_count(vertex_count);
+
+        const adjacency out{ t._rows_ptr, t._cols_ptr };
+        in_adjacency in(out, vertex_count, is_directed, alloc_ptr);
+
+        auto levels_arr = array<level_type>::empty(vertex_count);
+        auto parents_arr = compute_parents ? array<vertex_type>::empty(vertex_count)
+                                           : array<vertex_type>();
+        level_type* levels = levels_arr.get_mutable_data();
+        vertex_type* parents = compute_parents ? parents_arr.get_mutable_data() : nullptr;
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+            levels[v] = -1;
+            if (parents != nullptr) {
+                parents[v] = no_parent;
+            }
+        });
+        levels[source] = 0;
+
+        vertex_allocator_type vertex_allocator(alloc_ptr);
+        offset_allocator_type offset_allocator(alloc_ptr);
+        word_allocator_type word_allocator(alloc_ptr);
+        v1a_t v1a(alloc_ptr);
+        v2v_t local_queues(thread_count, v1a);
+        vertex_type* queue = allocate(vertex_allocator, vertex_count);
+        std::int64_t* offsets = allocate(offset_allocator, thread_count + 1);
+        bitmap_word_type* frontier_bits = allocate(word_allocator, word_count);
+        bitmap_word_type* next_bits = allocate(word_allocator, word_count);
+
+        queue[0] = source;
+        std::int64_t queue_size = 1;
+        std::int64_t edges_to_check = out.rows[vertex_count];
+        std::int64_t scout_count = get_degree(out, source);
+        level_type level = 0;
+
+        while (queue_size > 0) {
+            if (scout_count > edges_to_check / alpha) {
+                const adjacency& in_edges = in.get();
+                queue_to_bitmap(queue, queue_size, frontier_bits, word_count);
+                std::int64_t awake_count = queue_size;
+                std::int64_t old_awake_count = 0;
+                do {
+                    old_awake_count = awake_count;
+                    ++level;
+                    awake_count = bottom_up_step(in_edges,
+                                                 in.is_sorted(),
+                                                 vertex_count,
+                                                 frontier_bits,
+                                                 next_bits,
+                                                 level,
+                                                 levels,
+                                                 parents);
+                    std::swap(frontier_bits, next_bits);
+                } while (awake_count >= old_awake_count || awake_count > vertex_count / beta);
+                queue_size =
+                    bitmap_to_queue(frontier_bits, word_count, local_queues, queue, offsets);
+                scout_count = 1;
+            }
+            else {
+                edges_to_check -= scout_count;
+                ++level;
+                scout_count =
+                    top_down_step(out, queue, queue_size, level, levels, parents, local_queues);
+                queue_size = merge_local_queues(local_queues, queue, offsets);
+            }
+        }
+
+        deallocate(word_allocator, next_bits, word_count);
+        deallocate(word_allocator, frontier_bits, word_count);
+        deallocate(offset_allocator, offsets, thread_count + 1);
+        deallocate(vertex_allocator, queue, vertex_count);
+
+        finalize_parents(parents, vertex_count);
+        return make_result(desc, levels_arr, parents_arr, vertex_count, 1);
+    }
+};
+
+/// Breadth first search from several sources at once. Each vertex keeps 64-bit
+/// masks of the sources that have seen it and have it in the frontier, so one pass
+/// over the adjacency expands the frontiers of all the sources
+template <typename Cpu>
+struct direction_optimizing_bfs<Cpu, task::many_to_all> {
+    traverse_result<task::many_to_all> operator()(
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        bool is_directed,
+        byte_alloc_iface* alloc_ptr) {
+        using vertex_allocator_type = inner_alloc<vertex_type>;
+        using offset_allocator_type = inner_alloc<std::int64_t>;
+        using word_allocator_type = inner_alloc<bitmap_word_type>;
+        using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
+        using v1a_t = inner_alloc<v1v_t>;
+        using v2v_t = vector_container<v1v_t, v1a_t>;
+
+        const std::int64_t vertex_count = t.get_vertex_count();
+        const auto& sources = desc.get_sources();
+        const std::int64_t source_count = sources.size();
+        ONEDAL_ASSERT(source_count > 0 && source_count <= max_source_count);
+        const bitmap_word_type all_sources =
+            source_count == bitmap_word_size ? ~bitmap_word_type(0)
+                                             : (bitmap_word_type(1) << source_count) - 1;
+        const bool compute_parents =
+            static_cast<bool>(desc.get_optional_results() & optional_results::parents);
+        const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+        const std::int64_t result_size = vertex_count * source_count;
+
+        const adjacency out{ t._rows_ptr, t._cols_ptr };
+        in_adjacency in(out, vertex_count, is_directed, alloc_ptr);
+
+        auto levels_arr = array<level_type>::empty(result_size);
+        auto parents_arr =
+            compute_parents ? array<vertex_type>::empty(result_size) : array<vertex_type>();
+        level_type* levels = levels_arr.get_mutable_data();
+        vertex_type* parents = compute_parents ? parents_arr.get_mutable_data() : nullptr;
+        dal::detail::threader_for_int64(result_size, [&](std::int64_t i) {
+            levels[i] = -1;
+            if (parents != nullptr) {
+                parents[i] = no_parent;
+            }
+        });
+
+        vertex_allocator_type vertex_allocator(alloc_ptr);
+        offset_allocator_type offset_allocator(alloc_ptr);
+        word_allocator_type word_allocator(alloc_ptr);
+        v1a_t v1a(alloc_ptr);
+        v2v_t local_queues(thread_count, v1a);
+        vertex_type* queue = allocate(vertex_allocator, vertex_count);
+        std::int64_t* offsets = allocate(offset_allocator, thread_count + 1);
+        bitmap_word_type* seen = allocate(word_allocator, vertex_count);
+        bitmap_word_type* frontier = allocate(word_allocator, vertex_count);
+        bitmap_word_type* next = allocate(word_allocator, vertex_count);
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+            seen[v] = 0;
+            frontier[v] = 0;
+            next[v] = 0;
+        });
+
+        std::int64_t queue_size = 0;
+        std::int64_t frontier_edge_count = 0;
+        for (std::int64_t b = 0; b < source_count; ++b) {
+            const auto source = dal::detail::integral_cast<vertex_type>(sources[b]);
+            if (frontier[source] == 0) {
+                queue[queue_size++] = source;
+                frontier_edge_count += get_degree(out, source);
+            }
+            frontier[source] |= bitmap_word_type(1) << b;
+            seen[source] = frontier[source];
+            levels[source * source_count + b] = 0;
+        }
+
+        std::int64_t edges_to_check = out.rows[vertex_count];
+        bool bottom_up = false;
+        level_type level = 0;
+
+        while (queue_size > 0) {
+            ++level;
+            if (!bottom_up) {
+                bottom_up = frontier_edge_count > edges_to_check / alpha;
+            }
+            else {
+                bottom_up = queue_size >= vertex_count / beta;
+            }
+
+            if (bottom_up) {
+                multi_source_bottom_up_step(in.get(),
+                                            in.is_sorted(),
+                                            vertex_count,
+                                            all_sources,
+                                            seen,
+                                            frontier,
+                                            next,
+                                            source_count,
+                                            parents,
+                                            local_queues);
+            }
+            else {
+                edges_to_check -= frontier_edge_count;
+                multi_source_top_down_step(out,
+                                           queue,
+                                           queue_size,
+                                           seen,
+                                           frontier,
+                                           next,
+                                           source_count,
+                                           parents,
+                                           local_queues);
+            }
+
+            dal::detail::threader_for_int64(queue_size, [&](std::int64_t i) {
+                frontier[queue[i]] = 0;
+            });
+            queue_size = merge_local_queues(local_queues, queue, offsets);
+            frontier_edge_count = dal::detail::parallel_reduce_int32_int64_t(
+                dal::detail::integral_cast<std::int32_t>(queue_size),
+                std::int64_t(0),
+                [&](std::int64_t begin, std::int64_t end, std::int64_t edge_count)
+                    -> std::int64_t {
+                    for (std::int64_t i = begin; i < end; ++i) {
+                        const vertex_type v = queue[i];
+                        const bitmap_word_type new_sources = next[v];
+                        next[v] = 0;
+                        frontier[v] = new_sources;
+                        seen[v] |= new_sources;
+                        for_each_bit(new_sources, [&](std::int64_t b) {
+                            levels[v * source_count + b] = level;
+                        });
+                        edge_count += get_degree(out, v);
+                    }
+                    return edge_count;
+                },
+                [](std::int64_t a, std::int64_t b) {
+                    return a + b;
+                });
+        }
+
+        deallocate(word_allocator, next, vertex_count);
+        deallocate(word_allocator, frontier, vertex_count);
+        deallocate(word_allocator, seen, vertex_count);
+        deallocate(offset_allocator, offsets, thread_count + 1);
+        deallocate(vertex_allocator, queue, vertex_count);
+
+        finalize_parents(parents, result_size);
+        return make_result(desc, levels_arr, parents_arr, vertex_count, source_count);
+    }
+};
+
+} // namespace oneapi::dal::preview::breadth_first_search::backend
@@ -0,0 +1,26 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/breadth_first_search/backend/cpu/traverse_default_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::preview::breadth_first_search::backend {
+
+template struct direction_optimizing_bfs<__CPU_TAG__, task::one_to_all>;
+
+template struct direction_optimizing_bfs<__CPU_TAG__, task::many_to_all>;
+
+} // namespace oneapi::dal::preview::breadth_first_search::backend
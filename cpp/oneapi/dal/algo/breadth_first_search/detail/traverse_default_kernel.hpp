@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/breadth_first_search/common.hpp"
+#include "oneapi/dal/algo/breadth_first_search/traverse_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
+
+namespace oneapi::dal::preview::breadth_first_search::detail {
+
+using namespace dal::preview::detail;
+
+template <typename Method, typename Task, typename Allocator, typename Graph>
+struct traverse_kernel_cpu {
+    inline traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
+                                            const detail::descriptor_base<Task>& desc,
+                                            const Allocator& alloc,
+                                            const Graph& g) const;
+};
+
+template <typename Task, typename Topology, typename... Param>
+struct direction_optimizing_bfs {
+    traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
+                                     const detail::descriptor_base<Task>& desc,
+                                     const Topology& t,
+                                     bool is_directed,
+                                     byte_alloc_iface* alloc) const;
+};
+
+template <typename Task>
+struct direction_optimizing_bfs<Task, dal::preview::detail::topology<std::int32_t>> {
+    traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
+                                     const detail::descriptor_base<Task>& desc,
+                                     const dal::preview::detail::topology<std::int32_t>& t,
+                                     bool is_directed,
+                                     byte_alloc_iface* alloc) const;
+};
+
+template <typename Task, typename Allocator, typename Graph>
+struct traverse_kernel_cpu<method::direction_optimizing, Task, Allocator, Graph> {
+    inline traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
+                                            const detail::descriptor_base<Task>& desc,
+                                            const Allocator& alloc,
+                                            const Graph& g) const {
+        using topology_type = typename graph_traits<Graph>::impl_type::topology_type;
+        const auto& t = dal::detail::get_impl(g).get_topology();
+        alloc_connector<Allocator> alloc_con(alloc);
+        return direction_optimizing_bfs<Task, topology_type>{}(ctx,
+                                                               desc,
+                                                               t,
+                                                               is_directed<Graph>,
+                                                               &alloc_con);
+    }
+};
+
+} // namespace oneapi::dal::preview::breadth_first_search::detail
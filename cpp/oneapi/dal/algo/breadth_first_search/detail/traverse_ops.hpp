@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/breadth_first_search/common.hpp"
+#include "oneapi/dal/algo/breadth_first_search/detail/select_kernel.hpp"
+#include "oneapi/dal/algo/breadth_first_search/traverse_types.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+
+namespace oneapi::dal::preview::breadth_first_search::detail {
+
+template <typename Policy, typename Descriptor, typename Graph>
+struct traverse_ops_dispatcher {
+    using task_t = typename Descriptor::task_t;
+    traverse_result<task_t> operator()(const Policy &policy,
+                                       const Descriptor &descriptor,
+                                       traverse_input<Graph, task_t> &input) const {
+        static auto impl = get_backend<Policy, Descriptor>(descriptor, input.get_graph());
+        return (*impl)(policy, descriptor, input.get_graph());
+    }
+};
+
+template <typename Descriptor, typename Graph>
+struct traverse_ops {
+    using float_t = typename Descriptor::float_t;
+    using task_t = typename Descriptor::task_t;
+    using method_t = typename Descriptor::method_t;
+    using allocator_t = typename Descriptor::allocator_t;
+    using graph_t = Graph;
+    using input_t = traverse_input<graph_t, task_t>;
+    using result_t = traverse_result<task_t>;
+    using descriptor_base_t = descriptor_base<task_t>;
+
+    static void check_source(std::int64_t source, std::int64_t vertex_count) {
+        using msg = dal::detail::error_messages;
+        if (source < 0) {
+            throw invalid_argument(msg::negative_source());
+        }
+        if (source >= vertex_count) {
+            throw invalid_argument(msg::source_gte_vertex_count());
+        }
+    }
+
+    void check_preconditions(const Descriptor &desc, input_t &input) const {
+        using msg = dal::detail::error_messages;
+        const std::int64_t vertex_count =
+            dal::detail::get_impl(input.get_graph()).get_topology()._vertex_count;
+        if constexpr (std::is_same_v<task_t, task::one_to_all>) {
+            check_source(desc.get_source(), vertex_count);
+        }
+        else {
+            const auto &sources = desc.get_sources();
+            if (sources.empty()) {
+                throw invalid_argument(msg::empty_source_list());
+            }
+            if (static_cast<std::int64_t>(sources.size()) > max_source_count) {
+                throw invalid_argument(msg::source_count_gt_max_source_count());
+            }
+            for (const std::int64_t source : sources) {
+                check_source(source, vertex_count);
+            }
+        }
+        if (!(desc.get_optional_results() &
+              (optional_results::parents | optional_results::levels))) {
+            throw invalid_argument(msg::nothing_to_compute());
+        }
+    }
+
+    template <typename Policy>
+    auto operator()(const Policy &policy, const Descriptor &desc, input_t &input) const {
+        check_preconditions(desc, input);
+        return traverse_ops_dispatcher<Policy, Descriptor, Graph>()(policy, desc, input);
+    }
+};
+
+} // namespace oneapi::dal::preview::breadth_first_search::detail
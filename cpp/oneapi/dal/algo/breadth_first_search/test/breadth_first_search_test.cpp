@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <optional>
+#include <queue>
+#include <vector>
+
+#include "oneapi/dal/algo/breadth_first_search/traverse.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+
+namespace oneapi::dal::algo::breadth_first_search::test {
+
+namespace bfs = dal::preview::breadth_first_search;
+
+namespace te = dal::test::engine;
+
+class breadth_first_search_test {
+public:
+    template <typename Graph>
+    Graph create_graph(std::int64_t vertex_count, const te::edge_list_t &edges) {
+        adjacency_ = te::make_adjacency(vertex_count, edges, dal::preview::is_directed<Graph>);
+        return builder_.build<Graph>(adjacency_);
+    }
+
+    te::edge_list_t generate_edges(std::int64_t vertex_count, std::int64_t edge_count) {
+        return te::generate_edges(vertex_count, edge_count);
+    }
+
+    std::vector<std::int32_t> compute_reference_levels(std::int32_t source) const {
+        std::vector<std::int32_t> levels(adjacency_.size(), -1);
+        std::queue<std::int32_t> queue;
+        levels[source] = 0;
+        queue.push(source);
+        while (!queue.empty()) {
+            const std::int32_t u = queue.front();
+            queue.pop();
+            for (const std::int32_t v : adjacency_[u]) {
+                if (levels[v] < 0) {
+                    levels[v] = levels[u] + 1;
+                    queue.push(v);
+                }
+            }
+        }
+        return levels;
+    }
+
+    /// The parent of a vertex is the smallest adjacent vertex of the previous level
+    std::vector<std::int32_t> compute_reference_parents(
+        const std::vector<std::int32_t> &levels) const {
+        const std::int64_t vertex_count = adjacency_.size();
+        std::vector<std::int32_t> parents(vertex_count, -1);
+        for (std::int32_t u = 0; u < vertex_count; ++u) {
+            if (levels[u] < 0) {
+                continue;
+            }
+            for (const std::int32_t v : adjacency_[u]) {
+                if (levels[v] == levels[u] + 1 && (parents[v] < 0 || u < parents[v])) {
+                    parents[v] = u;
+                }
+            }
+        }
+        return parents;
+    }
+
+    void check_column(const std::int32_t *levels,
+                      const std::int32_t *parents,
+                      std::int64_t column,
+                      std::int64_t column_count,
+                      std::int32_t source) const {
+        const auto reference = compute_reference_levels(source);
+        const auto reference_parents = compute_reference_parents(reference);
+        const std::int64_t vertex_count = reference.size();
+        for (std::int64_t v = 0; v < vertex_count; ++v) {
+            REQUIRE(levels[v * column_count + column] == reference[v]);
+            REQUIRE(parents[v * column_count + column] == reference_parents[v]);
+        }
+    }
+
+    template <typename Graph>
+    void check_one_to_all(const Graph &g, std::int64_t source) {
+        const auto desc = bfs::descriptor<>(source,
+                                            bfs::optional_results::levels |
+                                                bfs::optional_results::parents);
+        const auto result = dal::preview::traverse(desc, g);
+        const std::int64_t vertex_count = adjacency_.size();
+        REQUIRE(result.get_levels().get_row_count() == vertex_count);
+        REQUIRE(result.get_levels().get_column_count() == 1);
+
+        const auto levels = row_accessor<const std::int32_t>(result.get_levels()).pull();
+        const auto parents = row_accessor<const std::int32_t>(result.get_parents()).pull();
+        check_column(levels.get_data(), parents.get_data(), 0, 1, source);
+    }
+
+    template <typename Graph>
+    void check_many_to_all(const Graph &g, const std::vector<std::int64_t> &sources) {
+        const auto desc =
+            bfs::descriptor<float, bfs::method::by_default, bfs::task::many_to_all>(
+                sources,
+                bfs::optional_results::levels | bfs::optional_results::parents);
+        const auto result = dal::preview::traverse(desc, g);
+        const std::int64_t vertex_count = adjacency_.size();
+        const std::int64_t source_count = sources.size();
+        REQUIRE(result.get_levels().get_row_count() == vertex_count);
+        REQUIRE(result.get_levels().get_column_count() == source_count);
+
+        const auto levels = row_accessor<const std::int32_t>(result.get_levels()).pull();
+        const auto parents = row_accessor<const std::int32_t>(result.get_parents()).pull();
+        for (std::int64_t i = 0; i < source_count; ++i) {
+            check_column(levels.get_data(), parents.get_data(), i, source_count, sources[i]);
+        }
+    }
+
+    /// Checks that the traversal limited to a single thread returns the same levels
+    /// and parents as the parallel one
+    template <typename Descriptor, typename Graph>
+    void check_same_as_sequential(const Descriptor &desc, const Graph &g) {
+        using result_t = decltype(dal::preview::traverse(desc, g));
+        std::optional<result_t> sequential_result;
+        dal::detail::threader_execute_in_arena(1, -1, [&]() {
+            sequential_result.emplace(dal::preview::traverse(desc, g));
+        });
+        const auto result = dal::preview::traverse(desc, g);
+
+        check_same(sequential_result->get_levels(), result.get_levels());
+        check_same(sequential_result->get_parents(), result.get_parents());
+    }
+
+    void check_same(const table &expected, const table &actual) {
+        REQUIRE(expected.get_row_count() == actual.get_row_count());
+        REQUIRE(expected.get_column_count() == actual.get_column_count());
+        const auto expected_rows = row_accessor<const std::int32_t>(expected).pull();
+        const auto actual_rows = row_accessor<const std::int32_t>(actual).pull();
+        for (std::int64_t i = 0; i < expected_rows.get_count(); ++i) {
+            REQUIRE(expected_rows[i] == actual_rows[i]);
+        }
+    }
+
+private:
+    te::graph_builder builder_;
+    te::adjacency_t adjacency_;
+};
+
+using directed_graph_t = dal::preview::directed_adjacency_vector_graph<>;
+using undirected_graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+
+TEST_M(breadth_first_search_test, "levels and parents of a path", "[bfs]") {
+    const auto g = create_graph<undirected_graph_t>(5, { { 0, 1 }, { 1, 2 }, { 2, 3 } });
+    const auto desc = bfs::descriptor<>(1, bfs::optional_results::levels |
+                                               bfs::optional_results::parents);
+    const auto result = dal::preview::traverse(desc, g);
+
+    const auto levels = row_accessor<const std::int32_t>(result.get_levels()).pull();
+    const auto parents = row_accessor<const std::int32_t>(result.get_parents()).pull();
+    const std::int32_t expected_levels[] = { 1, 0, 1, 2, -1 };
+    const std::int32_t expected_parents[] = { 1, -1, 1, 2, -1 };
+    for (std::int64_t v = 0; v < 5; ++v) {
+        REQUIRE(levels[v] == expected_levels[v]);
+        REQUIRE(parents[v] == expected_parents[v]);
+    }
+}
+
+TEST_M(breadth_first_search_test, "follows direction of edges", "[bfs]") {
+    const auto g = create_graph<directed_graph_t>(4, { { 0, 1 }, { 2, 1 }, { 1, 3 } });
+    const auto result = dal::preview::traverse(bfs::descriptor<>(0), g);
+    const auto levels = row_accessor<const std::int32_t>(result.get_levels()).pull();
+    REQUIRE(levels[0] == 0);
+    REQUIRE(levels[1] == 1);
+    REQUIRE(levels[2] == -1);
+    REQUIRE(levels[3] == 2);
+    REQUIRE_THROWS_AS(result.get_parents(), uninitialized_optional_result);
+}
+
+TEST_M(breadth_first_search_test, "one source on random undirected graphs", "[bfs]") {
+    // The dense graph makes the traversal switch to the bottom-up steps
+    const std::int64_t edge_count = GENERATE(3000, 60000);
+    const auto g = create_graph<undirected_graph_t>(3000, generate_edges(3000, edge_count));
+    check_one_to_all(g, 0);
+    check_one_to_all(g, 1234);
+}
+
+TEST_M(breadth_first_search_test, "one source on random directed graphs", "[bfs]") {
+    const std::int64_t edge_count = GENERATE(6000, 120000);
+    const auto g = create_graph<directed_graph_t>(3000, generate_edges(3000, edge_count));
+    check_one_to_all(g, 0);
+    check_one_to_all(g, 2999);
+}
+
+TEST_M(breadth_first_search_test, "many sources on random graphs", "[bfs]") {
+    const std::int64_t source_count = GENERATE(1, 5, 64);
+    const std::int64_t edge_count = GENERATE(4000, 60000);
+    std::vector<std::int64_t> sources;
+    for (std::int64_t i = 0; i < source_count; ++i) {
+        sources.push_back((i * 37) % 2000);
+    }
+
+    SECTION("undirected") {
+        const auto g = create_graph<undirected_graph_t>(2000, generate_edges(2000, edge_count));
+        check_many_to_all(g, sources);
+    }
+    SECTION("directed") {
+        const auto g = create_graph<directed_graph_t>(2000, generate_edges(2000, edge_count));
+        check_many_to_all(g, sources);
+    }
+}
+
+TEST_M(breadth_first_search_test, "parents do not depend on thread count", "[bfs]") {
+    // The sparse graphs are traversed by the top-down steps, the dense ones switch
+    // to the bottom-up steps
+    const std::int64_t vertex_count = GENERATE(1024, 5000);
+    const std::int64_t degree = GENERATE(2, 40);
+    const auto edges = generate_edges(vertex_count, vertex_count * degree / 2);
+    const auto results = bfs::optional_results::levels | bfs::optional_results::parents;
+    const std::vector<std::int64_t> sources = { 0, 1, 17, vertex_count - 1 };
+
+    SECTION("undirected") {
+        const auto g = create_graph<undirected_graph_t>(vertex_count, edges);
+        check_same_as_sequential(bfs::descriptor<>(0, results), g);
+        check_same_as_sequential(
+            bfs::descriptor<float, bfs::method::by_default, bfs::task::many_to_all>(sources,
+                                                                                   results),
+            g);
+    }
+    SECTION("directed") {
+        const auto g = create_graph<directed_graph_t>(vertex_count, edges);
+        check_same_as_sequential(bfs::descriptor<>(0, results), g);
+        check_same_as_sequential(
+            bfs::descriptor<float, bfs::method::by_default, bfs::task::many_to_all>(sources,
+                                                                                   results),
+            g);
+    }
+}
+
+TEST_M(breadth_first_search_test, "throws if sources are invalid", "[bfs][badarg]") {
+    using many_to_all_desc_t =
+        bfs::descriptor<float, bfs::method::by_default, bfs::task::many_to_all>;
+    const auto g = create_graph<undirected_graph_t>(3, { { 0, 1 } });
+
+    REQUIRE_THROWS_AS(dal::preview::traverse(bfs::descriptor<>(-1), g), invalid_argument);
+    REQUIRE_THROWS_AS(dal::preview::traverse(bfs::descriptor<>(3), g), invalid_argument);
+    REQUIRE_THROWS_AS(dal::preview::traverse(many_to_all_desc_t({}), g), invalid_argument);
+    REQUIRE_THROWS_AS(dal::preview::traverse(many_to_all_desc_t({ 0, 5 }), g),
+                      invalid_argument);
+    REQUIRE_THROWS_AS(
+        dal::preview::traverse(many_to_all_desc_t(std::vector<std::int64_t>(65, 0)), g),
+        invalid_argument);
+    REQUIRE_THROWS_AS(dal::preview::traverse(bfs::descriptor<>(0, bfs::optional_result_id{}), g),
+                      invalid_argument);
+}
+
+} // namespace oneapi::dal::algo::breadth_first_search::test
@@ -0,0 +1,225 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <random>
+
+#include "oneapi/dal/algo/connected_components/common.hpp"
+#include "oneapi/dal/algo/connected_components/vertex_partitioning_types.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/container.hpp"
+
+namespace oneapi::dal::preview::connected_components::backend {
+using namespace oneapi::dal::preview::detail;
+using namespace oneapi::dal::preview::backend;
+
+using vertex_type = std::int32_t;
+using edge_type = std::int64_t;
+
+/// The number of the first neighbors of each vertex linked before the largest
+/// intermediate component is sampled
+constexpr std::int64_t neighbor_rounds = 2;
+
+/// The number of the vertices sampled to find the largest intermediate component
+constexpr std::int64_t sample_count = 1024;
+
+/// The minimal number of the consecutive vertices processed by a task
+constexpr std::int32_t vertex_block_size = 4096;
+
+/// Calls the body for the ranges of the consecutive vertices that cover the graph,
+/// so the adjacency of each range is read from a contiguous piece of the CSR arrays
+template <typename Body>
+inline void for_each_vertex_range(std::int64_t vertex_count, Body&& body) {
+    dal::detail::threader_for_blocked(dal::detail::integral_cast<std::int32_t>(vertex_count),
+                                      0,
+                                      vertex_block_size,
+                                      [&](std::int32_t begin, std::int32_t end) {
+                                          for (vertex_type v = begin; v < end; ++v) {
+                                              body(v);
+                                          }
+                                      });
+}
+
+/// Joins the trees of the vertices u and v in the union-find forest without locks.
+/// The root with the larger index is hooked under the other one, so the parent of
+/// each vertex never exceeds it and every tree is rooted at its smallest vertex
+inline void link(vertex_type u, vertex_type v, vertex_type* comp) {
+    vertex_type p1 = dal::detail::atomic_load_relaxed(comp[u]);
+    vertex_type p2 = dal::detail::atomic_load_relaxed(comp[v]);
+    while (p1 != p2) {
+        const vertex_type high = std::max(p1, p2);
+        const vertex_type low = std::min(p1, p2);
+        vertex_type p_high = dal::detail::atomic_load_relaxed(comp[high]);
+        if (p_high == low) {
+            break;
+        }
+        if (p_high == high && dal::detail::atomic_compare_exchange(comp[high], p_high, low)) {
+            break;
+        }
+        p1 = dal::detail::atomic_load_relaxed(comp[dal::detail::atomic_load_relaxed(comp[high])]);
+        p2 = dal::detail::atomic_load_relaxed(comp[low]);
+    }
+}
+
+/// Points every vertex directly to the root of its tree
+inline void compress(vertex_type* comp, std::int64_t vertex_count) {
+    for_each_vertex_range(vertex_count, [&](vertex_type v) {
+        vertex_type parent = dal::detail::atomic_load_relaxed(comp[v]);
+        vertex_type grandparent = dal::detail::atomic_load_relaxed(comp[parent]);
+        while (parent != grandparent) {
+            dal::detail::atomic_store_relaxed(comp[v], grandparent);
+            parent = grandparent;
+            grandparent = dal::detail::atomic_load_relaxed(comp[parent]);
+        }
+    });
+}
+
+/// Returns the most frequent root among the roots of the randomly sampled vertices.
+/// It is the root of the giant component with high probability
+inline vertex_type sample_frequent_root(const vertex_type* comp, std::int64_t vertex_count) {
+    std::minstd_rand engine(777);
+    std::uniform_int_distribution<std::int64_t> distribution(0, vertex_count - 1);
+    vertex_type samples[sample_count];
+    for (std::int64_t i = 0; i < sample_count; ++i) {
+        samples[i] = comp[distribution(engine)];
+    }
+    std::sort(samples, samples + sample_count);
+
+    vertex_type frequent_root = samples[0];
+    std::int64_t max_run = 0;
+    for (std::int64_t begin = 0, end = 0; begin < sample_count; begin = end) {
+        while (end < sample_count && samples[end] == samples[begin]) {
+            ++end;
+        }
+        if (end - begin > max_run) {
+            max_run = end - begin;
+            frequent_root = samples[begin];
+        }
+    }
+    return frequent_root;
+}
+
+/// Numbers the trees from zero in the order of their roots and writes the number of
+/// the tree of each vertex to the labels. Returns the number of the trees
+inline std::int64_t relabel(const vertex_type* comp,
+                            vertex_type* labels,
+                            std::int64_t vertex_count,
+                            byte_alloc_iface* alloc_ptr) {
+    inner_alloc<std::int64_t> offset_allocator(alloc_ptr);
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t block_count = std::min<std::int64_t>(vertex_count, 4 * thread_count);
+    const std::int64_t block_size = (vertex_count + block_count - 1) / block_count;
+    std::int64_t* offsets = allocate(offset_allocator, block_count + 1);
+
+    offsets[0] = 0;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t end = std::min(vertex_count, (b + 1) * block_size);
+        std::int64_t root_count = 0;
+        for (std::int64_t v = b * block_size; v < end; ++v) {
+            root_count += (comp[v] == v);
+        }
+        offsets[b + 1] = root_count;
+    });
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        offsets[b + 1] += offsets[b];
+    }
+    const std::int64_t component_count = offsets[block_count];
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t end = std::min(vertex_count, (b + 1) * block_size);
+        std::int64_t label = offsets[b];
+        for (std::int64_t v = b * block_size; v < end; ++v) {
+            if (comp[v] == v) {
+                labels[v] = static_cast<vertex_type>(label++);
+            }
+        }
+    });
+    for_each_vertex_range(vertex_count, [&](vertex_type v) {
+        labels[v] = labels[comp[v]];
+    });
+
+    deallocate(offset_allocator, offsets, block_count + 1);
+    return component_count;
+}
+
+template <typename Cpu, typename Task>
+struct afforest;
+
+/// Afforest connected components. The first neighbors of every vertex are linked
+/// to build the intermediate components, then the largest one is found by sampling,
+/// and the rest of the edges are linked skipping the vertices already in it
+template <typename Cpu>
+struct afforest<Cpu, task::vertex_partitioning> {
+    vertex_partitioning_result<task::vertex_partitioning> operator()(
+        const detail::descriptor_base<task::vertex_partitioning>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        byte_alloc_iface* alloc_ptr) {
+        using vertex_allocator_type = inner_alloc<vertex_type>;
+
+        const std::int64_t vertex_count = t.get_vertex_count();
+        vertex_partitioning_result<task::vertex_partitioning> result;
+        if (vertex_count == 0) {
+            return result;
+        }
+        const edge_type* rows = t._rows_ptr;
+        const vertex_type* cols = t._cols_ptr;
+
+        vertex_allocator_type vertex_allocator(alloc_ptr);
+        vertex_type* comp = allocate(vertex_allocator, vertex_count);
+        for_each_vertex_range(vertex_count, [&](vertex_type v) {
+            comp[v] = v;
+        });
+
+        for (std::int64_t round = 0; round < neighbor_rounds; ++round) {
+            for_each_vertex_range(vertex_count, [&](vertex_type u) {
+                if (rows[u] + round < rows[u + 1]) {
+                    link(u, cols[rows[u] + round], comp);
+                }
+            });
+            compress(comp, vertex_count);
+        }
+
+        // Each edge is stored in both directions, so the edges between the largest
+        // component and the others are linked from the vertices outside of it
+        const vertex_type frequent_root = sample_frequent_root(comp, vertex_count);
+        for_each_vertex_range(vertex_count, [&](vertex_type u) {
+            if (dal::detail::atomic_load_relaxed(comp[u]) == frequent_root) {
+                return;
+            }
+            for (edge_type e = rows[u] + neighbor_rounds; e < rows[u + 1]; ++e) {
+                link(u, cols[e], comp);
+            }
+        });
+        compress(comp, vertex_count);
+
+        auto labels_arr = array<vertex_type>::empty(vertex_count);
+        const std::int64_t component_count =
+            relabel(comp, labels_arr.get_mutable_data(), vertex_count, alloc_ptr);
+        deallocate(vertex_allocator, comp, vertex_count);
+
+        return result
+            .set_labels(
+                dal::detail::homogen_table_builder{}.reset(labels_arr, vertex_count, 1).build())
+            .set_component_count(component_count);
+    }
+};
+
+} // namespace oneapi::dal::preview::connected_components::backend
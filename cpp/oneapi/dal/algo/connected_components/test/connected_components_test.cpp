@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+#include "oneapi/dal/algo/connected_components/vertex_partitioning.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+
+namespace oneapi::dal::algo::connected_components::test {
+
+namespace cc = dal::preview::connected_components;
+namespace te = dal::test::engine;
+
+using graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+
+class connected_components_test {
+public:
+    graph_t create_graph(std::int64_t vertex_count, const te::edge_list_t &edges) {
+        adjacency_ = te::make_adjacency(vertex_count, edges, false);
+        return builder_.build<graph_t>(adjacency_);
+    }
+
+    te::edge_list_t generate_edges(std::int64_t vertex_count, std::int64_t edge_count) {
+        return te::generate_edges(vertex_count, edge_count);
+    }
+
+    /// Labels the components by the breadth first search started from the smallest
+    /// unlabeled vertex, so they are numbered in the order of their smallest vertices
+    std::vector<std::int32_t> compute_reference_labels() const {
+        const std::int64_t vertex_count = adjacency_.size();
+        std::vector<std::int32_t> labels(vertex_count, -1);
+        std::int32_t component_count = 0;
+        for (std::int32_t s = 0; s < vertex_count; ++s) {
+            if (labels[s] >= 0) {
+                continue;
+            }
+            std::queue<std::int32_t> queue;
+            labels[s] = component_count;
+            queue.push(s);
+            while (!queue.empty()) {
+                const std::int32_t u = queue.front();
+                queue.pop();
+                for (const std::int32_t v : adjacency_[u]) {
+                    if (labels[v] < 0) {
+                        labels[v] = component_count;
+                        queue.push(v);
+                    }
+                }
+            }
+            ++component_count;
+        }
+        return labels;
+    }
+
+    void check(const graph_t &g) {
+        const auto result = dal::preview::vertex_partitioning(cc::descriptor<>(), g);
+        const auto reference = compute_reference_labels();
+        const std::int64_t vertex_count = reference.size();
+        const std::int64_t component_count =
+            vertex_count > 0 ? *std::max_element(reference.begin(), reference.end()) + 1 : 0;
+
+        REQUIRE(result.get_component_count() == component_count);
+        if (vertex_count == 0) {
+            return;
+        }
+        REQUIRE(result.get_labels().get_row_count() == vertex_count);
+        REQUIRE(result.get_labels().get_column_count() == 1);
+        const auto labels = row_accessor<const std::int32_t>(result.get_labels()).pull();
+        for (std::int64_t v = 0; v < vertex_count; ++v) {
+            REQUIRE(labels[v] == reference[v]);
+        }
+    }
+
+private:
+    te::graph_builder builder_;
+    te::adjacency_t adjacency_;
+};
+
+TEST_M(connected_components_test, "Connected components of small graphs", "[cc]") {
+    SECTION("graph without edges") {
+        check(create_graph(5, {}));
+    }
+    SECTION("path") {
+        check(create_graph(6, { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 4 }, { 4, 5 } }));
+    }
+    SECTION("components linked through the larger vertices") {
+        check(create_graph(8, { { 0, 7 }, { 1, 6 }, { 6, 5 }, { 5, 7 }, { 2, 4 }, { 3, 4 } }));
+    }
+    SECTION("star and isolated vertices") {
+        check(create_graph(7, { { 3, 0 }, { 3, 1 }, { 3, 2 }, { 3, 5 } }));
+    }
+    SECTION("two cliques") {
+        te::edge_list_t edges;
+        for (std::int32_t u = 0; u < 5; ++u) {
+            for (std::int32_t v = u + 1; v < 5; ++v) {
+                edges.emplace_back(2 * u, 2 * v);
+                edges.emplace_back(2 * u + 1, 2 * v + 1);
+            }
+        }
+        check(create_graph(10, edges));
+    }
+}
+
+TEST_M(connected_components_test, "Connected components of random graphs", "[cc]") {
+    const std::int64_t vertex_count = GENERATE(100, 10000, 100000);
+    const std::int64_t degree = GENERATE(0, 1, 2, 8);
+    check(create_graph(vertex_count, generate_edges(vertex_count, vertex_count * degree / 2)));
+}
+
+TEST_M(connected_components_test, "Connected components of the empty graph", "[cc]") {
+    check(graph_t{});
+}
+
+} // namespace oneapi::dal::algo::connected_components::test
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/connected_components/vertex_partitioning.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+
+namespace oneapi::dal::algo::connected_components::test {
+
+namespace cc = dal::preview::connected_components;
+namespace te = dal::test::engine;
+
+using graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+
+class connected_components_perf_test {
+public:
+    /// Generates the graph with the giant component and a tail of small ones: the
+    /// edges join random vertices of the first half, the rest of the vertices are
+    /// joined into the pairs
+    graph_t create_graph(std::int64_t vertex_count, std::int64_t average_degree) {
+        std::mt19937 generator(7777);
+        const std::int64_t giant_size = vertex_count / 2;
+        std::uniform_int_distribution<std::int32_t> vertex(0, giant_size - 1);
+        te::edge_list_t edges;
+        for (std::int64_t i = 0; i < giant_size * average_degree / 2; ++i) {
+            const std::int32_t u = vertex(generator);
+            const std::int32_t v = vertex(generator);
+            if (u != v) {
+                edges.emplace_back(u, v);
+            }
+        }
+        for (std::int64_t u = giant_size; u + 1 < vertex_count; u += 2) {
+            edges.emplace_back(u, u + 1);
+        }
+        return builder_.build<graph_t>(te::make_adjacency(vertex_count, edges, false));
+    }
+
+    /// The baseline: every vertex takes the minimal label of its neighbors until
+    /// the labels stop changing, the number of the passes is about the diameter
+    std::int64_t label_propagation(std::int64_t vertex_count) {
+        labels_.resize(vertex_count);
+        for (std::int64_t v = 0; v < vertex_count; ++v) {
+            labels_[v] = v;
+        }
+        const auto &rows = builder_.get_rows();
+        const auto &cols = builder_.get_cols();
+        std::int32_t changed = 1;
+        while (changed) {
+            changed = 0;
+            dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+                std::int32_t label = dal::detail::atomic_load_relaxed(labels_[u]);
+                for (std::int64_t e = rows[u]; e < rows[u + 1]; ++e) {
+                    label = std::min(label, dal::detail::atomic_load_relaxed(labels_[cols[e]]));
+                }
+                if (dal::detail::atomic_min(labels_[u], label)) {
+                    dal::detail::atomic_store_relaxed(changed, std::int32_t(1));
+                }
+            });
+        }
+        std::int64_t component_count = 0;
+        for (std::int64_t v = 0; v < vertex_count; ++v) {
+            component_count += (labels_[v] == v);
+        }
+        return component_count;
+    }
+
+private:
+    te::graph_builder builder_;
+    std::vector<std::int32_t> labels_;
+};
+
+TEST_M(connected_components_perf_test,
+       "benchmark for connected components",
+       "[cc][perf]") {
+    const std::int64_t vertex_count = GENERATE(1 << 16, 1 << 20, 1 << 22);
+    const std::int64_t average_degree = GENERATE(4, 16);
+    const auto g = create_graph(vertex_count, average_degree);
+    const auto desc = cc::descriptor<>();
+
+    const auto result = dal::preview::vertex_partitioning(desc, g);
+    REQUIRE(result.get_component_count() == label_propagation(vertex_count));
+
+    const auto graph_name =
+        fmt::format("vertex_count {}, average_degree {}", vertex_count, average_degree);
+    BENCHMARK(fmt::format("Afforest: {}", graph_name).c_str()) {
+        return dal::preview::vertex_partitioning(desc, g);
+    };
+    BENCHMARK(fmt::format("Label propagation: {}", graph_name).c_str()) {
+        return label_propagation(vertex_count);
+    };
+}
+
+} // namespace oneapi::dal::algo::connected_components::test
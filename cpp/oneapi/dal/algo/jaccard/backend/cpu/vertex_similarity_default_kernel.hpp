@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/common.hpp"
 #include "oneapi/dal/algo/jaccard/vertex_similarity_types.hpp"
@@ -26,32 +29,32 @@
 #include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 
 namespace oneapi::dal::preview::jaccard::backend {
 
-template <typename Cpu>
+template <typename Cpu, typename IndexType>
 vertex_similarity_result<task::all_vertex_pairs> jaccard(
     const detail::descriptor_base<task::all_vertex_pairs> &desc,
-    const dal::preview::detail::topology<int32_t> &t,
+    const dal::preview::detail::topology<IndexType> &t,
     void *result_ptr) {
-    const auto row_begin = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_begin());
-    const auto row_end = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_end());
-    const auto column_begin =
-        dal::detail::integral_cast<std::int32_t>(desc.get_column_range_begin());
-    const auto column_end = dal::detail::integral_cast<std::int32_t>(desc.get_column_range_end());
+    const auto row_begin = dal::detail::integral_cast<IndexType>(desc.get_row_range_begin());
+    const auto row_end = dal::detail::integral_cast<IndexType>(desc.get_row_range_end());
+    const auto column_begin = dal::detail::integral_cast<IndexType>(desc.get_column_range_begin());
+    const auto column_end = dal::detail::integral_cast<IndexType>(desc.get_column_range_end());
     const auto number_elements_in_block =
         detail::compute_number_elements_in_block(row_begin, row_end, column_begin, column_end);
-    int *first_vertices = reinterpret_cast<int *>(result_ptr);
-    int *second_vertices = first_vertices + number_elements_in_block;
+    IndexType *first_vertices = reinterpret_cast<IndexType *>(result_ptr);
+    IndexType *second_vertices = first_vertices + number_elements_in_block;
     float *jaccard = reinterpret_cast<float *>(second_vertices + number_elements_in_block);
     std::int64_t nnz = 0;
-    for (std::int32_t i = row_begin; i < row_end; ++i) {
-        const std::int32_t i_neighbor_size = t.get_vertex_degree(i);
+    for (IndexType i = row_begin; i < row_end; ++i) {
+        const IndexType i_neighbor_size = t.get_vertex_degree(i);
         const auto i_neigbhors = t.get_vertex_neighbors_begin(i);
         const auto diagonal = detail::min(i, column_end);
-        for (std::int32_t j = column_begin; j < diagonal; j++) {
-            const std::int32_t j_neighbor_size = t.get_vertex_degree(j);
+        for (IndexType j = column_begin; j < diagonal; j++) {
+            const IndexType j_neighbor_size = t.get_vertex_degree(j);
             const auto j_neigbhors = t.get_vertex_neighbors_begin(j);
             if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
                 !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
@@ -79,8 +82,9 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard(
             ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
         }
 
-        for (std::int32_t j = detail::max(column_begin, diagonal + 1); j < column_end; j++) {
-            const std::int32_t j_neighbor_size = t.get_vertex_degree(j);
+        for (IndexType j = detail::max<IndexType>(column_begin, diagonal + 1); j < column_end;
+             j++) {
+            const IndexType j_neighbor_size = t.get_vertex_degree(j);
             const auto j_neigbhors = t.get_vertex_neighbors_begin(j);
             if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
                 !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
@@ -107,10 +111,198 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard(
     return res;
 }
 
+/// The number of the consecutive row vertices processed by one task of the two_hop method
+constexpr std::int64_t two_hop_row_block_size = 256;
+
+/// The pair of the row vertex with the column vertex is preferable to the other one
+/// if it has the greater coefficient or the same coefficient and the lesser column vertex
+template <typename IndexType>
+inline bool is_preferable_pair(const std::pair<float, IndexType> &a,
+                               const std::pair<float, IndexType> &b) {
+    return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+/// Per-thread buffers of the two_hop method
+template <typename IndexType>
+struct two_hop_thread_buffers {
+    /// The columns reachable from the row vertex by two hops, a column is repeated
+    /// once per common neighbor
+    std::vector<IndexType> candidates;
+    /// The bounded heap of the top-k pairs of the row vertex, the least preferable
+    /// pair is on the top
+    std::vector<std::pair<float, IndexType>> heap;
+
+    std::vector<IndexType> first_vertices;
+    std::vector<IndexType> second_vertices;
+    std::vector<float> coeffs;
+
+    void push_pair(IndexType u, IndexType v, float coeff) {
+        first_vertices.push_back(u);
+        second_vertices.push_back(v);
+        coeffs.push_back(coeff);
+    }
+};
+
+/// Computes the coefficients of the row vertex u with the columns of [column_begin,
+/// column_end) that have common neighbors with u and appends them to the buffers
+template <typename Cpu, typename IndexType>
+inline void jaccard_two_hop_row(const dal::preview::detail::topology<IndexType> &t,
+                                IndexType u,
+                                IndexType column_begin,
+                                IndexType column_end,
+                                std::int64_t top_k,
+                                two_hop_thread_buffers<IndexType> &buffers) {
+    if (column_begin <= u && u < column_end) {
+        buffers.push_pair(u, u, 1.0);
+    }
+
+    auto &candidates = buffers.candidates;
+    candidates.clear();
+    for (auto w_ = t.get_vertex_neighbors_begin(u); w_ != t.get_vertex_neighbors_end(u); ++w_) {
+        const auto w_neighbors_end = t.get_vertex_neighbors_end(*w_);
+        // The neighbors are sorted, so the columns of the block are contiguous
+        for (auto v_ = std::lower_bound(t.get_vertex_neighbors_begin(*w_),
+                                        w_neighbors_end,
+                                        column_begin);
+             v_ != w_neighbors_end && *v_ < column_end;
+             ++v_) {
+            if (*v_ != u) {
+                candidates.push_back(*v_);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    auto &heap = buffers.heap;
+    heap.clear();
+    const auto u_degree = t.get_vertex_degree(u);
+    const std::int64_t candidate_count = candidates.size();
+    for (std::int64_t i = 0; i < candidate_count;) {
+        const IndexType v = candidates[i];
+        std::int64_t intersection_value = 0;
+        for (; i < candidate_count && candidates[i] == v; ++i) {
+            ++intersection_value;
+        }
+        const float coeff =
+            float(intersection_value) /
+            float(u_degree + t.get_vertex_degree(v) - intersection_value);
+        if (top_k == 0) {
+            buffers.push_pair(u, v, coeff);
+            continue;
+        }
+        const auto pair = std::make_pair(coeff, v);
+        if (static_cast<std::int64_t>(heap.size()) < top_k) {
+            heap.push_back(pair);
+            std::push_heap(heap.begin(), heap.end(), is_preferable_pair<IndexType>);
+        }
+        else if (is_preferable_pair(pair, heap[0])) {
+            std::pop_heap(heap.begin(), heap.end(), is_preferable_pair<IndexType>);
+            heap.back() = pair;
+            std::push_heap(heap.begin(), heap.end(), is_preferable_pair<IndexType>);
+        }
+    }
+
+    // The top-k pairs are written from the most similar column
+    std::sort_heap(heap.begin(), heap.end(), is_preferable_pair<IndexType>);
+    for (const auto &[coeff, v] : heap) {
+        buffers.push_pair(u, v, coeff);
+    }
+}
+
+/// Computes the Jaccard coefficients of the vertex pairs of the block that have common
+/// neighbors. Unlike the fast method the work and the output are proportional to the
+/// number of the two-hop paths starting in the rows of the block, not to the block size.
+///
+/// The rows are split into the blocks processed in parallel. Each block appends its
+/// pairs to the buffers of the thread that processes it, then the pairs of the blocks
+/// are copied to the result in the order of the rows.
+template <typename Cpu, typename IndexType>
+vertex_similarity_result<task::all_vertex_pairs> jaccard_two_hop(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<IndexType> &t,
+    caching_builder &result_builder) {
+    const auto row_begin = dal::detail::integral_cast<IndexType>(desc.get_row_range_begin());
+    const auto row_end = dal::detail::integral_cast<IndexType>(desc.get_row_range_end());
+    const auto column_begin = dal::detail::integral_cast<IndexType>(desc.get_column_range_begin());
+    const auto column_end = dal::detail::integral_cast<IndexType>(desc.get_column_range_end());
+    const std::int64_t top_k = desc.get_top_k();
+
+    const std::int64_t row_count = row_end - row_begin;
+    if (row_count == 0 || column_end == column_begin) {
+        return vertex_similarity_result<task::all_vertex_pairs>();
+    }
+    const std::int64_t block_count =
+        (row_count + two_hop_row_block_size - 1) / two_hop_row_block_size;
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+
+    std::vector<two_hop_thread_buffers<IndexType>> buffers(thread_count);
+    // The thread processed the block and the range of the block pairs in its buffers
+    std::vector<std::int64_t> block_threads(block_count);
+    std::vector<std::int64_t> block_offsets(block_count);
+    std::vector<std::int64_t> block_sizes(block_count);
+
+    dal::detail::threader_for_int64(block_count, [&](std::int64_t b) {
+        const int thread = dal::detail::threader_get_current_thread_index();
+        ONEDAL_ASSERT(thread < thread_count);
+        auto &thread_buffers = buffers[thread];
+        const std::int64_t offset = thread_buffers.coeffs.size();
+
+        const IndexType block_begin = row_begin + b * two_hop_row_block_size;
+        const IndexType block_end =
+            std::min<std::int64_t>(block_begin + two_hop_row_block_size, row_end);
+        for (IndexType u = block_begin; u < block_end; ++u) {
+            jaccard_two_hop_row<Cpu>(t, u, column_begin, column_end, top_k, thread_buffers);
+        }
+
+        block_threads[b] = thread;
+        block_offsets[b] = offset;
+        block_sizes[b] = thread_buffers.coeffs.size() - offset;
+    });
+
+    // Positions of the block pairs in the result
+    std::vector<std::int64_t> result_offsets(block_count + 1);
+    result_offsets[0] = 0;
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        result_offsets[b + 1] = result_offsets[b] + block_sizes[b];
+    }
+    const std::int64_t nnz = result_offsets[block_count];
+    if (nnz == 0) {
+        return vertex_similarity_result<task::all_vertex_pairs>();
+    }
+
+    void *result_ptr =
+        result_builder(detail::compute_max_block_size<float, IndexType>(nnz));
+    IndexType *first_vertices = reinterpret_cast<IndexType *>(result_ptr);
+    IndexType *second_vertices = first_vertices + nnz;
+    float *jaccard = reinterpret_cast<float *>(second_vertices + nnz);
+
+    dal::detail::threader_for_int64(block_count, [&](std::int64_t b) {
+        const auto &thread_buffers = buffers[block_threads[b]];
+        const std::int64_t begin = block_offsets[b];
+        const std::int64_t end = begin + block_sizes[b];
+        const std::int64_t result_offset = result_offsets[b];
+        std::copy(thread_buffers.first_vertices.begin() + begin,
+                  thread_buffers.first_vertices.begin() + end,
+                  first_vertices + result_offset);
+        std::copy(thread_buffers.second_vertices.begin() + begin,
+                  thread_buffers.second_vertices.begin() + end,
+                  second_vertices + result_offset);
+        std::copy(thread_buffers.coeffs.begin() + begin,
+                  thread_buffers.coeffs.begin() + end,
+                  jaccard + result_offset);
+    });
+
+    return vertex_similarity_result(
+        homogen_table::wrap(first_vertices, nnz, 2, data_layout::column_major),
+        homogen_table::wrap(jaccard, nnz, 1, data_layout::column_major),
+        nnz);
+}
+
 template <>
-vertex_similarity_result<task::all_vertex_pairs> jaccard<dal::backend::cpu_dispatch_avx512>(
+vertex_similarity_result<task::all_vertex_pairs>
+jaccard<dal::backend::cpu_dispatch_avx512, std::int32_t>(
     const detail::descriptor_base<task::all_vertex_pairs> &desc,
-    const dal::preview::detail::topology<int32_t> &t,
+    const dal::preview::detail::topology<std::int32_t> &t,
     void *result_ptr);
 
 } // namespace oneapi::dal::preview::jaccard::backend
@@ -25,9 +25,24 @@
 
 namespace oneapi::dal::preview::jaccard::backend {
 
-template vertex_similarity_result<task::all_vertex_pairs> jaccard<__CPU_TAG__>(
+template vertex_similarity_result<task::all_vertex_pairs> jaccard<__CPU_TAG__, std::int32_t>(
     const detail::descriptor_base<task::all_vertex_pairs> &desc,
     const dal::preview::detail::topology<std::int32_t> &t,
     void *result_ptr);
 
+template vertex_similarity_result<task::all_vertex_pairs> jaccard<__CPU_TAG__, std::int64_t>(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<std::int64_t> &t,
+    void *result_ptr);
+
+template vertex_similarity_result<task::all_vertex_pairs> jaccard_two_hop<__CPU_TAG__, std::int32_t>(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<std::int32_t> &t,
+    caching_builder &result_builder);
+
+template vertex_similarity_result<task::all_vertex_pairs> jaccard_two_hop<__CPU_TAG__, std::int64_t>(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<std::int64_t> &t,
+    caching_builder &result_builder);
+
 } // namespace oneapi::dal::preview::jaccard::backend
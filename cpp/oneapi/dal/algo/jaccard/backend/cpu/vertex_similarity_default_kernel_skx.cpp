@@ -33,9 +33,10 @@ template vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512<
                                        void* result_ptr);
 
 template <>
-vertex_similarity_result<task::all_vertex_pairs> jaccard<dal::backend::cpu_dispatch_avx512>(
+vertex_similarity_result<task::all_vertex_pairs>
+jaccard<dal::backend::cpu_dispatch_avx512, std::int32_t>(
     const detail::descriptor_base<task::all_vertex_pairs>& desc,
-    const dal::preview::detail::topology<int32_t>& t,
+    const dal::preview::detail::topology<std::int32_t>& t,
     void* result_ptr) {
     return jaccard_avx512<dal::backend::cpu_dispatch_avx512>(desc, t, result_ptr);
 }
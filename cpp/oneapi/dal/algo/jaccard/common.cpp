@@ -26,6 +26,7 @@ public:
     std::int64_t row_range_end = 0;
     std::int64_t column_range_begin = 0;
     std::int64_t column_range_end = 0;
+    std::int64_t top_k = 0;
 };
 
 template <typename Task>
@@ -51,6 +52,11 @@ std::int64_t descriptor_base<Task>::get_column_range_end() const {
     return impl_->column_range_end;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_top_k() const {
+    return impl_->top_k;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_row_range_impl(std::int64_t begin, std::int64_t end) {
     impl_->row_range_begin = begin;
@@ -73,6 +79,11 @@ void descriptor_base<Task>::set_block_impl(
     impl_->column_range_end = *(column_range.begin() + 1);
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_top_k_impl(std::int64_t top_k) {
+    impl_->top_k = top_k;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::all_vertex_pairs>;
 } // namespace detail
 
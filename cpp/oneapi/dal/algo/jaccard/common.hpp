@@ -27,7 +27,11 @@ using by_default = all_vertex_pairs;
 } // namespace task
 
 namespace method {
+/// Computes the coefficients for all vertex pairs of the block
 struct fast {};
+/// Computes the coefficients only for the pairs of the block with a common neighbor,
+/// which are found by enumerating the two-hop paths from each row vertex in parallel
+struct two_hop {};
 using by_default = fast;
 } // namespace method
 
@@ -38,7 +42,7 @@ template <typename Task>
 class descriptor_impl;
 
 template <typename Method>
-constexpr bool is_valid_method = dal::detail::is_one_of_v<Method, method::fast>;
+constexpr bool is_valid_method = dal::detail::is_one_of_v<Method, method::fast, method::two_hop>;
 
 template <typename Task>
 constexpr bool is_valid_task = dal::detail::is_one_of_v<Task, task::all_vertex_pairs>;
@@ -60,12 +64,14 @@ public:
     auto get_row_range_end() const -> std::int64_t;
     auto get_column_range_begin() const -> std::int64_t;
     auto get_column_range_end() const -> std::int64_t;
+    auto get_top_k() const -> std::int64_t;
 
 protected:
     void set_row_range_impl(std::int64_t begin, std::int64_t end);
     void set_column_range_impl(std::int64_t begin, std::int64_t end);
     void set_block_impl(const std::initializer_list<std::int64_t>& row_range,
                         const std::initializer_list<std::int64_t>& column_range);
+    void set_top_k_impl(std::int64_t top_k);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -113,6 +119,11 @@ public:
         return base_t::get_column_range_end();
     }
 
+    /// Returns the maximal number of the most similar vertices kept for each row vertex
+    std::int64_t get_top_k() const {
+        return base_t::get_top_k();
+    }
+
     /// Sets the range of the rows of the graph block for Jaccard similarity computation
     ///
     /// @param [in] begin  The begin of the row of the graph block
@@ -141,6 +152,17 @@ public:
         base_t::set_block_impl(row_range, column_range);
         return *this;
     }
+
+    /// Sets the maximal number of the most similar vertices kept for each row vertex.
+    /// Supported by the two_hop method only, the other methods accept zero only.
+    /// Zero means that all the pairs are kept.
+    /// The pair of the row vertex with itself is not counted.
+    ///
+    /// @param [in] top_k  The maximal number of the pairs per row vertex
+    auto& set_top_k(std::int64_t top_k) {
+        base_t::set_top_k_impl(top_k);
+        return *this;
+    }
 };
 
 /// Structure for the caching builder
@@ -20,11 +20,13 @@
 
 namespace oneapi::dal::preview::jaccard::detail {
 
-ONEDAL_FORCEINLINE std::int32_t min(const std::int32_t &a, const std::int32_t &b) {
+template <typename Index>
+ONEDAL_FORCEINLINE Index min(const Index &a, const Index &b) {
     return (a >= b) ? b : a;
 }
 
-ONEDAL_FORCEINLINE std::int32_t max(const std::int32_t &a, const std::int32_t &b) {
+template <typename Index>
+ONEDAL_FORCEINLINE Index max(const Index &a, const Index &b) {
     return (a <= b) ? b : a;
 }
 
@@ -21,19 +21,46 @@
 
 namespace oneapi::dal::preview::jaccard::detail {
 
-template <typename Float>
+template <typename Float, typename IndexType>
 vertex_similarity_result<task::all_vertex_pairs>
-vertex_similarity<Float, task::all_vertex_pairs, dal::preview::detail::topology<std::int32_t>>::
+vertex_similarity<Float, task::all_vertex_pairs, dal::preview::detail::topology<IndexType>>::
 operator()(const dal::detail::host_policy& ctx,
            const detail::descriptor_base<task::all_vertex_pairs>& desc,
-           const dal::preview::detail::topology<std::int32_t>& t,
+           const dal::preview::detail::topology<IndexType>& t,
            void* result_ptr) {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ ctx }, [&](auto cpu) {
-        return backend::jaccard<decltype(cpu)>(desc, t, result_ptr);
+        return backend::jaccard<decltype(cpu), IndexType>(desc, t, result_ptr);
+    });
+}
+
+template <typename Float, typename IndexType>
+vertex_similarity_result<task::all_vertex_pairs> vertex_similarity<
+    Float,
+    task::all_vertex_pairs,
+    dal::preview::detail::topology<IndexType>,
+    method::two_hop>::operator()(const dal::detail::host_policy& ctx,
+                                 const detail::descriptor_base<task::all_vertex_pairs>& desc,
+                                 const dal::preview::detail::topology<IndexType>& t,
+                                 caching_builder& result_builder) {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ ctx }, [&](auto cpu) {
+        return backend::jaccard_two_hop<decltype(cpu), IndexType>(desc, t, result_builder);
     });
 }
 
 template struct ONEDAL_EXPORT
     vertex_similarity<float, task::all_vertex_pairs, dal::preview::detail::topology<std::int32_t>>;
 
+template struct ONEDAL_EXPORT
+    vertex_similarity<float, task::all_vertex_pairs, dal::preview::detail::topology<std::int64_t>>;
+
+template struct ONEDAL_EXPORT vertex_similarity<float,
+                                                task::all_vertex_pairs,
+                                                dal::preview::detail::topology<std::int32_t>,
+                                                method::two_hop>;
+
+template struct ONEDAL_EXPORT vertex_similarity<float,
+                                                task::all_vertex_pairs,
+                                                dal::preview::detail::topology<std::int64_t>,
+                                                method::two_hop>;
+
 } // namespace oneapi::dal::preview::jaccard::detail
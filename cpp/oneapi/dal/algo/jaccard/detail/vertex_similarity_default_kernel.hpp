@@ -31,15 +31,25 @@ struct vertex_similarity {
                                               void* result_ptr);
 };
 
-template <typename Float>
+template <typename Float, typename IndexType>
+struct vertex_similarity<Float, task::all_vertex_pairs, dal::preview::detail::topology<IndexType>> {
+    vertex_similarity_result<task::all_vertex_pairs> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::all_vertex_pairs>& desc,
+        const dal::preview::detail::topology<IndexType>& t,
+        void* result_ptr);
+};
+
+template <typename Float, typename IndexType>
 struct vertex_similarity<Float,
                          task::all_vertex_pairs,
-                         dal::preview::detail::topology<std::int32_t>> {
+                         dal::preview::detail::topology<IndexType>,
+                         method::two_hop> {
     vertex_similarity_result<task::all_vertex_pairs> operator()(
         const dal::detail::host_policy& ctx,
         const detail::descriptor_base<task::all_vertex_pairs>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t,
-        void* result_ptr);
+        const dal::preview::detail::topology<IndexType>& t,
+        caching_builder& result_builder);
 };
 
 template <typename Float, typename Method, typename Task, typename Topology>
@@ -68,11 +78,24 @@ struct vertex_similarity_kernel_cpu<float, method::fast, task::all_vertex_pairs,
         }
         const std::int64_t max_block_size = compute_max_block_size<
             typename detail::descriptor_base<task::all_vertex_pairs>::float_t,
-            std::int32_t>(number_elements_in_block);
+            typename Topology::vertex_type>(number_elements_in_block);
         void* result_ptr = result_builder(max_block_size);
         using kernel_t = vertex_similarity<float, task::all_vertex_pairs, Topology>;
         return kernel_t()(ctx, desc, t, result_ptr);
     }
 };
 
+template <typename Topology>
+struct vertex_similarity_kernel_cpu<float, method::two_hop, task::all_vertex_pairs, Topology> {
+    vertex_similarity_result<task::all_vertex_pairs> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::all_vertex_pairs>& desc,
+        const Topology& t,
+        caching_builder& result_builder) const {
+        using kernel_t =
+            vertex_similarity<float, task::all_vertex_pairs, Topology, method::two_hop>;
+        return kernel_t()(ctx, desc, t, result_builder);
+    }
+};
+
 } // namespace oneapi::dal::preview::jaccard::detail
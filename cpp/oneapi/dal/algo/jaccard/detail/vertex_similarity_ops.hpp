@@ -72,10 +72,17 @@ struct vertex_similarity_ops {
         if (row_end > vertex_count || column_end > vertex_count) {
             throw out_of_range(msg::interval_gt_vertex_count());
         }
-        if (row_end >= dal::detail::limits<std::int32_t>::max() ||
-            column_end >= dal::detail::limits<std::int32_t>::max()) {
+        using vertex_t = vertex_type<Graph>;
+        if (row_end >= dal::detail::limits<vertex_t>::max() ||
+            column_end >= dal::detail::limits<vertex_t>::max()) {
             throw invalid_argument(msg::range_idx_gt_max_int32());
         }
+        if (param.get_top_k() < 0) {
+            throw invalid_argument(msg::top_k_lt_zero());
+        }
+        if (param.get_top_k() != 0 && std::is_same_v<method_t, method::fast>) {
+            throw invalid_argument(msg::top_k_is_not_supported_by_method());
+        }
     }
 
     template <typename Policy>
@@ -106,4 +106,24 @@ JACCARD_BADARG_TEST("throws if block ranges is greater than vertex count") {
     REQUIRE_THROWS_AS(this->check_vertex_similarity(0, 8, 0, 8), out_of_range);
 }
 
+JACCARD_BADARG_TEST("throws if top_k is negative") {
+    const auto jaccard_desc =
+        dal::preview::jaccard::descriptor<float, dal::preview::jaccard::method::two_hop>()
+            .set_block({ 0, 2 }, { 0, 3 })
+            .set_top_k(-1);
+    const auto g = create_graph();
+    dal::preview::jaccard::caching_builder builder;
+    REQUIRE_THROWS_AS(oneapi::dal::preview::vertex_similarity(jaccard_desc, g, builder),
+                      invalid_argument);
+}
+
+JACCARD_BADARG_TEST("throws if top_k is set for the fast method") {
+    const auto jaccard_desc =
+        dal::preview::jaccard::descriptor<>().set_block({ 0, 2 }, { 0, 3 }).set_top_k(1);
+    const auto g = create_graph();
+    dal::preview::jaccard::caching_builder builder;
+    REQUIRE_THROWS_AS(oneapi::dal::preview::vertex_similarity(jaccard_desc, g, builder),
+                      invalid_argument);
+}
+
 } // namespace oneapi::dal::algo::jaccard::test
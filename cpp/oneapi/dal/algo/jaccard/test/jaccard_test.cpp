@@ -14,15 +14,27 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <tuple>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 
 #include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/loader.hpp"
 
 namespace oneapi::dal::algo::jaccard::test {
 
+namespace te = dal::test::engine;
+
+template <typename IndexType>
+using graph_t = dal::preview::undirected_adjacency_vector_graph<dal::preview::empty_value,
+                                                                dal::preview::empty_value,
+                                                                dal::preview::empty_value,
+                                                                IndexType>;
+
 class graph_base_data {
 public:
     graph_base_data() = default;
@@ -135,6 +147,19 @@ public:
                                           24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34 };
 };
 
+class path_with_triangle_graph_type : public graph_base_data {
+public:
+    path_with_triangle_graph_type() {
+        vertex_count = 5;
+        edge_count = 5;
+        cols_count = edge_count * 2;
+        rows_count = vertex_count + 1;
+    }
+    std::array<std::int32_t, 5> degrees = { 2, 2, 3, 2, 1 };
+    std::array<std::int32_t, 10> cols = { 1, 2, 0, 2, 0, 1, 3, 2, 4, 3 };
+    std::array<std::int64_t, 6> rows = { 0, 2, 4, 7, 9, 10 };
+};
+
 class jaccard_test {
 public:
     template <typename GraphType>
@@ -217,6 +242,46 @@ public:
         REQUIRE(correct_coeff_count == nonzero_coeff_count);
     }
 
+    template <typename GraphType, typename VertexPairsDataType, typename JaccardCoeffsDataType>
+    void check_jaccard_two_hop(
+        const dal::preview::jaccard::descriptor<float, dal::preview::jaccard::method::two_hop>
+            &desc,
+        std::int64_t correct_nonzero_coeff_count,
+        const VertexPairsDataType &correct_vertex_pairs,
+        const JaccardCoeffsDataType &correct_jaccard_coeffs) {
+        const auto g = create_graph<GraphType>();
+        dal::preview::jaccard::caching_builder builder;
+        const auto result_vertex_similarity = dal::preview::vertex_similarity(desc, g, builder);
+
+        UNSCOPED_INFO("The number of non-zero jaccard coefficients was determined incorrectly");
+        const std::int64_t nonzero_coeff_count = result_vertex_similarity.get_nonzero_coeff_count();
+        REQUIRE(nonzero_coeff_count == correct_nonzero_coeff_count);
+
+        UNSCOPED_INFO("Pairs of vertices with non-zero jaccard coefficient were found wrong");
+        auto vertex_pairs_table = result_vertex_similarity.get_vertex_pairs();
+        homogen_table &vertex_pairs = static_cast<homogen_table &>(vertex_pairs_table);
+        const auto vertex_pairs_data = vertex_pairs.get_data<int>();
+        std::int64_t correct_pair_count = 0;
+        for (std::int64_t i = 0; i < nonzero_coeff_count; i++) {
+            if (vertex_pairs_data[i] == correct_vertex_pairs[i] &&
+                vertex_pairs_data[i + nonzero_coeff_count] ==
+                    correct_vertex_pairs[i + nonzero_coeff_count])
+                correct_pair_count++;
+        }
+        REQUIRE(correct_pair_count == nonzero_coeff_count);
+
+        UNSCOPED_INFO("Jaccard coefficients are not correct");
+        auto coeffs_table = result_vertex_similarity.get_coeffs();
+        homogen_table &coeffs = static_cast<homogen_table &>(coeffs_table);
+        const auto jaccard_coeffs_data = coeffs.get_data<float>();
+        int correct_coeff_count = 0;
+        for (std::int64_t i = 0; i < nonzero_coeff_count; i++) {
+            if (Approx(jaccard_coeffs_data[i]) == correct_jaccard_coeffs[i])
+                correct_coeff_count++;
+        }
+        REQUIRE(correct_coeff_count == nonzero_coeff_count);
+    }
+
     template <typename Graph, typename Task>
     void check_jaccard_zero_coeffs_only(
         const oneapi::dal::preview::jaccard::detail::descriptor_base<Task> &desc,
@@ -228,6 +293,124 @@ public:
         const std::int64_t nonzero_coeff_count = result_vertex_similarity.get_nonzero_coeff_count();
         REQUIRE(nonzero_coeff_count == 0);
     }
+
+    /// Generates the random edges and the cycle through all the vertices, so none of
+    /// the vertices is isolated
+    te::edge_list_t generate_edges(std::int32_t vertex_count, std::int64_t edge_count) {
+        auto edges = te::generate_edges(vertex_count, edge_count);
+        for (std::int32_t v = 0; v < vertex_count; v++) {
+            edges.emplace_back(v, (v + 1) % vertex_count);
+        }
+        return edges;
+    }
+
+    /// Checks the two_hop method against the pairs found by the fast method. The
+    /// pair of the row vertex with itself goes first, the other pairs of the row
+    /// follow in the order of the columns or, for top-k, from the most similar one
+    void check_two_hop_against_fast(const graph_t<std::int32_t> &g,
+                                    const std::initializer_list<std::int64_t> &row_range,
+                                    const std::initializer_list<std::int64_t> &column_range,
+                                    std::int64_t top_k) {
+        dal::preview::jaccard::caching_builder fast_builder;
+        const auto fast_result = dal::preview::vertex_similarity(
+            dal::preview::jaccard::descriptor<>().set_block(row_range, column_range),
+            g,
+            fast_builder);
+        const auto fast_pairs_table = fast_result.get_vertex_pairs();
+        const auto fast_pairs =
+            static_cast<const homogen_table &>(fast_pairs_table).get_data<std::int32_t>();
+        const auto fast_coeffs =
+            static_cast<const homogen_table &>(fast_result.get_coeffs()).get_data<float>();
+        const std::int64_t fast_row_count = fast_pairs_table.get_row_count();
+
+        const std::int64_t row_begin = *row_range.begin();
+        const std::int64_t row_count = *(row_range.begin() + 1) - row_begin;
+        std::vector<bool> has_diagonal(row_count, false);
+        std::vector<std::vector<std::pair<float, std::int32_t>>> row_pairs(row_count);
+        for (std::int64_t i = 0; i < fast_result.get_nonzero_coeff_count(); i++) {
+            const std::int32_t u = fast_pairs[i];
+            const std::int32_t v = fast_pairs[i + fast_row_count];
+            if (u == v) {
+                has_diagonal[u - row_begin] = true;
+            }
+            else {
+                row_pairs[u - row_begin].emplace_back(fast_coeffs[i], v);
+            }
+        }
+
+        std::vector<std::tuple<std::int32_t, std::int32_t, float>> expected;
+        for (std::int64_t r = 0; r < row_count; r++) {
+            const std::int32_t u = row_begin + r;
+            if (has_diagonal[r]) {
+                expected.emplace_back(u, u, 1.0f);
+            }
+            auto &pairs = row_pairs[r];
+            if (top_k > 0) {
+                std::sort(pairs.begin(), pairs.end(), [](const auto &a, const auto &b) {
+                    return a.first > b.first || (a.first == b.first && a.second < b.second);
+                });
+                pairs.resize(std::min<std::int64_t>(pairs.size(), top_k));
+            }
+            for (const auto &[coeff, v] : pairs) {
+                expected.emplace_back(u, v, coeff);
+            }
+        }
+
+        dal::preview::jaccard::caching_builder builder;
+        const auto result = dal::preview::vertex_similarity(
+            dal::preview::jaccard::descriptor<float, dal::preview::jaccard::method::two_hop>()
+                .set_block(row_range, column_range)
+                .set_top_k(top_k),
+            g,
+            builder);
+        const std::int64_t nonzero_coeff_count = result.get_nonzero_coeff_count();
+        REQUIRE(nonzero_coeff_count == std::int64_t(expected.size()));
+        const auto pairs =
+            static_cast<const homogen_table &>(result.get_vertex_pairs()).get_data<std::int32_t>();
+        const auto coeffs =
+            static_cast<const homogen_table &>(result.get_coeffs()).get_data<float>();
+        for (std::int64_t i = 0; i < nonzero_coeff_count; i++) {
+            const auto &[u, v, coeff] = expected[i];
+            REQUIRE(pairs[i] == u);
+            REQUIRE(pairs[i + nonzero_coeff_count] == v);
+            REQUIRE(coeffs[i] == coeff);
+        }
+    }
+
+    /// Checks that the graphs with the 32-bit and the 64-bit vertex indices have the
+    /// same pairs of vertices and coefficients
+    template <typename Task>
+    void check_same_similarity(
+        const oneapi::dal::preview::jaccard::detail::descriptor_base<Task> &desc,
+        const graph_t<std::int32_t> &g,
+        const graph_t<std::int64_t> &g_64) {
+        dal::preview::jaccard::caching_builder builder;
+        dal::preview::jaccard::caching_builder builder_64;
+        const auto result = dal::preview::vertex_similarity(desc, g, builder);
+        const auto result_64 = dal::preview::vertex_similarity(desc, g_64, builder_64);
+
+        const std::int64_t nonzero_coeff_count = result.get_nonzero_coeff_count();
+        REQUIRE(nonzero_coeff_count > 0);
+        REQUIRE(result_64.get_nonzero_coeff_count() == nonzero_coeff_count);
+
+        const auto pairs_table = result.get_vertex_pairs();
+        const auto pairs_64_table = result_64.get_vertex_pairs();
+        const auto pairs =
+            static_cast<const homogen_table &>(pairs_table).get_data<std::int32_t>();
+        const auto pairs_64 =
+            static_cast<const homogen_table &>(pairs_64_table).get_data<std::int64_t>();
+        const auto coeffs =
+            static_cast<const homogen_table &>(result.get_coeffs()).get_data<float>();
+        const auto coeffs_64 =
+            static_cast<const homogen_table &>(result_64.get_coeffs()).get_data<float>();
+        const std::int64_t row_count = pairs_table.get_row_count();
+        const std::int64_t row_count_64 = pairs_64_table.get_row_count();
+        for (std::int64_t i = 0; i < nonzero_coeff_count; i++) {
+            REQUIRE(pairs_64[i] == pairs[i]);
+            REQUIRE(pairs_64[i + row_count_64] == pairs[i + row_count]);
+            REQUIRE(coeffs_64[i] == coeffs[i]);
+        }
+    }
 };
 
 TEST_M(jaccard_test,
@@ -420,6 +603,80 @@ TEST_M(jaccard_test, "Zero jaccard coeffs graph, row of 32 elements, right of th
     this->check_jaccard_zero_coeffs_only<>(jaccard_desc, g);
 }
 
+TEST_M(jaccard_test, "Two-hop method, all vertex pairs of the graph") {
+    const auto jaccard_desc =
+        dal::preview::jaccard::descriptor<float, dal::preview::jaccard::method::two_hop>()
+            .set_block({ 0, 5 }, { 0, 5 });
+    std::array<std::int64_t, 34> vertex_pairs = { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                                  3, 3, 3, 4, 4, 0, 1, 2, 3, 1, 0, 2,
+                                                  3, 2, 0, 1, 4, 3, 0, 1, 4, 2 };
+    std::array<float, 17> jaccard_coeffs = { 1.0,  0.33333, 0.25,    0.33333, 1.0,     0.33333,
+                                             0.25, 0.33333, 1.0,     0.25,    0.25,    0.33333,
+                                             1.0,  0.33333, 0.33333, 1.0,     0.33333 };
+    this->check_jaccard_two_hop<path_with_triangle_graph_type>(jaccard_desc,
+                                                               17,
+                                                               vertex_pairs,
+                                                               jaccard_coeffs);
+}
+
+TEST_M(jaccard_test, "Two-hop method, top-1 pairs of the block right of the diagonal") {
+    const auto jaccard_desc =
+        dal::preview::jaccard::descriptor<float, dal::preview::jaccard::method::two_hop>()
+            .set_block({ 0, 5 }, { 2, 5 })
+            .set_top_k(1);
+    std::array<std::int64_t, 14> vertex_pairs = { 0, 1, 2, 2, 3, 4, 4, 3, 3, 2, 4, 3, 4, 2 };
+    std::array<float, 7> jaccard_coeffs = { 0.33333, 0.33333, 1.0, 0.33333, 1.0, 1.0, 0.33333 };
+    this->check_jaccard_two_hop<path_with_triangle_graph_type>(jaccard_desc,
+                                                               7,
+                                                               vertex_pairs,
+                                                               jaccard_coeffs);
+}
+
+TEST_M(jaccard_test, "Two-hop method, complete graph, top-3 pairs of the row") {
+    const auto jaccard_desc =
+        dal::preview::jaccard::descriptor<float, dal::preview::jaccard::method::two_hop>()
+            .set_block({ 32, 33 }, { 0, 33 })
+            .set_top_k(3);
+    std::array<std::int64_t, 8> vertex_pairs = { 32, 32, 32, 32, 32, 0, 1, 2 };
+    std::array<float, 4> jaccard_coeffs = { 1.0, 0.93939, 0.93939, 0.93939 };
+    this->check_jaccard_two_hop<complete_graph_33_type>(jaccard_desc,
+                                                        4,
+                                                        vertex_pairs,
+                                                        jaccard_coeffs);
+}
+
+TEST_M(jaccard_test, "Two-hop method, many row blocks are the same as the fast method") {
+    // The two_hop method processes the rows by the blocks of 256 vertices in parallel
+    const std::int32_t vertex_count = 700;
+    const te::edge_list_file file{ "jaccard_test.csv", generate_edges(vertex_count, 7000) };
+    const auto g = file.load<graph_t<std::int32_t>>();
+    const std::int64_t top_k = GENERATE(0, 1, 5);
+
+    this->check_two_hop_against_fast(g, { 0, vertex_count }, { 0, vertex_count }, top_k);
+    this->check_two_hop_against_fast(g, { 100, 650 }, { 150, 400 }, top_k);
+}
+
+TEST_M(jaccard_test, "Graph with 64-bit vertex indices loaded from the edge list") {
+    const std::int32_t vertex_count = 300;
+    const te::edge_list_file file{ "jaccard_test.csv", generate_edges(vertex_count, 3000) };
+    const auto g = file.load<graph_t<std::int32_t>>();
+    const auto g_64 = file.load<graph_t<std::int64_t>>();
+
+    SECTION("fast method") {
+        const auto jaccard_desc = dal::preview::jaccard::descriptor<>().set_block(
+            { 0, vertex_count },
+            { 0, vertex_count });
+        this->check_same_similarity(jaccard_desc, g, g_64);
+    }
+    SECTION("two-hop method") {
+        auto jaccard_desc =
+            dal::preview::jaccard::descriptor<float, dal::preview::jaccard::method::two_hop>()
+                .set_block({ 0, vertex_count }, { 0, vertex_count });
+        this->check_same_similarity(jaccard_desc, g, g_64);
+        this->check_same_similarity(jaccard_desc.set_top_k(5), g, g_64);
+    }
+}
+
 TEST_M(jaccard_test, "Null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     auto jaccard_desc = dal::preview::jaccard::descriptor<>().set_block({ 0, 0 }, { 0, 0 });
@@ -0,0 +1,417 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+template <typename Float>
+struct elkan_result {
+    Float objective_function_value;
+    std::int64_t iteration_count;
+};
+
+template <typename Float>
+inline Float squared_distance(const Float* x, const Float* y, std::int64_t column_count) {
+    Float sum = 0;
+    for (std::int64_t i = 0; i < column_count; ++i) {
+        const Float diff = x[i] - y[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+/// The partition of the centroids into the groups that share the lower bounds of
+/// the distances. The centroids of the g-th group are :expr:`members[offsets[g]]`
+/// to :expr:`members[offsets[g + 1] - 1]` in the increasing order
+struct centroid_groups {
+    std::vector<std::int64_t> offsets;
+    std::vector<std::int32_t> members;
+    std::vector<std::int32_t> group_of;
+
+    std::int64_t get_count() const {
+        return std::int64_t(offsets.size()) - 1;
+    }
+};
+
+/// Partitions the centroids into about one group per ten centroids by a few
+/// Lloyd's iterations over the centroids, so the centroids of a group are close
+/// to each other and its lower bound is not dragged down by the far ones
+template <typename Float>
+centroid_groups group_centroids(const Float* centroids,
+                                std::int64_t cluster_count,
+                                std::int64_t column_count) {
+    constexpr std::int64_t centroids_per_group = 10;
+    constexpr std::int64_t iteration_count = 5;
+    const std::int64_t group_count =
+        (cluster_count + centroids_per_group - 1) / centroids_per_group;
+
+    std::vector<Float> means(group_count * column_count);
+    for (std::int64_t g = 0; g < group_count; ++g) {
+        const Float* first = centroids + (g * cluster_count / group_count) * column_count;
+        std::copy(first, first + column_count, means.data() + g * column_count);
+    }
+
+    centroid_groups groups;
+    groups.group_of.resize(cluster_count);
+    std::vector<double> sums(group_count * column_count);
+    std::vector<std::int64_t> counts(group_count);
+    for (std::int64_t it = 0; it < iteration_count; ++it) {
+        for (std::int64_t j = 0; j < cluster_count; ++j) {
+            const Float* centroid = centroids + j * column_count;
+            Float best = dal::detail::limits<Float>::max();
+            for (std::int64_t g = 0; g < group_count; ++g) {
+                const Float distance =
+                    squared_distance(centroid, means.data() + g * column_count, column_count);
+                if (distance < best) {
+                    best = distance;
+                    groups.group_of[j] = g;
+                }
+            }
+        }
+
+        std::fill(sums.begin(), sums.end(), 0.0);
+        std::fill(counts.begin(), counts.end(), 0);
+        for (std::int64_t j = 0; j < cluster_count; ++j) {
+            const std::int64_t g = groups.group_of[j];
+            ++counts[g];
+            for (std::int64_t s = 0; s < column_count; ++s) {
+                sums[g * column_count + s] += centroids[j * column_count + s];
+            }
+        }
+        for (std::int64_t g = 0; g < group_count; ++g) {
+            for (std::int64_t s = 0; s < column_count && counts[g] > 0; ++s) {
+                means[g * column_count + s] = Float(sums[g * column_count + s] / counts[g]);
+            }
+        }
+    }
+
+    groups.offsets.assign(group_count + 1, 0);
+    for (std::int64_t j = 0; j < cluster_count; ++j) {
+        ++groups.offsets[groups.group_of[j] + 1];
+    }
+    std::partial_sum(groups.offsets.begin(), groups.offsets.end(), groups.offsets.begin());
+    std::vector<std::int64_t> cursor(groups.offsets.begin(), groups.offsets.end() - 1);
+    groups.members.resize(cluster_count);
+    for (std::int64_t j = 0; j < cluster_count; ++j) {
+        groups.members[cursor[groups.group_of[j]]++] = j;
+    }
+    return groups;
+}
+
+/// Runs the Lloyd's iterations with the distance computations pruned by the
+/// triangle inequality. Every row keeps the distance to its centroid and, for
+/// each group of centroids, the lower bound of the distances to the centroids of
+/// the group other than the assigned one. After the update, the lower bounds are
+/// loosened by the largest drift of the centroids of the group. The groups which
+/// lower bounds are not less than the distance to the nearest centroid found so
+/// far are skipped, and so are the centroids of the scanned groups which
+/// distances cannot be less than it given their own drift. With one group this
+/// is the Hamerly's method, with one centroid per group it is the Elkan's one.
+///
+/// The iterations reproduce the Lloyd's method of DAAL: the ties are resolved in
+/// favor of the lowest centroid index, the empty clusters are relocated to the
+/// rows farthest from their centroids, the objective function drops the
+/// distances of the relocated rows and is compared with the previous one against
+/// :literal:`accuracy_threshold`. On return, :literal:`centroids` hold the final
+/// centroids and :literal:`responses` hold the assignments of the rows to them.
+template <typename Cpu, typename Float>
+elkan_result<Float> train_elkan(const Float* data,
+                                std::int64_t row_count,
+                                std::int64_t column_count,
+                                std::int64_t cluster_count,
+                                std::int64_t max_iteration_count,
+                                double accuracy_threshold,
+                                Float* centroids,
+                                std::int32_t* responses) {
+    ONEDAL_ASSERT(cluster_count > 0);
+    ONEDAL_ASSERT(cluster_count <= row_count);
+    ONEDAL_ASSERT(row_count <= dal::detail::limits<std::int32_t>::max());
+
+    constexpr std::int64_t block_size = 512;
+    constexpr Float max_value = dal::detail::limits<Float>::max();
+    const std::int64_t block_count = (row_count + block_size - 1) / block_size;
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t centroid_element_count =
+        dal::detail::check_mul_overflow(cluster_count, column_count);
+
+    const auto groups = group_centroids(centroids, cluster_count, column_count);
+    const std::int64_t group_count = groups.get_count();
+
+    std::vector<Float> lower(dal::detail::check_mul_overflow(row_count, group_count));
+    std::vector<Float> closest_distances(row_count);
+    std::vector<double> block_objective(block_count);
+
+    std::vector<Float> next_centroids(centroid_element_count);
+    std::vector<Float> drift(cluster_count, Float(0));
+    std::vector<Float> group_drift(group_count, Float(0));
+    std::vector<Float> half_gap(cluster_count, Float(0));
+    std::vector<std::int64_t> member_offsets(cluster_count + 1);
+    std::vector<std::int32_t> members(row_count);
+    std::vector<std::vector<double>> sums(thread_count);
+
+    struct group_scan {
+        Float first;
+        Float second;
+        std::int32_t first_index;
+        bool is_scanned;
+    };
+    std::vector<std::vector<group_scan>> scans(thread_count);
+
+    // Searches the nearest centroid of the row starting from the assigned one at
+    // the given squared distance and updates the lower bounds of the groups. The
+    // bound of a scanned group is the minimum over its centroids but the nearest
+    // one of their distances, or of their own bounds for the centroids skipped
+    const auto search = [&](std::int64_t i,
+                            std::int32_t assigned,
+                            Float assigned_distance,
+                            std::vector<group_scan>& group_scans) {
+        const Float* row = data + i * column_count;
+        Float* bounds = lower.data() + i * group_count;
+        const Float assigned_bound = std::sqrt(assigned_distance);
+
+        Float best = assigned_distance;
+        Float best_bound = assigned_bound;
+        std::int32_t best_index = assigned;
+
+        for (std::int64_t g = 0; g < group_count; ++g) {
+            auto& scan = group_scans[g];
+            scan.is_scanned = bounds[g] < best_bound;
+            if (!scan.is_scanned) {
+                continue;
+            }
+            scan.first = max_value;
+            scan.second = max_value;
+            scan.first_index = -1;
+
+            // The bound of the group before loosening is the bound of each of its
+            // centroids before the update, so the centroid cannot be nearer than
+            // that value less its own drift
+            const Float previous_bound = bounds[g] + group_drift[g];
+            for (std::int64_t m = groups.offsets[g]; m < groups.offsets[g + 1]; ++m) {
+                const std::int32_t j = groups.members[m];
+                Float value;
+                if (j == assigned) {
+                    value = assigned_bound;
+                }
+                else if (previous_bound - drift[j] >= best_bound) {
+                    value = previous_bound - drift[j];
+                }
+                else {
+                    const Float distance =
+                        squared_distance(row, centroids + j * column_count, column_count);
+                    value = std::sqrt(distance);
+                    if (distance < best || (distance == best && j < best_index)) {
+                        best = distance;
+                        best_bound = value;
+                        best_index = j;
+                    }
+                }
+                if (value < scan.first) {
+                    scan.second = scan.first;
+                    scan.first = value;
+                    scan.first_index = j;
+                }
+                else if (value < scan.second) {
+                    scan.second = value;
+                }
+            }
+        }
+
+        for (std::int64_t g = 0; g < group_count; ++g) {
+            const auto& scan = group_scans[g];
+            if (scan.is_scanned) {
+                bounds[g] = (scan.first_index == best_index) ? scan.second : scan.first;
+            }
+            else if (assigned >= 0 && best_index != assigned && g == groups.group_of[assigned]) {
+                bounds[g] = std::min(bounds[g], assigned_bound);
+            }
+        }
+
+        responses[i] = best_index;
+        return best;
+    };
+
+    // Assigns the rows to the nearest centroids and returns the objective
+    // function. The distance to the assigned centroid is always evaluated to keep
+    // the objective function exact. On the first pass, there is no assigned
+    // centroid yet, so all the groups are scanned
+    const auto assign = [&](bool is_first) {
+        dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+            const std::int64_t first = block * block_size;
+            const std::int64_t last = std::min(first + block_size, row_count);
+            auto& group_scans = scans[dal::detail::threader_get_current_thread_index()];
+            group_scans.resize(group_count);
+
+            double objective = 0;
+            for (std::int64_t i = first; i < last; ++i) {
+                Float distance;
+                if (is_first) {
+                    std::fill_n(lower.data() + i * group_count,
+                                group_count,
+                                -max_value);
+                    distance = search(i, -1, max_value, group_scans);
+                }
+                else {
+                    const std::int32_t assigned = responses[i];
+                    const Float* bounds = lower.data() + i * group_count;
+                    distance = squared_distance(data + i * column_count,
+                                                centroids + assigned * column_count,
+                                                column_count);
+                    const Float bound = std::max(half_gap[assigned],
+                                                 *std::min_element(bounds, bounds + group_count));
+                    if (std::sqrt(distance) > bound) {
+                        distance = search(i, assigned, distance, group_scans);
+                    }
+                }
+                closest_distances[i] = distance;
+                objective += distance;
+            }
+            block_objective[block] = objective;
+        });
+        return std::accumulate(block_objective.begin(), block_objective.end(), 0.0);
+    };
+
+    // Computes the means of the clusters, relocates the empty clusters, moves the
+    // centroids and loosens the bounds by the drift. Returns the sum of the
+    // squared distances of the rows the empty clusters are relocated to
+    const auto update = [&]() {
+        // The rows are grouped by the clusters to sum the clusters in parallel in
+        // the order that does not depend on the number of threads
+        std::fill(member_offsets.begin(), member_offsets.end(), 0);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            ++member_offsets[responses[i] + 1];
+        }
+        std::partial_sum(member_offsets.begin(), member_offsets.end(), member_offsets.begin());
+        std::vector<std::int64_t> cursor(member_offsets.begin(), member_offsets.end() - 1);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            members[cursor[responses[i]]++] = i;
+        }
+
+        dal::detail::threader_for(cluster_count, cluster_count, [&](std::int32_t j) {
+            const std::int64_t member_count = member_offsets[j + 1] - member_offsets[j];
+            if (member_count == 0) {
+                return;
+            }
+            auto& sum = sums[dal::detail::threader_get_current_thread_index()];
+            sum.assign(column_count, 0.0);
+            for (std::int64_t m = member_offsets[j]; m < member_offsets[j + 1]; ++m) {
+                const Float* row = data + members[m] * column_count;
+                for (std::int64_t s = 0; s < column_count; ++s) {
+                    sum[s] += row[s];
+                }
+            }
+            const double coeff = 1.0 / double(member_count);
+            for (std::int64_t s = 0; s < column_count; ++s) {
+                next_centroids[j * column_count + s] = Float(sum[s] * coeff);
+            }
+        });
+
+        std::vector<std::int64_t> empty_clusters;
+        for (std::int64_t j = 0; j < cluster_count; ++j) {
+            if (member_offsets[j + 1] == member_offsets[j]) {
+                empty_clusters.push_back(j);
+            }
+        }
+
+        // The empty clusters are relocated to the rows farthest from their
+        // centroids in the order of the decreasing distance
+        double relocated_objective = 0;
+        if (!empty_clusters.empty()) {
+            const std::int64_t empty_count = empty_clusters.size();
+            std::vector<std::int32_t> candidates(row_count);
+            std::iota(candidates.begin(), candidates.end(), std::int32_t(0));
+            std::partial_sort(candidates.begin(),
+                              candidates.begin() + empty_count,
+                              candidates.end(),
+                              [&](std::int32_t a, std::int32_t b) {
+                                  return closest_distances[a] > closest_distances[b] ||
+                                         (closest_distances[a] == closest_distances[b] && a < b);
+                              });
+            for (std::int64_t e = 0; e < empty_count; ++e) {
+                const std::int32_t candidate = candidates[e];
+                std::copy(data + candidate * column_count,
+                          data + (candidate + 1) * column_count,
+                          next_centroids.data() + empty_clusters[e] * column_count);
+                relocated_objective += closest_distances[candidate];
+            }
+        }
+
+        std::fill(group_drift.begin(), group_drift.end(), Float(0));
+        for (std::int64_t j = 0; j < cluster_count; ++j) {
+            drift[j] = std::sqrt(squared_distance(centroids + j * column_count,
+                                                  next_centroids.data() + j * column_count,
+                                                  column_count));
+            auto& max_drift = group_drift[groups.group_of[j]];
+            max_drift = std::max(max_drift, drift[j]);
+        }
+        std::copy(next_centroids.begin(), next_centroids.end(), centroids);
+
+        dal::detail::threader_for(cluster_count, cluster_count, [&](std::int32_t j) {
+            Float gap = max_value;
+            for (std::int64_t t = 0; t < cluster_count; ++t) {
+                if (t != j) {
+                    gap = std::min(gap,
+                                   squared_distance(centroids + j * column_count,
+                                                    centroids + t * column_count,
+                                                    column_count));
+                }
+            }
+            half_gap[j] = Float(0.5) * std::sqrt(gap);
+        });
+
+        dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+            const std::int64_t first = block * block_size;
+            const std::int64_t last = std::min(first + block_size, row_count);
+            for (std::int64_t i = first; i < last; ++i) {
+                Float* bounds = lower.data() + i * group_count;
+                for (std::int64_t g = 0; g < group_count; ++g) {
+                    bounds[g] -= group_drift[g];
+                }
+            }
+        });
+
+        return relocated_objective;
+    };
+
+    double objective = assign(true);
+    double previous_objective = 0;
+    std::int64_t iteration_count = 0;
+    while (iteration_count < max_iteration_count) {
+        const double current_objective = objective - update();
+        ++iteration_count;
+        objective = assign(false);
+        if (accuracy_threshold > 0) {
+            if (std::abs(previous_objective - current_objective) < accuracy_threshold) {
+                break;
+            }
+            previous_objective = current_objective;
+        }
+    }
+
+    return { Float(objective), iteration_count };
+}
+
+} // namespace oneapi::dal::kmeans::backend
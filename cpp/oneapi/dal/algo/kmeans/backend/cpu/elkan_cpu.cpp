@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/backend/cpu/elkan.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+template elkan_result<float> train_elkan<__CPU_TAG__, float>(const float* data,
+                                                             std::int64_t row_count,
+                                                             std::int64_t column_count,
+                                                             std::int64_t cluster_count,
+                                                             std::int64_t max_iteration_count,
+                                                             double accuracy_threshold,
+                                                             float* centroids,
+                                                             std::int32_t* responses);
+
+template elkan_result<double> train_elkan<__CPU_TAG__, double>(const double* data,
+                                                               std::int64_t row_count,
+                                                               std::int64_t column_count,
+                                                               std::int64_t cluster_count,
+                                                               std::int64_t max_iteration_count,
+                                                               double accuracy_threshold,
+                                                               double* centroids,
+                                                               std::int32_t* responses);
+
+} // namespace oneapi::dal::kmeans::backend
@@ -100,7 +100,18 @@ struct infer_kernel_cpu<Float, method::by_default, task::clustering> {
     }
 };
 
+template <typename Float>
+struct infer_kernel_cpu<Float, method::elkan_dense, task::clustering> {
+    infer_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_t& desc,
+                                              const infer_input<task::clustering>& input) const {
+        return infer<Float, task::clustering>(ctx, desc, input);
+    }
+};
+
 template struct infer_kernel_cpu<float, method::by_default, task::clustering>;
 template struct infer_kernel_cpu<double, method::by_default, task::clustering>;
+template struct infer_kernel_cpu<float, method::elkan_dense, task::clustering>;
+template struct infer_kernel_cpu<double, method::elkan_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
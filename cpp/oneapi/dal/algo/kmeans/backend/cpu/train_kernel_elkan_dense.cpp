@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/kmeans/kmeans_init_kernel.h>
+
+#include "oneapi/dal/algo/kmeans/backend/cpu/elkan.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::clustering>;
+
+namespace daal_kmeans_init = daal::algorithms::kmeans::init;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_init_plus_plus_dense_kernel_t =
+    daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
+
+/// Returns the mutable copy of the initial centroids, the centroids are computed
+/// by the same K-Means++ initialization as for the Lloyd's method if not given
+template <typename Float>
+static array<Float> get_initial_centroids(const context_cpu& ctx,
+                                          const descriptor_t& desc,
+                                          const table& data,
+                                          const table& initial_centroids) {
+    const int64_t column_count = data.get_column_count();
+    const int64_t cluster_count = desc.get_cluster_count();
+    const int64_t element_count = dal::detail::check_mul_overflow(cluster_count, column_count);
+
+    auto arr_centroids = array<Float>::empty(element_count);
+    if (!initial_centroids.has_data()) {
+        const auto daal_data = interop::convert_to_daal_table<Float>(data);
+        const auto daal_centroids =
+            interop::convert_to_daal_homogen_table(arr_centroids, cluster_count, column_count);
+        daal_kmeans_init::Parameter par(dal::detail::integral_cast<std::size_t>(cluster_count));
+
+        const size_t init_len_input = 1;
+        daal::data_management::NumericTable* init_input[init_len_input] = { daal_data.get() };
+        const size_t init_len_output = 1;
+        daal::data_management::NumericTable* init_output[init_len_output] = {
+            daal_centroids.get()
+        };
+
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
+                ctx,
+                init_len_input,
+                init_input,
+                init_len_output,
+                init_output,
+                &par,
+                *(par.engine)));
+    }
+    else {
+        const auto rows = row_accessor<const Float>{ initial_centroids }.pull();
+        std::copy(rows.get_data(),
+                  rows.get_data() + element_count,
+                  arr_centroids.get_mutable_data());
+    }
+    return arr_centroids;
+}
+
+template <typename Float>
+static train_result<task::clustering> train(const context_cpu& ctx,
+                                            const descriptor_t& desc,
+                                            const train_input<task::clustering>& input) {
+    const table& data = input.get_data();
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const int64_t cluster_count = desc.get_cluster_count();
+
+    auto arr_centroids =
+        get_initial_centroids<Float>(ctx, desc, data, input.get_initial_centroids());
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+    auto arr_responses = array<std::int32_t>::empty(row_count);
+
+    elkan_result<Float> result;
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        result = train_elkan<decltype(cpu)>(arr_data.get_data(),
+                                            row_count,
+                                            column_count,
+                                            cluster_count,
+                                            desc.get_max_iteration_count(),
+                                            desc.get_accuracy_threshold(),
+                                            arr_centroids.get_mutable_data(),
+                                            arr_responses.get_mutable_data());
+    });
+
+    return train_result<task::clustering>()
+        .set_responses(
+            dal::detail::homogen_table_builder{}.reset(arr_responses, row_count, 1).build())
+        .set_iteration_count(result.iteration_count)
+        .set_objective_function_value(static_cast<double>(result.objective_function_value))
+        .set_model(model<task::clustering>().set_centroids(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_centroids, cluster_count, column_count)
+                .build()));
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::elkan_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_t& desc,
+                                              const train_input<task::clustering>& input) const {
+        return train<Float>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::elkan_dense, task::clustering>;
+template struct train_kernel_cpu<double, method::elkan_dense, task::clustering>;
+
+} // namespace oneapi::dal::kmeans::backend
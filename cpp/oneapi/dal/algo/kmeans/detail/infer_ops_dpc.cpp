@@ -41,6 +41,8 @@ struct infer_ops_dispatcher<data_parallel_policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::by_default, task::clustering)
 INSTANTIATE(double, method::by_default, task::clustering)
+INSTANTIATE(float, method::elkan_dense, task::clustering)
+INSTANTIATE(double, method::elkan_dense, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
@@ -41,6 +41,8 @@ struct train_ops_dispatcher<data_parallel_policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::lloyd_dense, task::clustering)
 INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::elkan_dense, task::clustering)
+INSTANTIATE(double, method::elkan_dense, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
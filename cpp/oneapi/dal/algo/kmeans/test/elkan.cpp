@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/test/elkan_fixture.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+using elkan_types = COMBINE_TYPES((float, double), (kmeans::method::elkan_dense));
+
+TEMPLATE_LIST_TEST_M(kmeans_elkan_test,
+                     "elkan produces the same clustering as lloyd",
+                     "[kmeans][elkan]",
+                     elkan_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const std::int64_t cluster_count = GENERATE(1, 7, 40);
+    const std::int64_t max_iteration_count = GENERATE(0, 1, 30);
+    CAPTURE(cluster_count, max_iteration_count);
+
+    const table x = this->generate_blobs(2000, 5, 25);
+    const table c_init = this->get_first_rows(x, cluster_count);
+    this->check_same_as_lloyd(x, c_init, cluster_count, max_iteration_count, 0.0);
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_elkan_test,
+                     "elkan stops at the same iteration as lloyd",
+                     "[kmeans][elkan]",
+                     elkan_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const double accuracy_threshold = GENERATE(1e-3, 1.0);
+    CAPTURE(accuracy_threshold);
+
+    const table x = this->generate_blobs(3000, 8, 60);
+    const table c_init = this->get_first_rows(x, 100);
+    this->check_same_as_lloyd(x, c_init, 100, 100, accuracy_threshold);
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_elkan_test,
+                     "elkan uses the same initialization as lloyd",
+                     "[kmeans][elkan]",
+                     elkan_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table x = this->generate_blobs(1000, 3, 10);
+    this->check_same_as_lloyd(x, table{}, 10, 20, 0.0);
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_elkan_test,
+                     "elkan relocates empty clusters as lloyd",
+                     "[kmeans][elkan]",
+                     elkan_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = std::tuple_element_t<0, TestType>;
+    const Float data[] = { -10, -9.5, -9, -8.5, -8, -1, 1, 9, 9.5, 10 };
+    const auto x = homogen_table::wrap(data, 10, 1);
+
+    const Float initial_centroids[] = { -10, -10, -10 };
+    const auto c_init = homogen_table::wrap(initial_centroids, 3, 1);
+
+    const Float final_centroids[] = { -1.65, 10, 9.5 };
+    const auto c_final = homogen_table::wrap(final_centroids, 3, 1);
+
+    const Float responses[] = { 0, 0, 0, 0, 0, 0, 0, 2, 2, 1 };
+    const auto y = homogen_table::wrap(responses, 10, 1);
+
+    const auto desc = this->template get_descriptor<method::elkan_dense>(3, 1, 0.0);
+    const auto result = this->train(desc, x, c_init);
+    REQUIRE(result.get_iteration_count() == 1);
+    this->check_centroids(c_final, result.get_model().get_centroids());
+    this->check_responses(y, result.get_responses());
+
+    this->check_same_as_lloyd(x, c_init, 3, 1, 0.0);
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_elkan_test,
+                     "elkan training throws on gpu",
+                     "[kmeans][elkan]",
+                     elkan_types) {
+    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table x = this->generate_blobs(100, 2, 4);
+    const auto desc = this->template get_descriptor<method::elkan_dense>(4, 10, 0.0);
+    REQUIRE_THROWS_AS(this->train(desc, x), unimplemented);
+}
+
+} // namespace oneapi::dal::kmeans::test
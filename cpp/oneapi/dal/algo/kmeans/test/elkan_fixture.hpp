@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "oneapi/dal/algo/kmeans/train.hpp"
+#include "oneapi/dal/algo/kmeans/infer.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+namespace te = dal::test::engine;
+
+/// Synthetic blobs and the comparison of the Elkan's method with the Lloyd's one
+template <typename TestType>
+class kmeans_elkan_test : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+
+    bool not_available_on_device() {
+        return this->get_policy().is_gpu();
+    }
+
+    template <typename M>
+    auto get_descriptor(std::int64_t cluster_count,
+                        std::int64_t max_iteration_count,
+                        double accuracy_threshold) const {
+        return kmeans::descriptor<Float, M>{ cluster_count }
+            .set_max_iteration_count(max_iteration_count)
+            .set_accuracy_threshold(accuracy_threshold);
+    }
+
+    /// The rows scattered around :literal:`blob_count` random centers
+    table generate_blobs(std::int64_t row_count,
+                         std::int64_t column_count,
+                         std::int64_t blob_count) const {
+        std::mt19937 rng(row_count + column_count + blob_count);
+        std::normal_distribution<Float> normal;
+        std::vector<Float> centers(blob_count * column_count);
+        for (auto& value : centers) {
+            value = Float(4) * normal(rng);
+        }
+
+        auto data = array<Float>::empty(row_count * column_count);
+        Float* rows = data.get_mutable_data();
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            const std::int64_t blob = rng() % blob_count;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                rows[i * column_count + j] = centers[blob * column_count + j] + normal(rng);
+            }
+        }
+        return homogen_table::wrap(data, row_count, column_count);
+    }
+
+    table get_first_rows(const table& data, std::int64_t row_count) const {
+        const auto rows = row_accessor<const Float>(data).pull({ 0, row_count });
+        auto copy = array<Float>::empty(rows.get_count());
+        std::copy(rows.get_data(), rows.get_data() + rows.get_count(), copy.get_mutable_data());
+        return homogen_table::wrap(copy, row_count, data.get_column_count());
+    }
+
+    /// Checks that the Elkan's method reproduces the clustering of the Lloyd's one
+    void check_same_as_lloyd(const table& data,
+                             const table& initial_centroids,
+                             std::int64_t cluster_count,
+                             std::int64_t max_iteration_count,
+                             double accuracy_threshold) {
+        const auto lloyd_desc =
+            get_descriptor<method::lloyd_dense>(cluster_count,
+                                                max_iteration_count,
+                                                accuracy_threshold);
+        const auto elkan_desc =
+            get_descriptor<method::elkan_dense>(cluster_count,
+                                                max_iteration_count,
+                                                accuracy_threshold);
+
+        INFO("run training");
+        const auto lloyd_result = initial_centroids.has_data()
+                                      ? this->train(lloyd_desc, data, initial_centroids)
+                                      : this->train(lloyd_desc, data);
+        const auto elkan_result = initial_centroids.has_data()
+                                      ? this->train(elkan_desc, data, initial_centroids)
+                                      : this->train(elkan_desc, data);
+
+        REQUIRE(elkan_result.get_iteration_count() == lloyd_result.get_iteration_count());
+        check_responses(lloyd_result.get_responses(), elkan_result.get_responses());
+        check_centroids(lloyd_result.get_model().get_centroids(),
+                        elkan_result.get_model().get_centroids());
+        check_objective(lloyd_result.get_objective_function_value(),
+                        elkan_result.get_objective_function_value());
+
+        INFO("run inference");
+        const auto infer_result = this->infer(elkan_desc, elkan_result.get_model(), data);
+        check_responses(elkan_result.get_responses(), infer_result.get_responses());
+        check_objective(elkan_result.get_objective_function_value(),
+                        infer_result.get_objective_function_value());
+    }
+
+    void check_responses(const table& expected, const table& actual) {
+        REQUIRE(expected.get_row_count() == actual.get_row_count());
+        const auto expected_rows = row_accessor<const Float>(expected).pull();
+        const auto actual_rows = row_accessor<const Float>(actual).pull();
+        for (std::int64_t i = 0; i < expected_rows.get_count(); ++i) {
+            CAPTURE(i);
+            REQUIRE(expected_rows[i] == actual_rows[i]);
+        }
+    }
+
+    void check_centroids(const table& expected, const table& actual) {
+        REQUIRE(expected.get_row_count() == actual.get_row_count());
+        REQUIRE(expected.get_column_count() == actual.get_column_count());
+        const Float tol = te::get_tolerance<Float>(1e-4, 1e-9);
+        const auto expected_rows = row_accessor<const Float>(expected).pull();
+        const auto actual_rows = row_accessor<const Float>(actual).pull();
+        for (std::int64_t i = 0; i < expected_rows.get_count(); ++i) {
+            const Float e = expected_rows[i];
+            const Float a = actual_rows[i];
+            CAPTURE(i, e, a);
+            REQUIRE(std::abs(e - a) <= tol * (Float(1) + std::abs(e)));
+        }
+    }
+
+    void check_objective(double expected, double actual) {
+        const double tol = te::get_tolerance<Float>(1e-4, 1e-9);
+        CAPTURE(expected, actual);
+        REQUIRE(std::abs(expected - actual) <= tol * (1.0 + std::abs(expected)));
+    }
+};
+
+} // namespace oneapi::dal::kmeans::test
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/test/elkan_fixture.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+using elkan_perf_types = COMBINE_TYPES((float), (kmeans::method::elkan_dense));
+
+TEMPLATE_LIST_TEST_M(kmeans_elkan_test,
+                     "benchmark of elkan against lloyd",
+                     "[kmeans][elkan][perf]",
+                     elkan_perf_types) {
+    SKIP_IF(this->not_available_on_device());
+
+    constexpr std::int64_t row_count = 100000;
+    constexpr std::int64_t column_count = 32;
+    constexpr std::int64_t cluster_count = 1000;
+
+    const table x = this->generate_blobs(row_count, column_count, cluster_count);
+    const table c_init = this->get_first_rows(x, cluster_count);
+
+    for (const std::int64_t max_iteration_count : { 10, 50 }) {
+        const auto lloyd_desc =
+            this->template get_descriptor<method::lloyd_dense>(cluster_count,
+                                                               max_iteration_count,
+                                                               0.0);
+        const auto elkan_desc =
+            this->template get_descriptor<method::elkan_dense>(cluster_count,
+                                                               max_iteration_count,
+                                                               0.0);
+        BENCHMARK(fmt::format("lloyd, {} iterations", max_iteration_count).c_str()) {
+            return this->train(lloyd_desc, x, c_init);
+        };
+        BENCHMARK(fmt::format("elkan, {} iterations", max_iteration_count).c_str()) {
+            return this->train(elkan_desc, x, c_init);
+        };
+    }
+}
+
+} // namespace oneapi::dal::kmeans::test
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/backend/cpu/radius_search.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Merges the rows appended to the model after its search structure was built into
+/// the neighbors found by the search structure. The `base_indices` and
+/// `base_distances` hold `neighbor_count` neighbors of each query sorted by the
+/// Euclidean distance, the missing neighbors have negative index or distance. The
+/// appended rows are scanned by the brute force in tiles shared by all the queries
+/// of a block, the row `i` of `delta` gets the index `base_row_count + i`.
+/// The missing neighbors of the result have the index -1 and the maximal distance.
+template <typename Cpu, typename Float>
+void search_delta_rows(const Float* delta,
+                       std::int64_t delta_row_count,
+                       std::int64_t base_row_count,
+                       std::int64_t column_count,
+                       const Float* queries,
+                       std::int64_t query_count,
+                       std::int64_t neighbor_count,
+                       const std::int32_t* base_indices,
+                       const Float* base_distances,
+                       std::int64_t* indices,
+                       Float* distances) {
+    constexpr std::int64_t query_block_size = 16;
+    constexpr std::int64_t row_tile_size = 256;
+    const std::int64_t block_count = (query_count + query_block_size - 1) / query_block_size;
+    ONEDAL_ASSERT(block_count <= dal::detail::limits<std::int32_t>::max());
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * query_block_size;
+        const std::int64_t last = std::min(first + query_block_size, query_count);
+        const std::int64_t block_query_count = last - first;
+
+        // Max-heaps of the nearest neighbors of the queries by the squared distance
+        std::vector<std::vector<radius_neighbor<Float>>> heaps(block_query_count);
+        for (std::int64_t q = 0; q < block_query_count; ++q) {
+            auto& heap = heaps[q];
+            heap.reserve(neighbor_count);
+            const std::int64_t offset = (first + q) * neighbor_count;
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                const std::int64_t index = base_indices[offset + j];
+                const Float distance = base_distances[offset + j];
+                if (index >= 0 && index < base_row_count && distance >= 0) {
+                    heap.push_back({ distance * distance, index });
+                }
+            }
+            std::make_heap(heap.begin(), heap.end());
+        }
+
+        for (std::int64_t tile = 0; tile < delta_row_count; tile += row_tile_size) {
+            const std::int64_t tile_end = std::min(tile + row_tile_size, delta_row_count);
+            for (std::int64_t q = 0; q < block_query_count; ++q) {
+                const Float* query = queries + (first + q) * column_count;
+                auto& heap = heaps[q];
+                for (std::int64_t i = tile; i < tile_end; ++i) {
+                    const radius_neighbor<Float> neighbor = {
+                        squared_euclidean(query, delta + i * column_count, column_count),
+                        base_row_count + i
+                    };
+                    if (std::int64_t(heap.size()) < neighbor_count) {
+                        heap.push_back(neighbor);
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                    else if (neighbor < heap.front()) {
+                        std::pop_heap(heap.begin(), heap.end());
+                        heap.back() = neighbor;
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                }
+            }
+        }
+
+        for (std::int64_t q = 0; q < block_query_count; ++q) {
+            auto& heap = heaps[q];
+            std::sort_heap(heap.begin(), heap.end());
+
+            const std::int64_t found_count = heap.size();
+            const std::int64_t offset = (first + q) * neighbor_count;
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                const bool is_found = j < found_count;
+                indices[offset + j] = is_found ? heap[j].index : -1;
+                distances[offset + j] =
+                    is_found ? std::sqrt(heap[j].distance) : std::numeric_limits<Float>::max();
+            }
+        }
+    });
+}
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/delta_search.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+template void search_delta_rows<__CPU_TAG__, float>(const float* delta,
+                                                    std::int64_t delta_row_count,
+                                                    std::int64_t base_row_count,
+                                                    std::int64_t column_count,
+                                                    const float* queries,
+                                                    std::int64_t query_count,
+                                                    std::int64_t neighbor_count,
+                                                    const std::int32_t* base_indices,
+                                                    const float* base_distances,
+                                                    std::int64_t* indices,
+                                                    float* distances);
+
+template void search_delta_rows<__CPU_TAG__, double>(const double* delta,
+                                                     std::int64_t delta_row_count,
+                                                     std::int64_t base_row_count,
+                                                     std::int64_t column_count,
+                                                     const double* queries,
+                                                     std::int64_t query_count,
+                                                     std::int64_t neighbor_count,
+                                                     const std::int32_t* base_indices,
+                                                     const double* base_distances,
+                                                     std::int64_t* indices,
+                                                     double* distances);
+
+} // namespace oneapi::dal::knn::backend
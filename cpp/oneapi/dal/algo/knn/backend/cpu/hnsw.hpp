@@ -0,0 +1,540 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/backend/hnsw_index.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+template <typename Float>
+inline Float squared_euclidean(const Float* a, const Float* b, std::int64_t column_count) {
+    constexpr std::int64_t unroll = 8;
+    Float partial[unroll] = { 0 };
+    std::int64_t j = 0;
+    for (; j + unroll <= column_count; j += unroll) {
+        for (std::int64_t u = 0; u < unroll; ++u) {
+            const Float diff = a[j + u] - b[j + u];
+            partial[u] += diff * diff;
+        }
+    }
+    Float sum = 0;
+    for (; j < column_count; ++j) {
+        const Float diff = a[j] - b[j];
+        sum += diff * diff;
+    }
+    for (std::int64_t u = 0; u < unroll; ++u) {
+        sum += partial[u];
+    }
+    return sum;
+}
+
+/// Deterministic level of the row in the graph, the levels are distributed
+/// geometrically with the ratio 1 / max_degree
+inline std::int32_t get_hnsw_level(std::int64_t row, std::int64_t max_degree) {
+    constexpr std::int32_t level_limit = 16;
+    std::uint64_t z = static_cast<std::uint64_t>(row) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z = z ^ (z >> 31);
+    const double uniform = (static_cast<double>(z >> 11) + 1.0) / 9007199254740993.0;
+    const double level = -std::log(uniform) / std::log(static_cast<double>(max_degree));
+    return std::min(static_cast<std::int32_t>(level), level_limit);
+}
+
+template <typename Float>
+struct hnsw_candidate {
+    Float distance;
+    std::int32_t row;
+};
+
+template <typename Float>
+inline bool operator<(const hnsw_candidate<Float>& a, const hnsw_candidate<Float>& b) {
+    return a.distance < b.distance || (a.distance == b.distance && a.row < b.row);
+}
+
+template <typename Float>
+inline bool operator>(const hnsw_candidate<Float>& a, const hnsw_candidate<Float>& b) {
+    return b < a;
+}
+
+/// Per-thread buffers of the graph traversal, the visited set is taken from the
+/// pool of the index and returned to it
+template <typename Float>
+struct hnsw_workspace {
+    std::unique_ptr<hnsw_visited_set> visited;
+    /// The min-heap of the rows to expand
+    std::vector<hnsw_candidate<Float>> candidates;
+    /// The max-heap of the best found rows, the farthest one is on the top
+    std::vector<hnsw_candidate<Float>> results;
+    std::vector<std::int32_t> neighbors;
+    std::vector<hnsw_candidate<Float>> selected;
+
+    hnsw_workspace(hnsw_visited_pool& pool, std::int64_t row_count)
+            : visited(pool.acquire(row_count)),
+              pool_(pool) {}
+
+    hnsw_workspace(const hnsw_workspace&) = delete;
+    hnsw_workspace& operator=(const hnsw_workspace&) = delete;
+
+    ~hnsw_workspace() {
+        pool_.release(std::move(visited));
+    }
+
+private:
+    hnsw_visited_pool& pool_;
+};
+
+/// View of the links of the graph. The construction writes the links through the
+/// view of `std::int32_t` and synchronizes the accesses to the neighbor lists with
+/// the striped locks, the search reads them through the view of `const std::int32_t`
+template <typename Float, typename Link>
+class hnsw_graph {
+public:
+    hnsw_graph(const hnsw_index& index,
+               Link* links,
+               const Float* data,
+               std::int64_t column_count,
+               dal::detail::mutex* locks,
+               std::int64_t lock_count)
+            : link_offsets_(index.link_offsets.get_data()),
+              links_(links),
+              max_degree_(index.max_degree),
+              data_(data),
+              column_count_(column_count),
+              locks_(locks),
+              lock_count_(lock_count) {}
+
+    Float distance(const Float* query, std::int32_t row) const {
+        return squared_euclidean(query, data_ + row * column_count_, column_count_);
+    }
+
+    const Float* get_row(std::int32_t row) const {
+        return data_ + row * column_count_;
+    }
+
+    std::int64_t get_capacity(std::int64_t level) const {
+        return level == 0 ? 2 * max_degree_ : max_degree_;
+    }
+
+    Link* get_links(std::int32_t row, std::int64_t level) const {
+        const std::int64_t shift = level == 0 ? 0 : 2 * max_degree_ + (level - 1) * max_degree_;
+        return links_ + link_offsets_[row] + shift;
+    }
+
+    /// Copies the neighbor list of the row at the level into the buffer
+    void read_links(std::int32_t row, std::int64_t level, std::vector<std::int32_t>& out) const {
+        out.clear();
+        lock(row);
+        const std::int32_t* links = get_links(row, level);
+        const std::int64_t capacity = get_capacity(level);
+        for (std::int64_t i = 0; i < capacity && links[i] >= 0; ++i) {
+            out.push_back(links[i]);
+        }
+        unlock(row);
+    }
+
+    void lock(std::int32_t row) const {
+        if (locks_) {
+            locks_[row % lock_count_].lock();
+        }
+    }
+
+    void unlock(std::int32_t row) const {
+        if (locks_) {
+            locks_[row % lock_count_].unlock();
+        }
+    }
+
+private:
+    const std::int64_t* link_offsets_;
+    Link* links_;
+    std::int64_t max_degree_;
+    const Float* data_;
+    std::int64_t column_count_;
+    dal::detail::mutex* locks_;
+    std::int64_t lock_count_;
+};
+
+template <typename Float>
+using hnsw_build_graph = hnsw_graph<Float, std::int32_t>;
+
+template <typename Float>
+using hnsw_search_graph = hnsw_graph<Float, const std::int32_t>;
+
+/// Moves from the entry row to the closest to the query neighbor at the level
+/// while the distance decreases
+template <typename Cpu, typename Float, typename Link>
+inline hnsw_candidate<Float> greedy_search(const hnsw_graph<Float, Link>& graph,
+                                           hnsw_workspace<Float>& ws,
+                                           const Float* query,
+                                           hnsw_candidate<Float> entry,
+                                           std::int64_t level) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        graph.read_links(entry.row, level, ws.neighbors);
+        for (const std::int32_t neighbor : ws.neighbors) {
+            const Float distance = graph.distance(query, neighbor);
+            if (distance < entry.distance) {
+                entry = { distance, neighbor };
+                changed = true;
+            }
+        }
+    }
+    return entry;
+}
+
+/// Best-first search at the level that keeps `breadth` closest rows found so far,
+/// the rows are left in the `ws.results` sorted by increasing distance
+template <typename Cpu, typename Float, typename Link>
+inline void search_layer(const hnsw_graph<Float, Link>& graph,
+                         hnsw_workspace<Float>& ws,
+                         const Float* query,
+                         hnsw_candidate<Float> entry,
+                         std::int64_t breadth,
+                         std::int64_t level) {
+    using candidate_t = hnsw_candidate<Float>;
+    auto& candidates = ws.candidates;
+    auto& results = ws.results;
+    candidates.clear();
+    results.clear();
+    ws.visited->clear();
+    ws.visited->insert(entry.row);
+    candidates.push_back(entry);
+    results.push_back(entry);
+
+    while (!candidates.empty()) {
+        std::pop_heap(candidates.begin(), candidates.end(), std::greater<candidate_t>{});
+        const candidate_t current = candidates.back();
+        candidates.pop_back();
+        if (current.distance > results.front().distance) {
+            break;
+        }
+
+        graph.read_links(current.row, level, ws.neighbors);
+        for (const std::int32_t neighbor : ws.neighbors) {
+            if (!ws.visited->insert(neighbor)) {
+                continue;
+            }
+
+            const candidate_t next = { graph.distance(query, neighbor), neighbor };
+            const bool is_full = static_cast<std::int64_t>(results.size()) >= breadth;
+            if (is_full && !(next < results.front())) {
+                continue;
+            }
+
+            candidates.push_back(next);
+            std::push_heap(candidates.begin(), candidates.end(), std::greater<candidate_t>{});
+            results.push_back(next);
+            std::push_heap(results.begin(), results.end());
+            if (is_full) {
+                std::pop_heap(results.begin(), results.end());
+                results.pop_back();
+            }
+        }
+    }
+
+    std::sort_heap(results.begin(), results.end());
+}
+
+/// Selects at most `count` of the candidates sorted by increasing distance to the
+/// base row: the candidate is kept if it is closer to the base row than to any
+/// of the already kept ones, so the links go in diverse directions
+template <typename Cpu, typename Float>
+inline void select_neighbors(const hnsw_build_graph<Float>& graph,
+                             const std::vector<hnsw_candidate<Float>>& sorted_candidates,
+                             std::int64_t count,
+                             std::vector<hnsw_candidate<Float>>& selected) {
+    selected.clear();
+    for (const auto& candidate : sorted_candidates) {
+        if (static_cast<std::int64_t>(selected.size()) >= count) {
+            break;
+        }
+        const Float* row = graph.get_row(candidate.row);
+        bool is_diverse = true;
+        for (const auto& kept : selected) {
+            if (graph.distance(row, kept.row) < candidate.distance) {
+                is_diverse = false;
+                break;
+            }
+        }
+        if (is_diverse) {
+            selected.push_back(candidate);
+        }
+    }
+}
+
+/// Adds the link from the row to the target at the level, prunes the neighbor
+/// list of the row by the selection heuristic when it is full
+template <typename Cpu, typename Float>
+inline void add_link(const hnsw_build_graph<Float>& graph,
+                     std::int32_t row,
+                     std::int32_t target,
+                     std::int64_t level) {
+    const std::int64_t capacity = graph.get_capacity(level);
+    const Float* row_data = graph.get_row(row);
+
+    graph.lock(row);
+    std::int32_t* links = graph.get_links(row, level);
+    std::int64_t count = 0;
+    while (count < capacity && links[count] >= 0) {
+        if (links[count] == target) {
+            graph.unlock(row);
+            return;
+        }
+        ++count;
+    }
+
+    if (count < capacity) {
+        links[count] = target;
+    }
+    else {
+        std::vector<hnsw_candidate<Float>> candidates;
+        std::vector<hnsw_candidate<Float>> selected;
+        candidates.reserve(capacity + 1);
+        for (std::int64_t i = 0; i < capacity; ++i) {
+            candidates.push_back({ graph.distance(row_data, links[i]), links[i] });
+        }
+        candidates.push_back({ graph.distance(row_data, target), target });
+        std::sort(candidates.begin(), candidates.end());
+        select_neighbors<Cpu>(graph, candidates, capacity, selected);
+
+        const std::int64_t selected_count = static_cast<std::int64_t>(selected.size());
+        for (std::int64_t i = 0; i < capacity; ++i) {
+            links[i] = i < selected_count ? selected[i].row : -1;
+        }
+    }
+    graph.unlock(row);
+}
+
+/// Links the row to the selected neighbors at the level. The list of the row can
+/// already contain the links added by the concurrent insertions, they are merged
+template <typename Cpu, typename Float>
+inline void set_links(const hnsw_build_graph<Float>& graph,
+                      hnsw_workspace<Float>& ws,
+                      std::int32_t row,
+                      std::int64_t level) {
+    const std::int64_t capacity = graph.get_capacity(level);
+    const Float* row_data = graph.get_row(row);
+
+    graph.lock(row);
+    std::int32_t* links = graph.get_links(row, level);
+    std::vector<hnsw_candidate<Float>> merged = ws.selected;
+    for (std::int64_t i = 0; i < capacity && links[i] >= 0; ++i) {
+        const std::int32_t neighbor = links[i];
+        const bool is_new = std::none_of(merged.begin(), merged.end(), [&](const auto& c) {
+            return c.row == neighbor;
+        });
+        if (is_new) {
+            merged.push_back({ graph.distance(row_data, neighbor), neighbor });
+        }
+    }
+
+    std::vector<hnsw_candidate<Float>> kept;
+    if (static_cast<std::int64_t>(merged.size()) > capacity) {
+        std::sort(merged.begin(), merged.end());
+        select_neighbors<Cpu>(graph, merged, capacity, kept);
+    }
+    else {
+        kept = std::move(merged);
+    }
+
+    const std::int64_t kept_count = static_cast<std::int64_t>(kept.size());
+    for (std::int64_t i = 0; i < capacity; ++i) {
+        links[i] = i < kept_count ? kept[i].row : -1;
+    }
+    graph.unlock(row);
+}
+
+template <typename Cpu, typename Float>
+inline void insert_row(hnsw_index& index,
+                       const hnsw_build_graph<Float>& graph,
+                       hnsw_workspace<Float>& ws,
+                       dal::detail::mutex& entry_mutex,
+                       std::int32_t row,
+                       std::int64_t construction_breadth) {
+    const std::int64_t row_level = index.levels.get_data()[row];
+    const Float* query = graph.get_row(row);
+
+    // The insertion that raises the top level holds the entry mutex until
+    // the row becomes the new entry point
+    entry_mutex.lock();
+    const std::int32_t entry_point = static_cast<std::int32_t>(index.entry_point);
+    const std::int64_t max_level = index.max_level;
+    const bool is_new_top = row_level > max_level;
+    if (!is_new_top) {
+        entry_mutex.unlock();
+    }
+
+    hnsw_candidate<Float> entry = { graph.distance(query, entry_point), entry_point };
+    for (std::int64_t level = max_level; level > row_level; --level) {
+        entry = greedy_search<Cpu>(graph, ws, query, entry, level);
+    }
+
+    for (std::int64_t level = std::min(row_level, max_level); level >= 0; --level) {
+        search_layer<Cpu>(graph, ws, query, entry, construction_breadth, level);
+
+        // The row can be reached through the links added by the concurrent
+        // insertions that have already found it at the upper levels
+        auto& results = ws.results;
+        results.erase(std::remove_if(results.begin(),
+                                     results.end(),
+                                     [&](const auto& c) {
+                                         return c.row == row;
+                                     }),
+                      results.end());
+        if (results.empty()) {
+            continue;
+        }
+        entry = results.front();
+
+        select_neighbors<Cpu>(graph, ws.results, index.max_degree, ws.selected);
+        set_links<Cpu>(graph, ws, row, level);
+        for (const auto& neighbor : ws.selected) {
+            add_link<Cpu>(graph, neighbor.row, row, level);
+        }
+    }
+
+    if (is_new_top) {
+        index.entry_point = row;
+        index.max_level = row_level;
+        entry_mutex.unlock();
+    }
+}
+
+/// Builds the proximity graph of the row-major data in parallel, the rows are
+/// inserted by the threads concurrently, the first row is the initial entry point
+template <typename Cpu, typename Float>
+void build_hnsw(const Float* data,
+                std::int64_t row_count,
+                std::int64_t column_count,
+                std::int64_t max_degree,
+                std::int64_t construction_breadth,
+                hnsw_index& index) {
+    ONEDAL_ASSERT(row_count > 0);
+    ONEDAL_ASSERT(row_count <= dal::detail::limits<std::int32_t>::max());
+    ONEDAL_ASSERT(max_degree > 1);
+
+    index.max_degree = max_degree;
+    index.levels = array<std::int32_t>::empty(row_count);
+    index.link_offsets = array<std::int64_t>::empty(row_count + 1);
+
+    std::int32_t* levels = index.levels.get_mutable_data();
+    std::int64_t* link_offsets = index.link_offsets.get_mutable_data();
+    link_offsets[0] = 0;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        levels[i] = get_hnsw_level(i, max_degree);
+        link_offsets[i + 1] = link_offsets[i] + 2 * max_degree + levels[i] * max_degree;
+    }
+
+    // The links are written through the builder's own array, the index gets it
+    // when the graph is complete
+    auto links = array<std::int32_t>::full(link_offsets[row_count], -1);
+    index.entry_point = 0;
+    index.max_level = levels[0];
+
+    constexpr std::int64_t max_lock_count = 4096;
+    const std::int64_t lock_count = std::min(row_count, max_lock_count);
+    const auto locks = std::unique_ptr<dal::detail::mutex[]>(new dal::detail::mutex[lock_count]);
+    dal::detail::mutex entry_mutex;
+
+    const hnsw_build_graph<Float> graph{
+        index, links.get_mutable_data(), data, column_count, locks.get(), lock_count
+    };
+
+    const std::int64_t thread_count =
+        std::min<std::int64_t>(dal::detail::threader_get_max_threads(), row_count);
+    dal::detail::threader_for(thread_count, thread_count, [&](std::int32_t thread) {
+        hnsw_workspace<Float> ws{ *index.visited_pool, row_count };
+        for (std::int64_t row = 1 + thread; row < row_count; row += thread_count) {
+            insert_row<Cpu>(index,
+                            graph,
+                            ws,
+                            entry_mutex,
+                            static_cast<std::int32_t>(row),
+                            construction_breadth);
+        }
+    });
+    index.links = links;
+}
+
+/// Finds `neighbor_count` approximate nearest rows of the graph for each query,
+/// the rows that are not found are marked with -1 index and the maximal distance
+template <typename Cpu, typename Float>
+void search_hnsw(const hnsw_index& index,
+                 const Float* data,
+                 std::int64_t column_count,
+                 const Float* queries,
+                 std::int64_t query_count,
+                 std::int64_t neighbor_count,
+                 std::int64_t search_breadth,
+                 std::int64_t* indices,
+                 Float* distances) {
+    ONEDAL_ASSERT(!index.is_empty());
+
+    const std::int64_t row_count = index.levels.get_count();
+    const std::int64_t breadth = std::max(search_breadth, neighbor_count);
+    const hnsw_search_graph<Float> graph{
+        index, index.links.get_data(), data, column_count, nullptr, 0
+    };
+    const std::int32_t entry_point = static_cast<std::int32_t>(index.entry_point);
+
+    constexpr std::int64_t block_size = 64;
+    const std::int64_t block_count = (query_count + block_size - 1) / block_size;
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+
+    std::vector<std::unique_ptr<hnsw_workspace<Float>>> workspaces(thread_count);
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        auto& ws_ptr = workspaces[dal::detail::threader_get_current_thread_index()];
+        if (!ws_ptr) {
+            ws_ptr.reset(new hnsw_workspace<Float>{ *index.visited_pool, row_count });
+        }
+        auto& ws = *ws_ptr;
+
+        const std::int64_t first = block * block_size;
+        const std::int64_t last = std::min(first + block_size, query_count);
+        for (std::int64_t i = first; i < last; ++i) {
+            const Float* query = queries + i * column_count;
+            hnsw_candidate<Float> entry = { graph.distance(query, entry_point), entry_point };
+            for (std::int64_t level = index.max_level; level > 0; --level) {
+                entry = greedy_search<Cpu>(graph, ws, query, entry, level);
+            }
+            search_layer<Cpu>(graph, ws, query, entry, breadth, 0);
+
+            const std::int64_t found_count =
+                std::min<std::int64_t>(ws.results.size(), neighbor_count);
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                const bool is_found = j < found_count;
+                indices[i * neighbor_count + j] = is_found ? ws.results[j].row : -1;
+                distances[i * neighbor_count + j] =
+                    is_found ? std::sqrt(ws.results[j].distance)
+                             : std::numeric_limits<Float>::max();
+            }
+        }
+    });
+}
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+template void build_hnsw<__CPU_TAG__, float>(const float* data,
+                                             std::int64_t row_count,
+                                             std::int64_t column_count,
+                                             std::int64_t max_degree,
+                                             std::int64_t construction_breadth,
+                                             hnsw_index& index);
+
+template void build_hnsw<__CPU_TAG__, double>(const double* data,
+                                              std::int64_t row_count,
+                                              std::int64_t column_count,
+                                              std::int64_t max_degree,
+                                              std::int64_t construction_breadth,
+                                              hnsw_index& index);
+
+template void search_hnsw<__CPU_TAG__, float>(const hnsw_index& index,
+                                              const float* data,
+                                              std::int64_t column_count,
+                                              const float* queries,
+                                              std::int64_t query_count,
+                                              std::int64_t neighbor_count,
+                                              std::int64_t search_breadth,
+                                              std::int64_t* indices,
+                                              float* distances);
+
+template void search_hnsw<__CPU_TAG__, double>(const hnsw_index& index,
+                                               const double* data,
+                                               std::int64_t column_count,
+                                               const double* queries,
+                                               std::int64_t query_count,
+                                               std::int64_t neighbor_count,
+                                               std::int64_t search_breadth,
+                                               std::int64_t* indices,
+                                               double* distances);
+
+} // namespace oneapi::dal::knn::backend
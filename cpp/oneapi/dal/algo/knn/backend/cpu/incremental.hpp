@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include "oneapi/dal/algo/knn/backend/cpu/delta_search.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/algo/knn/infer_types.hpp"
+#include "oneapi/dal/algo/knn/train_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Copies the rows of `bottom` after the rows of `top` into the new table,
+/// any of the tables may be empty
+template <typename Float>
+inline table concatenate_rows(const table& top, const table& bottom) {
+    const std::int64_t top_row_count = top.get_row_count();
+    const std::int64_t bottom_row_count = bottom.get_row_count();
+    const std::int64_t column_count =
+        (top_row_count > 0) ? top.get_column_count() : bottom.get_column_count();
+    ONEDAL_ASSERT(top_row_count == 0 || bottom_row_count == 0 ||
+                  top.get_column_count() == bottom.get_column_count());
+
+    const std::int64_t row_count = top_row_count + bottom_row_count;
+    auto arr_rows = array<Float>::empty(row_count * column_count);
+    Float* rows = arr_rows.get_mutable_data();
+    if (top_row_count > 0) {
+        const auto arr_top = row_accessor<const Float>{ top }.pull();
+        std::copy(arr_top.get_data(), arr_top.get_data() + arr_top.get_count(), rows);
+    }
+    if (bottom_row_count > 0) {
+        const auto arr_bottom = row_accessor<const Float>{ bottom }.pull();
+        std::copy(arr_bottom.get_data(),
+                  arr_bottom.get_data() + arr_bottom.get_count(),
+                  rows + top_row_count * column_count);
+    }
+    return dal::detail::homogen_table_builder{}.reset(arr_rows, row_count, column_count).build();
+}
+
+/// Appends the training data to the non-empty search model given in the input.
+/// While the number of the appended rows does not exceed `max_delta_row_count`, they
+/// are copied to the delta buffer of the new model that shares the search structure
+/// `interop` of the input model, so the cost of the update is bounded by the size of
+/// the buffer. Otherwise, or if the training data is empty, the rows of the search
+/// structure returned by `get_base_rows` in the original order and the appended rows
+/// are passed to `build` that constructs the new search structure.
+template <typename Float, typename GetBaseRows, typename Build>
+inline train_result<task::search> train_incremental(
+    const detail::descriptor_base<task::search>& desc,
+    const train_input<task::search>& input,
+    model_interop* interop,
+    std::int64_t base_row_count,
+    std::int64_t column_count,
+    const GetBaseRows& get_base_rows,
+    const Build& build) {
+    const auto& base = dal::detail::get_impl(input.get_model());
+    const table& data = input.get_data();
+    const bool has_data = data.has_data();
+    if (!has_data && base.delta.is_empty()) {
+        return train_result<task::search>().set_model(input.get_model());
+    }
+    if (has_data && data.get_column_count() != column_count) {
+        throw invalid_argument(
+            dal::detail::error_messages::input_data_cc_neq_input_model_data_cc());
+    }
+
+    const table delta = concatenate_rows<Float>(base.delta.data, data);
+    const std::int64_t row_count = base_row_count + delta.get_row_count();
+    if (row_count > dal::detail::limits<std::int32_t>::max()) {
+        throw domain_error(dal::detail::error_messages::row_count_gt_max_int32());
+    }
+
+    if (!has_data || delta.get_row_count() > desc.get_max_delta_row_count()) {
+        return build(concatenate_rows<Float>(get_base_rows(), delta));
+    }
+
+    const auto impl =
+        std::make_shared<model_impl<task::search>>(new model_interop(interop->get_daal_model()));
+    impl->delta.data = delta;
+    impl->delta.base_row_count = base_row_count;
+    return train_result<task::search>().set_model(
+        dal::detail::make_private<model<task::search>>(impl));
+}
+
+/// Searches the delta buffer of the model by the brute force and merges the found
+/// rows into the neighbors found by the search structure
+template <typename Float>
+inline infer_result<task::search> infer_delta(const dal::backend::context_cpu& ctx,
+                                              const delta_buffer& delta,
+                                              const table& data,
+                                              std::int64_t neighbor_count,
+                                              const infer_result<task::search>& base_result) {
+    ONEDAL_ASSERT(!delta.is_empty());
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (column_count != delta.data.get_column_count()) {
+        throw invalid_argument(
+            dal::detail::error_messages::input_data_cc_neq_input_model_data_cc());
+    }
+
+    const auto arr_queries = row_accessor<const Float>{ data }.pull();
+    const auto arr_delta = row_accessor<const Float>{ delta.data }.pull();
+    const auto arr_base_indices =
+        row_accessor<const std::int32_t>{ base_result.get_indices() }.pull();
+    const auto arr_base_distances = row_accessor<const Float>{ base_result.get_distances() }.pull();
+
+    auto arr_indices = array<std::int64_t>::empty(row_count * neighbor_count);
+    auto arr_distances = array<Float>::empty(row_count * neighbor_count);
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        search_delta_rows<decltype(cpu)>(arr_delta.get_data(),
+                                         delta.data.get_row_count(),
+                                         delta.base_row_count,
+                                         column_count,
+                                         arr_queries.get_data(),
+                                         row_count,
+                                         neighbor_count,
+                                         arr_base_indices.get_data(),
+                                         arr_base_distances.get_data(),
+                                         arr_indices.get_mutable_data(),
+                                         arr_distances.get_mutable_data());
+    });
+
+    return infer_result<task::search>()
+        .set_indices(dal::detail::homogen_table_builder{}
+                         .reset(arr_indices, row_count, neighbor_count)
+                         .build())
+        .set_distances(dal::detail::homogen_table_builder{}
+                           .reset(arr_distances, row_count, neighbor_count)
+                           .build());
+}
+
+} // namespace oneapi::dal::knn::backend
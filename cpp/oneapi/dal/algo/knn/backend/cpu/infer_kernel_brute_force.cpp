@@ -18,7 +18,9 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
+#include "oneapi/dal/algo/knn/backend/cpu/incremental.hpp"
 #include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/quantized_search.hpp"
 #include "oneapi/dal/algo/knn/backend/distance_impl.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 
@@ -98,10 +100,15 @@ static infer_result<Task> call_daal_kernel(const context_cpu &ctx,
     const auto daal_voting_mode = convert_to_daal_bf_voting_mode(desc.get_voting_mode());
     daal_parameter.voteWeights = daal_voting_mode;
 
+    const auto model_interop = dal::detail::get_impl(m).get_interop();
+    if (!model_interop) {
+        throw invalid_argument(dal::detail::error_messages::input_model_does_not_match_method());
+    }
+
     interop::status_to_exception(interop::call_daal_kernel<Float, daal_knn_bf_kernel_t>(
         ctx,
         daal_data.get(),
-        dal::detail::get_impl(m).get_interop()->get_daal_model().get(),
+        model_interop->get_daal_model().get(),
         daal_responses.get(),
         daal_indices.get(),
         daal_distance.get(),
@@ -124,11 +131,73 @@ static infer_result<Task> call_daal_kernel(const context_cpu &ctx,
     return result;
 }
 
+template <typename Float>
+static infer_result<task::search> infer_quantized(const context_cpu &ctx,
+                                                  const detail::descriptor_base<task::search> &desc,
+                                                  const infer_input<task::search> &input) {
+    const auto &index = dal::detail::get_impl(input.get_model()).quantized;
+    if (index.is_empty()) {
+        throw invalid_argument(dal::detail::error_messages::input_model_does_not_match_method());
+    }
+
+    const table &data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (column_count != index.data.get_column_count()) {
+        throw invalid_argument(
+            dal::detail::error_messages::input_data_cc_neq_input_model_data_cc());
+    }
+
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+    const auto arr_queries = row_accessor<const Float>{ data }.pull();
+    const auto arr_model_data = row_accessor<const Float>{ index.data }.pull();
+
+    auto arr_indices = array<std::int64_t>::empty(row_count * neighbor_count);
+    auto arr_distance = array<Float>::empty(row_count * neighbor_count);
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        search_quantized<decltype(cpu)>(index,
+                                        arr_model_data.get_data(),
+                                        index.data.get_row_count(),
+                                        column_count,
+                                        arr_queries.get_data(),
+                                        row_count,
+                                        neighbor_count,
+                                        desc.get_rerank_factor(),
+                                        arr_indices.get_mutable_data(),
+                                        arr_distance.get_mutable_data());
+    });
+
+    return infer_result<task::search>()
+        .set_indices(dal::detail::homogen_table_builder{}
+                         .reset(arr_indices, row_count, neighbor_count)
+                         .build())
+        .set_distances(dal::detail::homogen_table_builder{}
+                           .reset(arr_distance, row_count, neighbor_count)
+                           .build());
+}
+
 template <typename Float, typename Task>
 static infer_result<Task> infer(const context_cpu &ctx,
                                 const detail::descriptor_base<Task> &desc,
                                 const infer_input<Task> &input) {
-    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+    if constexpr (std::is_same_v<Task, task::search>) {
+        if (desc.get_compression() == compression::int8) {
+            return infer_quantized<Float>(ctx, desc, input);
+        }
+    }
+    const auto result = call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+    if constexpr (std::is_same_v<Task, task::search>) {
+        const auto &delta = dal::detail::get_impl(input.get_model()).delta;
+        if (!delta.is_empty()) {
+            return infer_delta<Float>(ctx,
+                                      delta,
+                                      input.get_data(),
+                                      desc.get_neighbor_count(),
+                                      result);
+        }
+    }
+    return result;
 }
 
 template <typename Float, typename Task>
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+template <typename Float>
+static infer_result<task::search> infer(const context_cpu& ctx,
+                                        const detail::descriptor_base<task::search>& desc,
+                                        const infer_input<task::search>& input) {
+    const auto& index = dal::detail::get_impl(input.get_model()).hnsw;
+    if (index.is_empty()) {
+        throw invalid_argument(dal::detail::error_messages::input_model_does_not_match_method());
+    }
+
+    const table& data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (column_count != index.data.get_column_count()) {
+        throw invalid_argument(
+            dal::detail::error_messages::input_data_cc_neq_input_model_data_cc());
+    }
+
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+    const auto arr_queries = row_accessor<const Float>{ data }.pull();
+    const auto arr_model_data = row_accessor<const Float>{ index.data }.pull();
+
+    auto arr_indices = array<std::int64_t>::empty(row_count * neighbor_count);
+    auto arr_distance = array<Float>::empty(row_count * neighbor_count);
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        search_hnsw<decltype(cpu)>(index,
+                                   arr_model_data.get_data(),
+                                   column_count,
+                                   arr_queries.get_data(),
+                                   row_count,
+                                   neighbor_count,
+                                   desc.get_search_breadth(),
+                                   arr_indices.get_mutable_data(),
+                                   arr_distance.get_mutable_data());
+    });
+
+    return infer_result<task::search>()
+        .set_indices(dal::detail::homogen_table_builder{}
+                         .reset(arr_indices, row_count, neighbor_count)
+                         .build())
+        .set_distances(dal::detail::homogen_table_builder{}
+                           .reset(arr_distance, row_count, neighbor_count)
+                           .build());
+}
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::hnsw, task::search> {
+    infer_result<task::search> operator()(const context_cpu& ctx,
+                                          const detail::descriptor_base<task::search>& desc,
+                                          const infer_input<task::search>& input) const {
+        return infer<Float>(ctx, desc, input);
+    }
+};
+
+template struct infer_kernel_cpu<float, method::hnsw, task::search>;
+template struct infer_kernel_cpu<double, method::hnsw, task::search>;
+
+} // namespace oneapi::dal::knn::backend
@@ -16,6 +16,7 @@
 
 #include <daal/src/algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_dense_default_batch.h>
 
+#include "oneapi/dal/algo/knn/backend/cpu/incremental.hpp"
 #include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
@@ -27,7 +28,6 @@
 namespace oneapi::dal::knn::backend {
 
 using dal::backend::context_cpu;
-using descriptor_t = detail::descriptor_base<task::classification>;
 
 namespace daal_knn = daal::algorithms::kdtree_knn_classification;
 namespace daal_classifier = daal::algorithms::classifier;
@@ -40,7 +40,7 @@ using daal_knn_kd_tree_kernel_t = daal_knn::prediction::internal::
 
 template <typename Float, typename Task>
 static infer_result<Task> call_daal_kernel(const context_cpu &ctx,
-                                           const descriptor_t &desc,
+                                           const detail::descriptor_base<Task> &desc,
                                            const table &data,
                                            model<Task> m) {
     const std::int64_t row_count = data.get_row_count();
@@ -85,10 +85,15 @@ static infer_result<Task> call_daal_kernel(const context_cpu &ctx,
 
     const auto daal_data = interop::convert_to_daal_table<Float>(data);
 
+    const auto model_interop = dal::detail::get_impl(m).get_interop();
+    if (!model_interop) {
+        throw invalid_argument(dal::detail::error_messages::input_model_does_not_match_method());
+    }
+
     interop::status_to_exception(interop::call_daal_kernel<Float, daal_knn_kd_tree_kernel_t>(
         ctx,
         daal_data.get(),
-        dal::detail::get_impl(m).get_interop()->get_daal_model().get(),
+        model_interop->get_daal_model().get(),
         daal_responses.get(),
         daal_indices.get(),
         daal_distance.get(),
@@ -114,15 +119,26 @@ static infer_result<Task> call_daal_kernel(const context_cpu &ctx,
 
 template <typename Float, typename Task>
 static infer_result<Task> infer(const context_cpu &ctx,
-                                const descriptor_t &desc,
+                                const detail::descriptor_base<Task> &desc,
                                 const infer_input<Task> &input) {
-    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+    const auto result = call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+    if constexpr (std::is_same_v<Task, task::search>) {
+        const auto &delta = dal::detail::get_impl(input.get_model()).delta;
+        if (!delta.is_empty()) {
+            return infer_delta<Float>(ctx,
+                                      delta,
+                                      input.get_data(),
+                                      desc.get_neighbor_count(),
+                                      result);
+        }
+    }
+    return result;
 }
 
 template <typename Float, typename Task>
 struct infer_kernel_cpu<Float, method::kd_tree, Task> {
     infer_result<Task> operator()(const context_cpu &ctx,
-                                  const descriptor_t &desc,
+                                  const detail::descriptor_base<Task> &desc,
                                   const infer_input<Task> &input) const {
         return infer<Float>(ctx, desc, input);
     }
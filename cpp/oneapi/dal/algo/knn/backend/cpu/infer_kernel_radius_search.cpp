@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/k_nearest_neighbors/bf_knn_classification_predict_kernel.h>
+#include <daal/src/algorithms/k_nearest_neighbors/kdtree_knn_classification_model_impl.h>
+
+#include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/radius_search.hpp"
+#include "oneapi/dal/algo/knn/backend/distance_impl.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::radius_search>;
+
+namespace daal_bf_knn = daal::algorithms::bf_knn_classification;
+namespace daal_kdtree_knn = daal::algorithms::kdtree_knn_classification;
+
+namespace interop = dal::backend::interop;
+
+static void check_radius_search_distance(const descriptor_t& desc) {
+    auto distance_impl = detail::get_distance_impl(desc);
+    if (!distance_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_distance_type() };
+    }
+    else if (distance_impl->get_daal_distance_type() != detail::v1::daal_distance_t::minkowski ||
+             distance_impl->get_degree() != 2.0) {
+        throw internal_error{
+            dal::detail::error_messages::distance_is_not_supported_for_radius_search()
+        };
+    }
+}
+
+static backend::model_interop* get_model_interop(const model<task::radius_search>& m) {
+    const auto model_interop = dal::detail::get_impl(m).get_interop();
+    if (!model_interop) {
+        throw invalid_argument(dal::detail::error_messages::input_model_does_not_match_method());
+    }
+    return model_interop;
+}
+
+template <typename Float>
+static infer_result<task::radius_search> make_result(const radius_neighbors<Float>& neighbors,
+                                                     std::int64_t row_count) {
+    auto result = infer_result<task::radius_search>{}.set_offsets(
+        dal::detail::homogen_table_builder{}.reset(neighbors.offsets, row_count + 1, 1).build());
+
+    // Tables cannot be empty, the queries without neighbors are only seen in the offsets
+    if (neighbors.neighbor_count > 0) {
+        result.set_indices(dal::detail::homogen_table_builder{}
+                               .reset(neighbors.indices, neighbors.neighbor_count, 1)
+                               .build())
+            .set_distances(dal::detail::homogen_table_builder{}
+                               .reset(neighbors.distances, neighbors.neighbor_count, 1)
+                               .build());
+    }
+    return result;
+}
+
+template <typename Float>
+static infer_result<task::radius_search> infer_brute_force(
+    const context_cpu& ctx,
+    const descriptor_t& desc,
+    const infer_input<task::radius_search>& input) {
+    check_radius_search_distance(desc);
+
+    const auto model_interop = get_model_interop(input.get_model());
+    const auto daal_model =
+        static_cast<daal_bf_knn::Model*>(model_interop->get_daal_model().get());
+    const table model_data =
+        interop::convert_from_daal_homogen_table<Float>(daal_model->impl()->getData());
+
+    const table& data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (column_count != model_data.get_column_count()) {
+        throw invalid_argument(
+            dal::detail::error_messages::input_data_cc_neq_input_model_data_cc());
+    }
+
+    const auto arr_queries = row_accessor<const Float>{ data }.pull();
+    const auto arr_model_data = row_accessor<const Float>{ model_data }.pull();
+
+    const auto neighbors = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return radius_search_brute_force<decltype(cpu)>(arr_model_data.get_data(),
+                                                        model_data.get_row_count(),
+                                                        column_count,
+                                                        arr_queries.get_data(),
+                                                        row_count,
+                                                        static_cast<Float>(desc.get_radius()));
+    });
+    return make_result(neighbors, row_count);
+}
+
+template <typename Float>
+static infer_result<task::radius_search> infer_kd_tree(
+    const context_cpu& ctx,
+    const descriptor_t& desc,
+    const infer_input<task::radius_search>& input) {
+    const auto model_interop = get_model_interop(input.get_model());
+    const auto daal_model =
+        static_cast<daal_kdtree_knn::Model*>(model_interop->get_daal_model().get());
+    const auto daal_model_impl = daal_model->impl();
+
+    const table model_data =
+        interop::convert_from_daal_homogen_table<Float>(daal_model_impl->getData());
+    const table model_indices =
+        interop::convert_from_daal_homogen_table<std::int32_t>(daal_model_impl->getIndices());
+
+    const table& data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (column_count != model_data.get_column_count()) {
+        throw invalid_argument(
+            dal::detail::error_messages::input_data_cc_neq_input_model_data_cc());
+    }
+
+    // The DAAL nodes are converted to the signed layout, the leaves are marked by
+    // the null dimension equal to the maximum value of size_t
+    const auto& daal_tree = *daal_model_impl->getKDTreeTable();
+    const auto daal_nodes =
+        static_cast<const daal_kdtree_knn::KDTreeNode*>(daal_tree.getArray());
+    const std::int64_t node_count =
+        dal::detail::integral_cast<std::int64_t>(daal_tree.getNumberOfRows());
+    auto arr_nodes = array<kd_tree_node>::empty(node_count);
+    kd_tree_node* nodes = arr_nodes.get_mutable_data();
+    for (std::int64_t i = 0; i < node_count; ++i) {
+        const auto& node = daal_nodes[i];
+        nodes[i] = { (node.dimension == static_cast<std::size_t>(-1))
+                         ? std::int64_t(-1)
+                         : static_cast<std::int64_t>(node.dimension),
+                     static_cast<std::int64_t>(node.leftIndex),
+                     static_cast<std::int64_t>(node.rightIndex),
+                     node.cutPoint };
+    }
+
+    const auto arr_queries = row_accessor<const Float>{ data }.pull();
+    const auto arr_model_data = row_accessor<const Float>{ model_data }.pull();
+    const auto arr_model_indices = row_accessor<const std::int32_t>{ model_indices }.pull();
+
+    const kd_tree_view<Float> tree{
+        nodes,
+        dal::detail::integral_cast<std::int64_t>(daal_model_impl->getRootNodeIndex()),
+        arr_model_data.get_data(),
+        arr_model_indices.get_data(),
+        column_count
+    };
+
+    const auto neighbors = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return radius_search_kd_tree<decltype(cpu)>(tree,
+                                                    arr_queries.get_data(),
+                                                    row_count,
+                                                    static_cast<Float>(desc.get_radius()));
+    });
+    return make_result(neighbors, row_count);
+}
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::brute_force, task::radius_search> {
+    infer_result<task::radius_search> operator()(
+        const context_cpu& ctx,
+        const descriptor_t& desc,
+        const infer_input<task::radius_search>& input) const {
+        return infer_brute_force<Float>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::kd_tree, task::radius_search> {
+    infer_result<task::radius_search> operator()(
+        const context_cpu& ctx,
+        const descriptor_t& desc,
+        const infer_input<task::radius_search>& input) const {
+        return infer_kd_tree<Float>(ctx, desc, input);
+    }
+};
+
+template struct infer_kernel_cpu<float, method::brute_force, task::radius_search>;
+template struct infer_kernel_cpu<double, method::brute_force, task::radius_search>;
+template struct infer_kernel_cpu<float, method::kd_tree, task::radius_search>;
+template struct infer_kernel_cpu<double, method::kd_tree, task::radius_search>;
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,246 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw.hpp"
+#include "oneapi/dal/algo/knn/backend/quantized_index.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Dot product of the 8-bit codes of the training row and the signed 8-bit weights
+/// of the query. The products are summed in 32-bit integers over the chunks short
+/// enough to exclude the overflow, so the inner loop maps to the integer
+/// multiply-add instructions of the target CPU
+inline std::int64_t quantized_dot(const std::uint8_t* codes,
+                                  const std::int8_t* weights,
+                                  std::int64_t column_count) {
+    constexpr std::int64_t chunk_size = 4096;
+    std::int64_t sum = 0;
+    for (std::int64_t begin = 0; begin < column_count; begin += chunk_size) {
+        const std::int64_t end = std::min(begin + chunk_size, column_count);
+        std::int32_t partial = 0;
+        for (std::int64_t j = begin; j < end; ++j) {
+            partial += std::int32_t(codes[j]) * std::int32_t(weights[j]);
+        }
+        sum += partial;
+    }
+    return sum;
+}
+
+struct quantized_candidate {
+    float score;
+    std::int64_t row;
+};
+
+inline bool operator<(const quantized_candidate& a, const quantized_candidate& b) {
+    return a.score < b.score || (a.score == b.score && a.row < b.row);
+}
+
+/// Computes the per-feature ranges of the training data and its 8-bit codes
+template <typename Cpu, typename Float>
+void build_quantized_index(const Float* data,
+                           std::int64_t row_count,
+                           std::int64_t column_count,
+                           quantized_index& index) {
+    ONEDAL_ASSERT(row_count > 0);
+    ONEDAL_ASSERT(column_count > 0);
+
+    constexpr std::int64_t block_size = 1024;
+    const std::int64_t block_count = (row_count + block_size - 1) / block_size;
+    ONEDAL_ASSERT(block_count <= dal::detail::limits<std::int32_t>::max());
+
+    std::vector<Float> block_min(block_count * column_count);
+    std::vector<Float> block_max(block_count * column_count);
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * block_size;
+        const std::int64_t last = std::min(first + block_size, row_count);
+        Float* min = block_min.data() + block * column_count;
+        Float* max = block_max.data() + block * column_count;
+        std::copy(data + first * column_count, data + (first + 1) * column_count, min);
+        std::copy(data + first * column_count, data + (first + 1) * column_count, max);
+        for (std::int64_t i = first + 1; i < last; ++i) {
+            const Float* row = data + i * column_count;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                min[j] = std::min(min[j], row[j]);
+                max[j] = std::max(max[j], row[j]);
+            }
+        }
+    });
+
+    auto arr_scales = array<float>::empty(column_count);
+    auto arr_offsets = array<float>::empty(column_count);
+    float* scales = arr_scales.get_mutable_data();
+    float* offsets = arr_offsets.get_mutable_data();
+    for (std::int64_t j = 0; j < column_count; ++j) {
+        Float min = block_min[j];
+        Float max = block_max[j];
+        for (std::int64_t block = 1; block < block_count; ++block) {
+            min = std::min(min, block_min[block * column_count + j]);
+            max = std::max(max, block_max[block * column_count + j]);
+        }
+        offsets[j] = static_cast<float>(min);
+        scales[j] = static_cast<float>((max - min) / Float(255));
+    }
+
+    auto arr_codes = array<std::uint8_t>::empty(row_count * column_count);
+    auto arr_row_norms = array<float>::empty(row_count);
+    std::uint8_t* codes = arr_codes.get_mutable_data();
+    float* row_norms = arr_row_norms.get_mutable_data();
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * block_size;
+        const std::int64_t last = std::min(first + block_size, row_count);
+        for (std::int64_t i = first; i < last; ++i) {
+            const Float* row = data + i * column_count;
+            std::uint8_t* row_codes = codes + i * column_count;
+            float norm = 0;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                float code = 0;
+                if (scales[j] > 0) {
+                    const float value = (static_cast<float>(row[j]) - offsets[j]) / scales[j];
+                    code = std::min(std::max(std::nearbyint(value), 0.0f), 255.0f);
+                }
+                row_codes[j] = static_cast<std::uint8_t>(code);
+                norm += (scales[j] * code) * (scales[j] * code);
+            }
+            row_norms[i] = norm;
+        }
+    });
+
+    index.codes = arr_codes;
+    index.scales = arr_scales;
+    index.offsets = arr_offsets;
+    index.row_norms = arr_row_norms;
+}
+
+/// Finds the :literal:`neighbor_count` nearest training rows of each query. The
+/// squared distance to the dequantized row `i` is approximated as
+/// `row_norms[i] - 2 * alpha * dot(weights, codes[i])` up to the query constant,
+/// where the signed 8-bit weights approximate `alpha^-1 * scales * (query - offsets)`.
+/// The :expr:`neighbor_count * rerank_factor` best candidates are re-ranked by the
+/// exact distances to the original rows. The missing neighbors are filled with -1
+/// indices and the maximum distances
+template <typename Cpu, typename Float>
+void search_quantized(const quantized_index& index,
+                      const Float* data,
+                      std::int64_t row_count,
+                      std::int64_t column_count,
+                      const Float* queries,
+                      std::int64_t query_count,
+                      std::int64_t neighbor_count,
+                      std::int64_t rerank_factor,
+                      std::int64_t* indices,
+                      Float* distances) {
+    ONEDAL_ASSERT(!index.is_empty());
+
+    constexpr std::int64_t query_block_size = 16;
+    constexpr std::int64_t row_tile_size = 1024;
+    const std::int64_t block_count = (query_count + query_block_size - 1) / query_block_size;
+    const std::int64_t candidate_count = std::min(neighbor_count * rerank_factor, row_count);
+
+    const std::uint8_t* codes = index.codes.get_data();
+    const float* scales = index.scales.get_data();
+    const float* offsets = index.offsets.get_data();
+    const float* row_norms = index.row_norms.get_data();
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * query_block_size;
+        const std::int64_t last = std::min(first + query_block_size, query_count);
+        const std::int64_t block_query_count = last - first;
+
+        std::vector<std::int8_t> weights(block_query_count * column_count);
+        std::vector<float> alphas(block_query_count);
+        std::vector<float> projection(column_count);
+        for (std::int64_t q = 0; q < block_query_count; ++q) {
+            const Float* query = queries + (first + q) * column_count;
+            float max_abs = 0;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                projection[j] = scales[j] * (static_cast<float>(query[j]) - offsets[j]);
+                max_abs = std::max(max_abs, std::abs(projection[j]));
+            }
+            const float alpha = (max_abs > 0) ? max_abs / 127.0f : 1.0f;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                weights[q * column_count + j] =
+                    static_cast<std::int8_t>(std::nearbyint(projection[j] / alpha));
+            }
+            alphas[q] = alpha;
+        }
+
+        // Max-heaps of the best candidates of the queries by the approximate distance
+        std::vector<std::vector<quantized_candidate>> heaps(block_query_count);
+        for (auto& heap : heaps) {
+            heap.reserve(candidate_count);
+        }
+        for (std::int64_t tile = 0; tile < row_count; tile += row_tile_size) {
+            const std::int64_t tile_end = std::min(tile + row_tile_size, row_count);
+            for (std::int64_t q = 0; q < block_query_count; ++q) {
+                const std::int8_t* query_weights = weights.data() + q * column_count;
+                const float scale = 2 * alphas[q];
+                auto& heap = heaps[q];
+                for (std::int64_t i = tile; i < tile_end; ++i) {
+                    const std::int64_t dot =
+                        quantized_dot(codes + i * column_count, query_weights, column_count);
+                    const quantized_candidate candidate = {
+                        row_norms[i] - scale * static_cast<float>(dot),
+                        i
+                    };
+                    if (std::int64_t(heap.size()) < candidate_count) {
+                        heap.push_back(candidate);
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                    else if (candidate < heap.front()) {
+                        std::pop_heap(heap.begin(), heap.end());
+                        heap.back() = candidate;
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                }
+            }
+        }
+
+        std::vector<hnsw_candidate<Float>> exact;
+        for (std::int64_t q = 0; q < block_query_count; ++q) {
+            const std::int64_t i = first + q;
+            const Float* query = queries + i * column_count;
+
+            exact.clear();
+            for (const auto& candidate : heaps[q]) {
+                exact.push_back({ squared_euclidean(query,
+                                                    data + candidate.row * column_count,
+                                                    column_count),
+                                  static_cast<std::int32_t>(candidate.row) });
+            }
+            const std::int64_t found_count =
+                std::min<std::int64_t>(exact.size(), neighbor_count);
+            std::partial_sort(exact.begin(), exact.begin() + found_count, exact.end());
+
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                const bool is_found = j < found_count;
+                indices[i * neighbor_count + j] = is_found ? exact[j].row : -1;
+                distances[i * neighbor_count + j] =
+                    is_found ? std::sqrt(exact[j].distance) : std::numeric_limits<Float>::max();
+            }
+        }
+    });
+}
+
+} // namespace oneapi::dal::knn::backend
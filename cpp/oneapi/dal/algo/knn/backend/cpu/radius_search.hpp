@@ -0,0 +1,282 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw.hpp"
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Node of the k-d tree built by the k-d tree training. The leaves have negative
+/// split dimension and hold the rows from :expr:`left` to :expr:`right` of the
+/// permuted training data, the inner nodes hold the indices of their children
+struct kd_tree_node {
+    std::int64_t dimension;
+    std::int64_t left;
+    std::int64_t right;
+    double cut_point;
+};
+
+/// The k-d tree together with the permuted row-major training data, :expr:`indices`
+/// maps the rows of :expr:`data` to the rows of the original training set
+template <typename Float>
+struct kd_tree_view {
+    const kd_tree_node* nodes;
+    std::int64_t root;
+    const Float* data;
+    const std::int32_t* indices;
+    std::int64_t column_count;
+};
+
+/// The neighborhoods of the queries in the CSR layout: the neighbors of the i-th
+/// query occupy the positions from :expr:`offsets[i]` to :expr:`offsets[i + 1]` of
+/// :expr:`indices` and :expr:`distances`, sorted by the distance and then by the index
+template <typename Float>
+struct radius_neighbors {
+    array<std::int64_t> offsets;
+    array<std::int64_t> indices;
+    array<Float> distances;
+    std::int64_t neighbor_count = 0;
+};
+
+template <typename Float>
+struct radius_neighbor {
+    Float distance;
+    std::int64_t index;
+};
+
+template <typename Float>
+inline bool operator<(const radius_neighbor<Float>& a, const radius_neighbor<Float>& b) {
+    return a.distance < b.distance || (a.distance == b.distance && a.index < b.index);
+}
+
+/// Runs :literal:`search_block` over the blocks of queries in parallel and merges its
+/// output into the CSR layout. :literal:`search_block` appends the neighbors of the
+/// queries of the block one query after another to the growable buffer of the thread
+/// and writes their counts, the squared distances are converted to the distances here.
+template <typename Cpu, typename Float, typename SearchBlock>
+radius_neighbors<Float> collect_radius_neighbors(std::int64_t query_count,
+                                                 std::int64_t block_size,
+                                                 const SearchBlock& search_block) {
+    ONEDAL_ASSERT(block_size > 0);
+    const std::int64_t block_count = (query_count + block_size - 1) / block_size;
+    ONEDAL_ASSERT(block_count <= dal::detail::limits<std::int32_t>::max());
+
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    std::vector<std::vector<radius_neighbor<Float>>> buffers(thread_count);
+    std::vector<std::int64_t> block_thread(block_count);
+    std::vector<std::int64_t> block_start(block_count);
+
+    radius_neighbors<Float> result;
+    result.offsets = array<std::int64_t>::zeros(query_count + 1);
+    std::int64_t* const offsets = result.offsets.get_mutable_data();
+    std::int64_t* const counts = offsets + 1;
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * block_size;
+        const std::int64_t last = std::min(first + block_size, query_count);
+        const std::int64_t thread = dal::detail::threader_get_current_thread_index();
+        auto& buffer = buffers[thread];
+
+        block_thread[block] = thread;
+        block_start[block] = buffer.size();
+        search_block(first, last, buffer, counts + first);
+
+        auto begin = buffer.begin() + block_start[block];
+        for (std::int64_t i = first; i < last; ++i) {
+            std::sort(begin, begin + counts[i]);
+            begin += counts[i];
+        }
+    });
+
+    // The parallel prefix sum: the counts are summed inside of the blocks, then
+    // the totals of the preceding blocks are added
+    std::vector<std::int64_t> block_base(block_count + 1, 0);
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * block_size;
+        const std::int64_t last = std::min(first + block_size, query_count);
+        std::int64_t sum = 0;
+        for (std::int64_t i = first; i < last; ++i) {
+            sum += counts[i];
+            counts[i] = sum;
+        }
+        block_base[block + 1] = sum;
+    });
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        block_base[block + 1] += block_base[block];
+    }
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * block_size;
+        const std::int64_t last = std::min(first + block_size, query_count);
+        for (std::int64_t i = first; i < last; ++i) {
+            counts[i] += block_base[block];
+        }
+    });
+
+    result.neighbor_count = offsets[query_count];
+    if (result.neighbor_count == 0) {
+        return result;
+    }
+
+    result.indices = array<std::int64_t>::empty(result.neighbor_count);
+    result.distances = array<Float>::empty(result.neighbor_count);
+    std::int64_t* const indices = result.indices.get_mutable_data();
+    Float* const distances = result.distances.get_mutable_data();
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t first = block * block_size;
+        const std::int64_t last = std::min(first + block_size, query_count);
+        const auto* source = buffers[block_thread[block]].data() + block_start[block];
+        for (std::int64_t i = offsets[first]; i < offsets[last]; ++i, ++source) {
+            indices[i] = source->index;
+            distances[i] = std::sqrt(source->distance);
+        }
+    });
+
+    return result;
+}
+
+/// Finds the training rows at the Euclidean distance not greater than :literal:`radius`
+/// from each query. The queries are processed in blocks, the training rows are scanned
+/// in tiles shared by all the queries of the block.
+template <typename Cpu, typename Float>
+radius_neighbors<Float> radius_search_brute_force(const Float* data,
+                                                  std::int64_t row_count,
+                                                  std::int64_t column_count,
+                                                  const Float* queries,
+                                                  std::int64_t query_count,
+                                                  Float radius) {
+    constexpr std::int64_t query_block_size = 32;
+    constexpr std::int64_t row_tile_size = 256;
+    const Float squared_radius = radius * radius;
+
+    using neighbor_list_t = std::vector<radius_neighbor<Float>>;
+    std::vector<std::vector<neighbor_list_t>> workspaces(dal::detail::threader_get_max_threads());
+
+    return collect_radius_neighbors<Cpu, Float>(
+        query_count,
+        query_block_size,
+        [&](std::int64_t first,
+            std::int64_t last,
+            std::vector<radius_neighbor<Float>>& buffer,
+            std::int64_t* counts) {
+            auto& lists = workspaces[dal::detail::threader_get_current_thread_index()];
+            lists.resize(query_block_size);
+            for (auto& list : lists) {
+                list.clear();
+            }
+
+            for (std::int64_t tile = 0; tile < row_count; tile += row_tile_size) {
+                const std::int64_t tile_end = std::min(tile + row_tile_size, row_count);
+                for (std::int64_t i = first; i < last; ++i) {
+                    const Float* query = queries + i * column_count;
+                    auto& list = lists[i - first];
+                    for (std::int64_t j = tile; j < tile_end; ++j) {
+                        const Float distance =
+                            squared_euclidean(query, data + j * column_count, column_count);
+                        if (distance <= squared_radius) {
+                            list.push_back({ distance, j });
+                        }
+                    }
+                }
+            }
+
+            for (std::int64_t i = first; i < last; ++i) {
+                const auto& list = lists[i - first];
+                buffer.insert(buffer.end(), list.begin(), list.end());
+                counts[i - first] = list.size();
+            }
+        });
+}
+
+template <typename Float>
+struct kd_tree_search_node {
+    std::int64_t node;
+    Float min_distance;
+};
+
+/// Finds the training rows at the Euclidean distance not greater than :literal:`radius`
+/// from each query by the depth-first traversal of the k-d tree. The subtrees which
+/// lower bound of the squared distance to the query exceeds the squared radius are
+/// skipped.
+template <typename Cpu, typename Float>
+radius_neighbors<Float> radius_search_kd_tree(const kd_tree_view<Float>& tree,
+                                              const Float* queries,
+                                              std::int64_t query_count,
+                                              Float radius) {
+    constexpr std::int64_t query_block_size = 64;
+    const Float squared_radius = radius * radius;
+    const std::int64_t column_count = tree.column_count;
+
+    return collect_radius_neighbors<Cpu, Float>(
+        query_count,
+        query_block_size,
+        [&](std::int64_t first,
+            std::int64_t last,
+            std::vector<radius_neighbor<Float>>& buffer,
+            std::int64_t* counts) {
+            std::vector<kd_tree_search_node<Float>> stack;
+            for (std::int64_t i = first; i < last; ++i) {
+                const Float* query = queries + i * column_count;
+                const std::int64_t start = buffer.size();
+
+                stack.clear();
+                stack.push_back({ tree.root, Float(0) });
+                while (!stack.empty()) {
+                    const auto current = stack.back();
+                    stack.pop_back();
+                    if (current.min_distance > squared_radius) {
+                        continue;
+                    }
+
+                    const kd_tree_node* node = tree.nodes + current.node;
+                    while (node->dimension >= 0) {
+                        const Float diff = query[node->dimension] - Float(node->cut_point);
+                        const std::int64_t near = (diff < 0) ? node->left : node->right;
+                        const std::int64_t far = (diff < 0) ? node->right : node->left;
+
+                        // All the rows of the far subtree are at least |diff| away along the
+                        // split dimension. The maximum is taken instead of the sum used by
+                        // the k nearest neighbors search to keep the bound valid when the
+                        // same dimension is split several times on the path
+                        const Float far_distance = std::max(current.min_distance, diff * diff);
+                        if (far_distance <= squared_radius) {
+                            stack.push_back({ far, far_distance });
+                        }
+                        node = tree.nodes + near;
+                    }
+
+                    for (std::int64_t j = node->left; j < node->right; ++j) {
+                        const Float distance =
+                            squared_euclidean(query, tree.data + j * column_count, column_count);
+                        if (distance <= squared_radius) {
+                            buffer.push_back({ distance, tree.indices[j] });
+                        }
+                    }
+                }
+                counts[i - first] = buffer.size() - start;
+            }
+        });
+}
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/radius_search.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+template radius_neighbors<float> radius_search_brute_force<__CPU_TAG__, float>(
+    const float* data,
+    std::int64_t row_count,
+    std::int64_t column_count,
+    const float* queries,
+    std::int64_t query_count,
+    float radius);
+
+template radius_neighbors<double> radius_search_brute_force<__CPU_TAG__, double>(
+    const double* data,
+    std::int64_t row_count,
+    std::int64_t column_count,
+    const double* queries,
+    std::int64_t query_count,
+    double radius);
+
+template radius_neighbors<float> radius_search_kd_tree<__CPU_TAG__, float>(
+    const kd_tree_view<float>& tree,
+    const float* queries,
+    std::int64_t query_count,
+    float radius);
+
+template radius_neighbors<double> radius_search_kd_tree<__CPU_TAG__, double>(
+    const kd_tree_view<double>& tree,
+    const double* queries,
+    std::int64_t query_count,
+    double radius);
+
+} // namespace oneapi::dal::knn::backend
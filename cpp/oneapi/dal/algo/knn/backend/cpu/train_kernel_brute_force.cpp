@@ -18,10 +18,13 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
+#include "oneapi/dal/algo/knn/backend/cpu/incremental.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/quantized_search.hpp"
 #include "oneapi/dal/algo/knn/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/algo/knn/backend/distance_impl.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 
+#include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 #include <daal/src/algorithms/k_nearest_neighbors/bf_knn_classification_train_kernel.h>
 #include <algorithms/k_nearest_neighbors/bf_knn_classification_model.h>
@@ -59,7 +62,7 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
     model_ptr->impl()->setData<Float>(daal_data, false);
 
     auto daal_responses = daal::data_management::NumericTablePtr();
-    if constexpr (!std::is_same_v<Task, task::search>) {
+    if constexpr (std::is_same_v<Task, task::classification>) {
         daal_responses = interop::convert_to_daal_table<Float>(responses);
         model_ptr->impl()->setLabels<Float>(daal_responses, false);
     }
@@ -78,10 +81,107 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
         dal::detail::make_private<model<Task>>(model_impl_interop));
 }
 
+inline void check_compression_distance(const detail::descriptor_base<task::search>& desc) {
+    auto distance_impl = detail::get_distance_impl(desc);
+    if (!distance_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_distance_type() };
+    }
+    else if (distance_impl->get_daal_distance_type() != detail::v1::daal_distance_t::minkowski ||
+             distance_impl->get_degree() != 2.0) {
+        throw internal_error{
+            dal::detail::error_messages::distance_is_not_supported_for_compression()
+        };
+    }
+}
+
+template <typename Float>
+static train_result<task::search> train_quantized(const context_cpu& ctx,
+                                                  const detail::descriptor_base<task::search>& desc,
+                                                  const table& data) {
+    check_compression_distance(desc);
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (row_count > dal::detail::limits<std::int32_t>::max()) {
+        throw domain_error(dal::detail::error_messages::row_count_gt_max_int32());
+    }
+
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+
+    const auto impl = std::make_shared<model_impl<task::search>>();
+    auto& index = impl->quantized;
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        build_quantized_index<decltype(cpu)>(arr_data.get_data(), row_count, column_count, index);
+    });
+    index.data =
+        dal::detail::homogen_table_builder{}.reset(arr_data, row_count, column_count).build();
+
+    return train_result<task::search>().set_model(
+        dal::detail::make_private<model<task::search>>(impl));
+}
+
+inline void check_incremental_distance(const detail::descriptor_base<task::search>& desc) {
+    auto distance_impl = detail::get_distance_impl(desc);
+    if (!distance_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_distance_type() };
+    }
+    else if (distance_impl->get_daal_distance_type() != detail::v1::daal_distance_t::minkowski ||
+             distance_impl->get_degree() != 2.0) {
+        throw internal_error{
+            dal::detail::error_messages::distance_is_not_supported_for_incremental_training()
+        };
+    }
+}
+
+template <typename Float>
+static train_result<task::search> append_to_model(
+    const context_cpu& ctx,
+    const detail::descriptor_base<task::search>& desc,
+    const train_input<task::search>& input) {
+    if (desc.get_compression() != compression::none) {
+        throw invalid_argument(
+            dal::detail::error_messages::knn_incremental_training_is_not_supported_by_method());
+    }
+    check_incremental_distance(desc);
+
+    const auto base_interop = dal::detail::get_impl(input.get_model()).get_interop();
+    const auto daal_model =
+        base_interop ? dynamic_cast<daal_knn::Model*>(base_interop->get_daal_model().get())
+                     : nullptr;
+    if (!daal_model) {
+        throw invalid_argument(dal::detail::error_messages::input_model_does_not_match_method());
+    }
+
+    const auto daal_data = daal_model->impl()->getData();
+    return train_incremental<Float>(
+        desc,
+        input,
+        base_interop,
+        dal::detail::integral_cast<std::int64_t>(daal_data->getNumberOfRows()),
+        dal::detail::integral_cast<std::int64_t>(daal_data->getNumberOfColumns()),
+        [&]() {
+            return interop::convert_from_daal_homogen_table<Float>(daal_data);
+        },
+        [&](const table& data) {
+            return call_daal_kernel<Float, task::search>(ctx, desc, data, table{});
+        });
+}
+
 template <typename Float, typename Task>
 static train_result<Task> train(const context_cpu& ctx,
                                 const detail::descriptor_base<Task>& desc,
                                 const train_input<Task>& input) {
+    if constexpr (std::is_same_v<Task, task::search>) {
+        if (!dal::detail::get_impl(input.get_model()).is_empty()) {
+            return append_to_model<Float>(ctx, desc, input);
+        }
+        if (!input.get_data().has_data()) {
+            throw domain_error(dal::detail::error_messages::input_data_is_empty());
+        }
+        if (desc.get_compression() == compression::int8) {
+            return train_quantized<Float>(ctx, desc, input.get_data());
+        }
+    }
     return call_daal_kernel<Float, Task>(ctx, desc, input.get_data(), input.get_responses());
 }
 
@@ -98,5 +198,7 @@ template struct train_kernel_cpu<float, method::brute_force, task::classificatio
 template struct train_kernel_cpu<double, method::brute_force, task::classification>;
 template struct train_kernel_cpu<float, method::brute_force, task::search>;
 template struct train_kernel_cpu<double, method::brute_force, task::search>;
+template struct train_kernel_cpu<float, method::brute_force, task::radius_search>;
+template struct train_kernel_cpu<double, method::brute_force, task::radius_search>;
 
 } // namespace oneapi::dal::knn::backend
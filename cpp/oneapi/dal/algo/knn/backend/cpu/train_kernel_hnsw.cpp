@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw.hpp"
+#include "oneapi/dal/algo/knn/backend/distance_impl.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+inline void check_hnsw_distance(const detail::descriptor_base<task::search>& desc) {
+    auto distance_impl = detail::get_distance_impl(desc);
+    if (!distance_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_distance_type() };
+    }
+    else if (distance_impl->get_daal_distance_type() != detail::v1::daal_distance_t::minkowski ||
+             distance_impl->get_degree() != 2.0) {
+        throw internal_error{ dal::detail::error_messages::distance_is_not_supported_for_hnsw() };
+    }
+}
+
+template <typename Float>
+static train_result<task::search> train(const context_cpu& ctx,
+                                        const detail::descriptor_base<task::search>& desc,
+                                        const train_input<task::search>& input) {
+    check_hnsw_distance(desc);
+    if (!dal::detail::get_impl(input.get_model()).is_empty()) {
+        throw invalid_argument(
+            dal::detail::error_messages::knn_incremental_training_is_not_supported_by_method());
+    }
+
+    const table& data = input.get_data();
+    if (!data.has_data()) {
+        throw domain_error(dal::detail::error_messages::input_data_is_empty());
+    }
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (row_count > dal::detail::limits<std::int32_t>::max()) {
+        throw domain_error(dal::detail::error_messages::row_count_gt_max_int32());
+    }
+
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+
+    const auto impl = std::make_shared<model_impl<task::search>>();
+    auto& index = impl->hnsw;
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        build_hnsw<decltype(cpu)>(arr_data.get_data(),
+                                  row_count,
+                                  column_count,
+                                  desc.get_max_degree(),
+                                  desc.get_construction_breadth(),
+                                  index);
+    });
+    index.data =
+        dal::detail::homogen_table_builder{}.reset(arr_data, row_count, column_count).build();
+
+    return train_result<task::search>().set_model(
+        dal::detail::make_private<model<task::search>>(impl));
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::hnsw, task::search> {
+    train_result<task::search> operator()(const context_cpu& ctx,
+                                          const detail::descriptor_base<task::search>& desc,
+                                          const train_input<task::search>& input) const {
+        return train<Float>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::hnsw, task::search>;
+template struct train_kernel_cpu<double, method::hnsw, task::search>;
+
+} // namespace oneapi::dal::knn::backend
@@ -17,6 +17,7 @@
 #include <daal/src/algorithms/k_nearest_neighbors/kdtree_knn_classification_train_kernel.h>
 #include <src/algorithms/k_nearest_neighbors/kdtree_knn_classification_model_impl.h>
 
+#include "oneapi/dal/algo/knn/backend/cpu/incremental.hpp"
 #include "oneapi/dal/algo/knn/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
@@ -65,7 +66,7 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
     knn_model->impl()->setData<Float>(daal_data, copy_data_responses);
 
     auto daal_responses = daal::data_management::NumericTablePtr();
-    if constexpr (!std::is_same_v<Task, task::search>) {
+    if constexpr (std::is_same_v<Task, task::classification>) {
         daal_responses = interop::copy_to_daal_homogen_table<Float>(responses);
         knn_model->impl()->setLabels<Float>(daal_responses, copy_data_responses);
     }
@@ -83,10 +84,73 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
         dal::detail::make_private<model<Task>>(model_impl_interop));
 }
 
+template <typename Float>
+static train_result<task::search> append_to_model(
+    const context_cpu& ctx,
+    const detail::descriptor_base<task::search>& desc,
+    const train_input<task::search>& input) {
+    const auto base_interop = dal::detail::get_impl(input.get_model()).get_interop();
+    const auto daal_model =
+        base_interop ? dynamic_cast<daal_knn::Model*>(base_interop->get_daal_model().get())
+                     : nullptr;
+    if (!daal_model) {
+        throw invalid_argument(dal::detail::error_messages::input_model_does_not_match_method());
+    }
+
+    const auto daal_model_impl = daal_model->impl();
+    const auto daal_data = daal_model_impl->getData();
+    const auto daal_indices = daal_model_impl->getIndices();
+    const std::int64_t row_count =
+        dal::detail::integral_cast<std::int64_t>(daal_data->getNumberOfRows());
+    const std::int64_t column_count =
+        dal::detail::integral_cast<std::int64_t>(daal_data->getNumberOfColumns());
+
+    // The k-d tree keeps the training rows permuted, the row j of its data is the
+    // row indices[j] of the original training set
+    const auto get_base_rows = [&]() {
+        const table model_data = interop::convert_from_daal_homogen_table<Float>(daal_data);
+        const table model_indices =
+            interop::convert_from_daal_homogen_table<std::int32_t>(daal_indices);
+        const auto arr_data = row_accessor<const Float>{ model_data }.pull();
+        const auto arr_indices = row_accessor<const std::int32_t>{ model_indices }.pull();
+        const Float* data = arr_data.get_data();
+        const std::int32_t* indices = arr_indices.get_data();
+
+        auto arr_rows = array<Float>::empty(row_count * column_count);
+        Float* rows = arr_rows.get_mutable_data();
+        for (std::int64_t j = 0; j < row_count; ++j) {
+            std::copy(data + j * column_count,
+                      data + (j + 1) * column_count,
+                      rows + indices[j] * column_count);
+        }
+        return dal::detail::homogen_table_builder{}
+            .reset(arr_rows, row_count, column_count)
+            .build();
+    };
+
+    return train_incremental<Float>(desc,
+                                    input,
+                                    base_interop,
+                                    row_count,
+                                    column_count,
+                                    get_base_rows,
+                                    [&](const table& data) {
+                                        return call_daal_kernel<Float>(ctx, desc, data, table{});
+                                    });
+}
+
 template <typename Float, typename Task>
 static train_result<Task> train(const context_cpu& ctx,
                                 const detail::descriptor_base<Task>& desc,
                                 const train_input<Task>& input) {
+    if constexpr (std::is_same_v<Task, task::search>) {
+        if (!dal::detail::get_impl(input.get_model()).is_empty()) {
+            return append_to_model<Float>(ctx, desc, input);
+        }
+        if (!input.get_data().has_data()) {
+            throw domain_error(dal::detail::error_messages::input_data_is_empty());
+        }
+    }
     return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_responses());
 }
 
@@ -103,5 +167,7 @@ template struct train_kernel_cpu<float, method::kd_tree, task::classification>;
 template struct train_kernel_cpu<double, method::kd_tree, task::classification>;
 template struct train_kernel_cpu<float, method::kd_tree, task::search>;
 template struct train_kernel_cpu<double, method::kd_tree, task::search>;
+template struct train_kernel_cpu<float, method::kd_tree, task::radius_search>;
+template struct train_kernel_cpu<double, method::kd_tree, task::radius_search>;
 
 } // namespace oneapi::dal::knn::backend
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/detail/serialization.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Rows appended to the model by the incremental training that are not merged into
+/// the search structure yet. The search structure holds `base_row_count` rows, the
+/// row `i` of `data` has the index `base_row_count + i`
+class delta_buffer {
+    friend dal::detail::serialization_accessor;
+
+public:
+    table data;
+    std::int64_t base_row_count = 0;
+
+    bool is_empty() const {
+        return data.get_row_count() == 0;
+    }
+
+private:
+    void serialize(dal::detail::output_archive& ar) const {
+        ar(data, base_row_count);
+    }
+
+    void deserialize(dal::detail::input_archive& ar) {
+        ar(data, base_row_count);
+    }
+};
+
+} // namespace oneapi::dal::knn::backend
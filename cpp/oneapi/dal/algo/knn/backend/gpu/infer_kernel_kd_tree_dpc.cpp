@@ -41,5 +41,7 @@ template struct infer_kernel_gpu<float, method::kd_tree, task::classification>;
 template struct infer_kernel_gpu<double, method::kd_tree, task::classification>;
 template struct infer_kernel_gpu<float, method::kd_tree, task::search>;
 template struct infer_kernel_gpu<double, method::kd_tree, task::search>;
+template struct infer_kernel_gpu<float, method::kd_tree, task::radius_search>;
+template struct infer_kernel_gpu<double, method::kd_tree, task::radius_search>;
 
 } // namespace oneapi::dal::knn::backend
@@ -38,5 +38,7 @@ template struct train_kernel_gpu<float, method::kd_tree, task::classification>;
 template struct train_kernel_gpu<double, method::kd_tree, task::classification>;
 template struct train_kernel_gpu<float, method::kd_tree, task::search>;
 template struct train_kernel_gpu<double, method::kd_tree, task::search>;
+template struct train_kernel_gpu<float, method::kd_tree, task::radius_search>;
+template struct train_kernel_gpu<double, method::kd_tree, task::radius_search>;
 
 } // namespace oneapi::dal::knn::backend
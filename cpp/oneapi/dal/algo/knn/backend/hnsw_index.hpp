@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/detail/serialization.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Marks of the rows visited by the graph traversal. The row is visited in the
+/// current traversal if its tag equals to the epoch, so the marks are cleared by
+/// the increment of the epoch rather than by the pass over all the rows
+class hnsw_visited_set {
+public:
+    void resize(std::int64_t row_count) {
+        if (static_cast<std::int64_t>(tags_.size()) < row_count) {
+            tags_.resize(row_count, 0);
+        }
+    }
+
+    void clear() {
+        if (++epoch_ == 0) {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    /// Marks the row, returns false if it is already visited
+    bool insert(std::int32_t row) {
+        if (tags_[row] == epoch_) {
+            return false;
+        }
+        tags_[row] = epoch_;
+        return true;
+    }
+
+private:
+    std::vector<std::uint32_t> tags_;
+    std::uint32_t epoch_ = 0;
+};
+
+/// The visited sets released by the finished traversals of the index. The threads
+/// of the next searches take them, so the buffers of all the rows are allocated
+/// once per thread instead of once per thread and search
+class hnsw_visited_pool {
+public:
+    std::unique_ptr<hnsw_visited_set> acquire(std::int64_t row_count) {
+        std::unique_ptr<hnsw_visited_set> set;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!sets_.empty()) {
+                set = std::move(sets_.back());
+                sets_.pop_back();
+            }
+        }
+        if (!set) {
+            set.reset(new hnsw_visited_set);
+        }
+        set->resize(row_count);
+        return set;
+    }
+
+    void release(std::unique_ptr<hnsw_visited_set> set) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sets_.push_back(std::move(set));
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<hnsw_visited_set>> sets_;
+};
+
+/// Proximity graph of the HNSW method. Links of all the levels are kept in the
+/// single flat array: the row `i` owns `2 * max_degree` slots of the bottom level
+/// followed by `max_degree` slots for each of its upper levels starting at
+/// `link_offsets[i]`. The unused slots are filled with -1
+class hnsw_index {
+    friend dal::detail::serialization_accessor;
+
+public:
+    table data;
+    array<std::int32_t> levels;
+    array<std::int64_t> link_offsets;
+    array<std::int32_t> links;
+    std::int64_t max_degree = 0;
+    std::int64_t entry_point = -1;
+    std::int64_t max_level = -1;
+    /// Not serialized, the visited sets are cached by the search
+    std::shared_ptr<hnsw_visited_pool> visited_pool = std::make_shared<hnsw_visited_pool>();
+
+    bool is_empty() const {
+        return entry_point < 0;
+    }
+
+private:
+    void serialize(dal::detail::output_archive& ar) const {
+        ar(data, levels, link_offsets, links, max_degree, entry_point, max_level);
+    }
+
+    void deserialize(dal::detail::input_archive& ar) {
+        ar(data, levels, link_offsets, links, max_degree, entry_point, max_level);
+    }
+};
+
+} // namespace oneapi::dal::knn::backend
@@ -18,12 +18,29 @@
 
 #include "oneapi/dal/algo/knn/common.hpp"
 #include "oneapi/dal/algo/knn/backend/model_interop.hpp"
+#include "oneapi/dal/algo/knn/backend/delta_buffer.hpp"
+#include "oneapi/dal/algo/knn/backend/hnsw_index.hpp"
+#include "oneapi/dal/algo/knn/backend/quantized_index.hpp"
+#include "oneapi/dal/backend/serialization.hpp"
 
 namespace oneapi::dal::knn {
 
+#define KNN_SERIALIZABLE(Task, ClassificationId, SearchId, RadiusSearchId) \
+    ONEDAL_SERIALIZABLE_MAP3(Task,                                         \
+                             (task::classification, ClassificationId),     \
+                             (task::search, SearchId),                     \
+                             (task::radius_search, RadiusSearchId))
+
 template <typename Task>
-class detail::v1::model_impl : public base {
+class detail::v1::model_impl : public KNN_SERIALIZABLE(Task,
+                                                       knn_classification_model_impl_id,
+                                                       knn_search_model_impl_id,
+                                                       knn_radius_search_model_impl_id) {
 public:
+    backend::hnsw_index hnsw;
+    backend::quantized_index quantized;
+    backend::delta_buffer delta;
+
     model_impl() : interop_(nullptr) {}
     model_impl(const model_impl&) = delete;
     model_impl& operator=(const model_impl&) = delete;
@@ -39,6 +56,21 @@ public:
         return interop_;
     }
 
+    /// Whether the model holds no search structure, as the default constructed one
+    bool is_empty() const {
+        return !interop_ && hnsw.is_empty() && quantized.is_empty();
+    }
+
+    void serialize(dal::detail::output_archive& ar) const override {
+        ar(hnsw, quantized, delta);
+        dal::detail::serialize_polymorphic(interop_, ar);
+    }
+
+    void deserialize(dal::detail::input_archive& ar) override {
+        ar(hnsw, quantized, delta);
+        interop_ = dal::detail::deserialize_polymorphic<backend::model_interop>(ar);
+    }
+
 private:
     backend::model_interop* interop_;
 };
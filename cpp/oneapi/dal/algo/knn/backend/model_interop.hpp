@@ -20,6 +20,8 @@
 #include <daal/include/algorithms/k_nearest_neighbors/bf_knn_classification_model.h>
 #include <daal/include/algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h>
 #include "oneapi/dal/algo/knn/common.hpp"
+#include "oneapi/dal/backend/serialization.hpp"
+#include "oneapi/dal/backend/interop/archive.hpp"
 
 namespace oneapi::dal::knn::backend {
 
@@ -34,10 +36,11 @@ inline auto convert_to_daal_kdtree_voting_mode(voting_mode vm) {
                                       : daal_kdtree_knn::voteDistance;
 }
 
-class model_interop : public base {
+class model_interop : public ONEDAL_SERIALIZABLE(knn_model_interop_id) {
 public:
     using DaalModel = daal::algorithms::classifier::ModelPtr;
 
+    model_interop() = default;
     model_interop(const DaalModel& daal_model) : daal_model_(daal_model) {}
 
     void set_daal_model(const DaalModel& model) {
@@ -48,6 +51,16 @@ public:
         return daal_model_;
     }
 
+    void serialize(dal::detail::output_archive& ar) const override {
+        dal::backend::interop::daal_output_data_archive daal_ar(ar);
+        daal_ar.setSharedPtrObj(const_cast<DaalModel&>(daal_model_));
+    }
+
+    void deserialize(dal::detail::input_archive& ar) override {
+        dal::backend::interop::daal_input_data_archive daal_ar(ar);
+        daal_ar.setSharedPtrObj(daal_model_);
+    }
+
 private:
     DaalModel daal_model_;
 };
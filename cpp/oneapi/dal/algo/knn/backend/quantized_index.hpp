@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/detail/serialization.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// Training data of the brute-force search scalar-quantized to 8 bits per feature.
+/// The code of the feature `j` of the row `i` is the nearest integer to
+/// `(x_ij - offsets[j]) / scales[j]` in the range [0, 255]. The `row_norms` keep
+/// the squared norms of the codes weighted by the squared scales, the original rows
+/// are kept in `data` for the re-ranking
+class quantized_index {
+    friend dal::detail::serialization_accessor;
+
+public:
+    table data;
+    array<std::uint8_t> codes;
+    array<float> scales;
+    array<float> offsets;
+    array<float> row_norms;
+
+    bool is_empty() const {
+        return codes.get_count() == 0;
+    }
+
+private:
+    void serialize(dal::detail::output_archive& ar) const {
+        ar(data, codes, scales, offsets, row_norms);
+    }
+
+    void deserialize(dal::detail::input_archive& ar) {
+        ar(data, codes, scales, offsets, row_norms);
+    }
+};
+
+} // namespace oneapi::dal::knn::backend
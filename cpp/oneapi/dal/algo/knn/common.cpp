@@ -30,6 +30,13 @@ public:
     std::int64_t class_count = 2;
     std::int64_t neighbor_count = 1;
     voting_mode voting_mode_value = voting_mode::uniform;
+    std::int64_t max_degree = 16;
+    std::int64_t construction_breadth = 100;
+    std::int64_t search_breadth = 64;
+    double radius = 1.0;
+    compression compression_value = compression::none;
+    std::int64_t rerank_factor = 4;
+    std::int64_t max_delta_row_count = 65536;
     detail::distance_ptr distance;
 };
 
@@ -79,6 +86,94 @@ void descriptor_base<Task>::set_voting_mode_impl(voting_mode value) {
     impl_->voting_mode_value = value;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_max_degree() const {
+    return impl_->max_degree;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_max_degree_impl(std::int64_t value) {
+    if (value < 2) {
+        throw domain_error(dal::detail::error_messages::max_degree_leq_one());
+    }
+    impl_->max_degree = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_construction_breadth() const {
+    return impl_->construction_breadth;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_construction_breadth_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::construction_breadth_lt_one());
+    }
+    impl_->construction_breadth = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_search_breadth() const {
+    return impl_->search_breadth;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_search_breadth_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::search_breadth_lt_one());
+    }
+    impl_->search_breadth = value;
+}
+
+template <typename Task>
+double descriptor_base<Task>::get_radius() const {
+    return impl_->radius;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_radius_impl(double value) {
+    if (value < 0.0) {
+        throw domain_error(dal::detail::error_messages::radius_lt_zero());
+    }
+    impl_->radius = value;
+}
+
+template <typename Task>
+compression descriptor_base<Task>::get_compression() const {
+    return impl_->compression_value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_compression_impl(compression value) {
+    impl_->compression_value = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_rerank_factor() const {
+    return impl_->rerank_factor;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_rerank_factor_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::rerank_factor_lt_one());
+    }
+    impl_->rerank_factor = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_max_delta_row_count() const {
+    return impl_->max_delta_row_count;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_max_delta_row_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error(dal::detail::error_messages::max_delta_row_count_lt_zero());
+    }
+    impl_->max_delta_row_count = value;
+}
+
 template <typename Task>
 const detail::distance_ptr& descriptor_base<Task>::get_distance_impl() const {
     return impl_->distance;
@@ -91,6 +186,7 @@ void descriptor_base<Task>::set_distance_impl(const detail::distance_ptr& distan
 
 template class ONEDAL_EXPORT descriptor_base<task::classification>;
 template class ONEDAL_EXPORT descriptor_base<task::search>;
+template class ONEDAL_EXPORT descriptor_base<task::radius_search>;
 
 } // namespace v1
 } // namespace detail
@@ -105,8 +201,24 @@ model<Task>::model() : impl_(new model_impl<Task>{}) {}
 template <typename Task>
 model<Task>::model(const std::shared_ptr<detail::model_impl<Task>>& impl) : impl_(impl) {}
 
+template <typename Task>
+void model<Task>::serialize(dal::detail::output_archive& ar) const {
+    dal::detail::serialize_polymorphic_shared(impl_, ar);
+}
+
+template <typename Task>
+void model<Task>::deserialize(dal::detail::input_archive& ar) {
+    dal::detail::deserialize_polymorphic_shared(impl_, ar);
+}
+
 template class ONEDAL_EXPORT model<task::classification>;
 template class ONEDAL_EXPORT model<task::search>;
+template class ONEDAL_EXPORT model<task::radius_search>;
+
+ONEDAL_REGISTER_SERIALIZABLE(model_impl<task::classification>)
+ONEDAL_REGISTER_SERIALIZABLE(model_impl<task::search>)
+ONEDAL_REGISTER_SERIALIZABLE(model_impl<task::radius_search>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::model_interop)
 
 } // namespace v1
 } // namespace oneapi::dal::knn
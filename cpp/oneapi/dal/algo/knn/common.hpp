@@ -17,6 +17,7 @@
 #pragma once
 
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/serialization.hpp"
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/algo/knn/detail/distance.hpp"
 
@@ -30,9 +31,19 @@ enum class voting_mode {
     /// Weight neighbors by the inverse of their distance.
     distance
 };
+
+/// Representation of the training data scanned by the brute-force search
+enum class compression {
+    /// The training data is scanned as is.
+    none,
+    /// The training data is scalar-quantized to 8 bits per feature. The nearest
+    /// candidates found on the quantized data are re-ranked on the original one.
+    int8
+};
 } // namespace v1
 
 using v1::voting_mode;
+using v1::compression;
 
 namespace task {
 namespace v1 {
@@ -41,12 +52,17 @@ namespace v1 {
 struct classification {};
 struct search {};
 
+/// Tag-type that parameterizes entities used for finding all the training points
+/// that lie within the given radius of each query point.
+struct radius_search {};
+
 /// Alias tag-type for classification task.
 using by_default = classification;
 } // namespace v1
 
 using v1::classification;
 using v1::search;
+using v1::radius_search;
 using v1::by_default;
 
 } // namespace task
@@ -60,6 +76,11 @@ struct kd_tree {};
 /// method.
 struct brute_force {};
 
+/// Tag-type that denotes the approximate search in the hierarchical navigable
+/// small world graph built over the training data. Used with :expr:`task::search`
+/// and Euclidean distance only.
+struct hnsw {};
+
 /// Alias tag-type for :ref:`brute-force <knn_t_math_brute_force>` computational
 /// method.
 using by_default = brute_force;
@@ -67,6 +88,7 @@ using by_default = brute_force;
 
 using v1::kd_tree;
 using v1::brute_force;
+using v1::hnsw;
 using v1::by_default;
 
 } // namespace method
@@ -85,10 +107,11 @@ constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>
 
 template <typename Method>
 constexpr bool is_valid_method_v =
-    dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force>;
+    dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force, method::hnsw>;
 
 template <typename Task>
-constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::classification, task::search>;
+constexpr bool is_valid_task_v =
+    dal::detail::is_one_of_v<Task, task::classification, task::search, task::radius_search>;
 
 template <typename Distance>
 constexpr bool is_valid_distance_v =
@@ -100,6 +123,10 @@ constexpr bool is_valid_distance_v =
 template <typename T>
 using enable_if_search_t = std::enable_if_t<std::is_same_v<std::decay_t<T>, task::search>>;
 
+template <typename T>
+using enable_if_radius_search_t =
+    std::enable_if_t<std::is_same_v<std::decay_t<T>, task::radius_search>>;
+
 template <typename T>
 using enable_if_classification_t =
     std::enable_if_t<std::is_same_v<std::decay_t<T>, task::classification>>;
@@ -108,6 +135,14 @@ template <typename T>
 using enable_if_brute_force_t =
     std::enable_if_t<std::is_same_v<std::decay_t<T>, method::brute_force>>;
 
+template <typename M, typename T>
+using enable_if_brute_force_search_t =
+    std::enable_if_t<std::is_same_v<std::decay_t<M>, method::brute_force> &&
+                     std::is_same_v<std::decay_t<T>, task::search>>;
+
+template <typename T>
+using enable_if_hnsw_t = std::enable_if_t<std::is_same_v<std::decay_t<T>, method::hnsw>>;
+
 template <typename Task = task::by_default>
 class descriptor_base : public base {
     static_assert(is_valid_task_v<Task>);
@@ -125,6 +160,13 @@ public:
     std::int64_t get_class_count() const;
     std::int64_t get_neighbor_count() const;
     voting_mode get_voting_mode() const;
+    std::int64_t get_max_degree() const;
+    std::int64_t get_construction_breadth() const;
+    std::int64_t get_search_breadth() const;
+    double get_radius() const;
+    compression get_compression() const;
+    std::int64_t get_rerank_factor() const;
+    std::int64_t get_max_delta_row_count() const;
 
 protected:
     explicit descriptor_base(const detail::distance_ptr& distance);
@@ -132,6 +174,13 @@ protected:
     void set_class_count_impl(std::int64_t value);
     void set_neighbor_count_impl(std::int64_t value);
     void set_voting_mode_impl(voting_mode value);
+    void set_max_degree_impl(std::int64_t value);
+    void set_construction_breadth_impl(std::int64_t value);
+    void set_search_breadth_impl(std::int64_t value);
+    void set_radius_impl(double value);
+    void set_compression_impl(compression value);
+    void set_rerank_factor_impl(std::int64_t value);
+    void set_max_delta_row_count_impl(std::int64_t value);
     void set_distance_impl(const detail::distance_ptr& distance);
     const detail::distance_ptr& get_distance_impl() const;
 
@@ -151,8 +200,11 @@ using v1::is_valid_method_v;
 using v1::is_valid_task_v;
 using v1::is_valid_distance_v;
 using v1::enable_if_search_t;
+using v1::enable_if_radius_search_t;
 using v1::enable_if_classification_t;
 using v1::enable_if_brute_force_t;
+using v1::enable_if_brute_force_search_t;
+using v1::enable_if_hnsw_t;
 
 } // namespace detail
 
@@ -162,9 +214,11 @@ namespace v1 {
 ///                     intermediate computations. Can be :expr:`float` or
 ///                     :expr:`double`.
 /// @tparam Method      Tag-type that specifies an implementation of algorithm. Can
-///                     be :expr:`method::brute_force` or :expr:`method::kd_tree`.
+///                     be :expr:`method::brute_force`, :expr:`method::kd_tree` or
+///                     :expr:`method::hnsw`.
 /// @tparam Task        Tag-type that specifies type of the problem to solve. Can
-///                     be :expr:`task::classification`.
+///                     be :expr:`task::classification`, :expr:`task::search` or
+///                     :expr:`task::radius_search`.
 /// @tparam Distance    The descriptor of the distance used for computations. Can be
 ///                     :expr:`minkowski_distance::descriptor` or
 ///                     :expr:`chebyshev_distance::descriptor`
@@ -179,6 +233,8 @@ class descriptor : public detail::descriptor_base<Task> {
     static_assert(detail::is_valid_distance_v<Distance>,
                   "Custom distances for kNN is not supported. "
                   "Use one of the predefined distances.");
+    static_assert(!std::is_same_v<Method, method::hnsw> || std::is_same_v<Task, task::search>,
+                  "HNSW method supports only the search task");
 
     using base_t = detail::descriptor_base<Task>;
 
@@ -217,6 +273,15 @@ public:
         set_neighbor_count(neighbor_count);
     }
 
+    /// Creates a new instance of the class with the given :literal:`radius`
+    /// property value.
+    /// Used with :expr:`task::radius_search` only.
+    template <typename T = Task, typename = detail::enable_if_radius_search_t<T>>
+    explicit descriptor(double radius)
+            : base_t(std::make_shared<detail::distance<distance_t>>(distance_t{})) {
+        set_radius(radius);
+    }
+
     /// The number of classes c
     /// @invariant :expr:`class_count > 1`
     std::int64_t get_class_count() const {
@@ -262,20 +327,145 @@ public:
         base_t::set_distance_impl(std::make_shared<detail::distance<distance_t>>(dist));
         return *this;
     }
+
+    /// The representation of the training data scanned by the search.
+    /// Used with :expr:`method::brute_force` and :expr:`task::search` only.
+    /// @remark default = compression::none
+    template <typename M = Method,
+              typename T = Task,
+              typename = detail::enable_if_brute_force_search_t<M, T>>
+    compression get_compression() const {
+        return base_t::get_compression();
+    }
+
+    template <typename M = Method,
+              typename T = Task,
+              typename = detail::enable_if_brute_force_search_t<M, T>>
+    auto& set_compression(compression value) {
+        base_t::set_compression_impl(value);
+        return *this;
+    }
+
+    /// The number of candidates per neighbor found on the compressed training data
+    /// and re-ranked by the exact distances, :expr:`neighbor_count * rerank_factor`
+    /// candidates are kept for each query. Used with :expr:`compression::int8` only.
+    /// @remark default = 4
+    /// @invariant :expr:`rerank_factor > 0`
+    template <typename M = Method,
+              typename T = Task,
+              typename = detail::enable_if_brute_force_search_t<M, T>>
+    std::int64_t get_rerank_factor() const {
+        return base_t::get_rerank_factor();
+    }
+
+    template <typename M = Method,
+              typename T = Task,
+              typename = detail::enable_if_brute_force_search_t<M, T>>
+    auto& set_rerank_factor(std::int64_t value) {
+        base_t::set_rerank_factor_impl(value);
+        return *this;
+    }
+
+    /// The maximum number of rows appended to the model by the incremental training
+    /// that are kept apart from the search structure and scanned by the brute force.
+    /// The incremental training that exceeds it merges the appended rows into the
+    /// rebuilt search structure. Used with :expr:`task::search` only.
+    /// @remark default = 65536
+    /// @invariant :expr:`max_delta_row_count >= 0`
+    template <typename T = Task, typename = detail::enable_if_search_t<T>>
+    std::int64_t get_max_delta_row_count() const {
+        return base_t::get_max_delta_row_count();
+    }
+
+    template <typename T = Task, typename = detail::enable_if_search_t<T>>
+    auto& set_max_delta_row_count(std::int64_t value) {
+        base_t::set_max_delta_row_count_impl(value);
+        return *this;
+    }
+
+    /// The maximum number of links of a training point on the upper layers of the
+    /// graph, the bottom layer keeps twice as many links.
+    /// Used with :expr:`method::hnsw` only.
+    /// @remark default = 16
+    /// @invariant :expr:`max_degree > 1`
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_max_degree() const {
+        return base_t::get_max_degree();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_max_degree(std::int64_t value) {
+        base_t::set_max_degree_impl(value);
+        return *this;
+    }
+
+    /// The number of candidate neighbors tracked while a training point is linked
+    /// into the graph. Larger values build a more accurate graph slower.
+    /// Used with :expr:`method::hnsw` only.
+    /// @remark default = 100
+    /// @invariant :expr:`construction_breadth > 0`
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_construction_breadth() const {
+        return base_t::get_construction_breadth();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_construction_breadth(std::int64_t value) {
+        base_t::set_construction_breadth_impl(value);
+        return *this;
+    }
+
+    /// The number of candidate neighbors tracked while a query is searched.
+    /// Values below :literal:`neighbor_count` are raised to it. Larger values give
+    /// higher recall at lower throughput.
+    /// Used with :expr:`method::hnsw` only.
+    /// @remark default = 64
+    /// @invariant :expr:`search_breadth > 0`
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_search_breadth() const {
+        return base_t::get_search_breadth();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_search_breadth(std::int64_t value) {
+        base_t::set_search_breadth_impl(value);
+        return *this;
+    }
+
+    /// The radius r of the neighborhood. The training points at the Euclidean
+    /// distance not greater than r from a query point are its neighbors.
+    /// Used with :expr:`task::radius_search` only.
+    /// @remark default = 1.0
+    /// @invariant :expr:`radius >= 0`
+    template <typename T = Task, typename = detail::enable_if_radius_search_t<T>>
+    double get_radius() const {
+        return base_t::get_radius();
+    }
+
+    template <typename T = Task, typename = detail::enable_if_radius_search_t<T>>
+    auto& set_radius(double value) {
+        base_t::set_radius_impl(value);
+        return *this;
+    }
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::search` or
+///              :expr:`task::radius_search`.
 template <typename Task = task::by_default>
 class model : public base {
     static_assert(detail::is_valid_task_v<Task>);
     friend dal::detail::pimpl_accessor;
+    friend dal::detail::serialization_accessor;
 
 public:
     /// Creates a new instance of the class with the default property values.
     model();
 
 private:
+    void serialize(dal::detail::output_archive& ar) const;
+    void deserialize(dal::detail::input_archive& ar);
+
     explicit model(const std::shared_ptr<detail::model_impl<Task>>& impl);
     dal::detail::pimpl<detail::model_impl<Task>> impl_;
 };
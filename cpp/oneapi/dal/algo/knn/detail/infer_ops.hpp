@@ -49,11 +49,16 @@ struct infer_ops {
     void check_postconditions(const Descriptor& params,
                               const input_t& input,
                               const result_t& result) const {
-        if constexpr (!std::is_same_v<task_t, task::search>) {
+        if constexpr (std::is_same_v<task_t, task::classification>) {
             ONEDAL_ASSERT(result.get_responses().get_column_count() == 1);
             ONEDAL_ASSERT(result.get_responses().get_row_count() ==
                           input.get_data().get_row_count());
         }
+        if constexpr (std::is_same_v<task_t, task::radius_search>) {
+            ONEDAL_ASSERT(result.get_offsets().get_column_count() == 1);
+            ONEDAL_ASSERT(result.get_offsets().get_row_count() ==
+                          input.get_data().get_row_count() + 1);
+        }
     }
 
     template <typename Context>
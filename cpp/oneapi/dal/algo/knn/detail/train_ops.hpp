@@ -41,18 +41,21 @@ struct train_ops {
     void check_preconditions(const Descriptor& params, const input_t& input) const {
         using msg = dal::detail::error_messages;
 
-        if (!input.get_data().has_data()) {
+        // The search model given in the input may be retrained without new data, the
+        // kernels check that the model is not empty then
+        if (!input.get_data().has_data() && !std::is_same_v<task_t, task::search>) {
             throw domain_error(msg::input_data_is_empty());
         }
-        if (!input.get_responses().has_data() && !std::is_same_v<task_t, task::search>) {
+        if (!input.get_responses().has_data() &&
+            std::is_same_v<task_t, task::classification>) {
             throw domain_error(msg::input_responses_are_empty());
         }
         if (input.get_responses().get_column_count() != 1 &&
-            !std::is_same_v<task_t, task::search>) {
+            std::is_same_v<task_t, task::classification>) {
             throw domain_error(msg::input_responses_table_has_wrong_cc_expect_one());
         }
         if (input.get_data().get_row_count() != input.get_responses().get_row_count() &&
-            !std::is_same_v<task_t, task::search>) {
+            std::is_same_v<task_t, task::classification>) {
             throw domain_error(msg::input_data_rc_neq_input_responses_rc());
         }
     }
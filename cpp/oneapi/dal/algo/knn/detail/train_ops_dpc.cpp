@@ -45,6 +45,12 @@ INSTANTIATE(float, method::brute_force, task::classification)
 INSTANTIATE(double, method::brute_force, task::classification)
 INSTANTIATE(float, method::brute_force, task::search)
 INSTANTIATE(double, method::brute_force, task::search)
+INSTANTIATE(float, method::brute_force, task::radius_search)
+INSTANTIATE(double, method::brute_force, task::radius_search)
+INSTANTIATE(float, method::kd_tree, task::radius_search)
+INSTANTIATE(double, method::kd_tree, task::radius_search)
+INSTANTIATE(float, method::hnsw, task::search)
+INSTANTIATE(double, method::hnsw, task::search)
 
 } // namespace v1
 } // namespace oneapi::dal::knn::detail
@@ -34,6 +34,7 @@ public:
     table responses;
     table indices;
     table distances;
+    table offsets;
 };
 
 using detail::v1::infer_input_impl;
@@ -98,10 +99,22 @@ void infer_result<Task>::set_distances_impl(const table& value) {
     impl_->distances = value;
 }
 
+template <typename Task>
+const table& infer_result<Task>::get_offsets_impl() const {
+    return impl_->offsets;
+}
+
+template <typename Task>
+void infer_result<Task>::set_offsets_impl(const table& value) {
+    impl_->offsets = value;
+}
+
 template class ONEDAL_EXPORT infer_input<task::classification>;
 template class ONEDAL_EXPORT infer_result<task::classification>;
 template class ONEDAL_EXPORT infer_input<task::search>;
 template class ONEDAL_EXPORT infer_result<task::search>;
+template class ONEDAL_EXPORT infer_input<task::radius_search>;
+template class ONEDAL_EXPORT infer_result<task::radius_search>;
 
 } // namespace v1
 } // namespace oneapi::dal::knn
@@ -37,7 +37,8 @@ using v1::infer_result_impl;
 namespace v1 {
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::search` or
+///              :expr:`task::radius_search`.
 template <typename Task = task::by_default>
 class infer_input : public base {
     static_assert(detail::is_valid_task_v<Task>);
@@ -76,7 +77,8 @@ private:
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::search` or
+///              :expr:`task::radius_search`.
 template <typename Task = task::by_default>
 class infer_result {
     static_assert(detail::is_valid_task_v<Task>);
@@ -122,11 +124,30 @@ public:
         return *this;
     }
 
+    /// The offsets of the neighborhoods of the queries in the :literal:`indices` and
+    /// :literal:`distances` tables. The neighbors of the i-th query occupy the rows
+    /// from :expr:`offsets[i]` to :expr:`offsets[i + 1]` of those tables, the
+    /// table has :expr:`data.row_count + 1` rows and a single column.
+    /// Used with :expr:`task::radius_search` only.
+    /// @remark default = table{}
+    template <typename T = Task, typename = detail::enable_if_radius_search_t<T>>
+    const table& get_offsets() const {
+        return get_offsets_impl();
+    }
+
+    template <typename T = Task, typename = detail::enable_if_radius_search_t<T>>
+    auto& set_offsets(const table& value) {
+        set_offsets_impl(value);
+        return *this;
+    }
+
 protected:
     void set_responses_impl(const table&);
     void set_indices_impl(const table&);
     void set_distances_impl(const table&);
+    void set_offsets_impl(const table&);
     const table& get_responses_impl() const;
+    const table& get_offsets_impl() const;
 
 private:
     dal::detail::pimpl<detail::infer_result_impl<Task>> impl_;
@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/test/fixture.hpp"
+
+namespace oneapi::dal::knn::test {
+
+template <typename TestType>
+class knn_compression_test : public knn_fixture<TestType> {
+public:
+    using base_t = knn_fixture<TestType>;
+    using descriptor_t = typename base_t::descriptor_t;
+
+    descriptor_t get_descriptor(std::int64_t neighbor_count) const {
+        return base_t::get_descriptor(neighbor_count).set_compression(knn::compression::int8);
+    }
+};
+
+using compression_types = COMBINE_TYPES((float, double), (knn::method::brute_force));
+
+#define KNN_COMPRESSION_TEST(name) \
+    KNN_METHOD_TEST(knn_compression_test, "compression", compression_types, name)
+
+KNN_COMPRESSION_TEST("compressed search is exact when all rows are re-ranked") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 300;
+    constexpr std::int64_t infer_row_count = 50;
+    constexpr std::int64_t column_count = 5;
+    constexpr std::int64_t neighbor_count = 5;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_infer = this->generate_data(infer_row_count, column_count, 0.2);
+
+    const auto desc = this->get_descriptor(neighbor_count).set_rerank_factor(train_row_count);
+    const auto model = this->train(desc, x_train).get_model();
+    const auto result = this->infer(desc, x_infer, model);
+
+    REQUIRE(result.get_indices().get_row_count() == infer_row_count);
+    REQUIRE(result.get_indices().get_column_count() == neighbor_count);
+
+    this->check_distances_sorted(result);
+
+    const auto gtruth = this->naive_knn_search(x_train, x_infer, neighbor_count);
+    REQUIRE(this->recall(result, gtruth, neighbor_count) == 1.0);
+}
+
+KNN_COMPRESSION_TEST("compressed search has high recall with default rerank factor") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 5000;
+    constexpr std::int64_t infer_row_count = 200;
+    constexpr std::int64_t column_count = 32;
+    constexpr std::int64_t neighbor_count = 10;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_infer = this->generate_data(infer_row_count, column_count);
+
+    const auto desc = this->get_descriptor(neighbor_count);
+    const auto model = this->train(desc, x_train).get_model();
+    const auto result = this->infer(desc, x_infer, model);
+
+    const auto gtruth = this->naive_knn_search(x_train, x_infer, neighbor_count);
+    const double value = this->recall(result, gtruth, neighbor_count);
+    CAPTURE(value);
+    REQUIRE(value >= 0.95);
+}
+
+KNN_COMPRESSION_TEST("compressed search pads the missing neighbors") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 4;
+    constexpr std::int64_t neighbor_count = 6;
+
+    const table x_train = this->generate_data(train_row_count, 3);
+    const auto desc = this->get_descriptor(neighbor_count);
+    const auto model = this->train(desc, x_train).get_model();
+    const auto result = this->infer(desc, x_train, model);
+
+    const auto indices = row_accessor<const std::int32_t>(result.get_indices()).pull();
+    for (std::int64_t j = 0; j < train_row_count; ++j) {
+        REQUIRE(indices[j * neighbor_count] == j);
+        for (std::int64_t i = train_row_count; i < neighbor_count; ++i) {
+            REQUIRE(indices[j * neighbor_count + i] == -1);
+        }
+    }
+}
+
+#define KNN_COMPRESSION_BADARG_TEST(name) \
+    KNN_METHOD_BADARG_TEST(knn_compression_test, "compression", compression_types, name)
+
+KNN_COMPRESSION_BADARG_TEST("throws if rerank_factor is zero") {
+    REQUIRE_THROWS_AS(this->get_descriptor(1).set_rerank_factor(0), domain_error);
+}
+
+KNN_COMPRESSION_BADARG_TEST("throws if compression of model and descriptor differ") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table x_train = this->generate_data(20, 3);
+    const auto desc = this->get_descriptor(2);
+    const auto exact_desc = this->get_descriptor(2).set_compression(knn::compression::none);
+
+    const auto model = this->train(desc, x_train).get_model();
+    const auto exact_model = this->train(exact_desc, x_train).get_model();
+    REQUIRE_THROWS_AS(this->infer(exact_desc, x_train, model), invalid_argument);
+    REQUIRE_THROWS_AS(this->infer(desc, x_train, exact_model), invalid_argument);
+}
+
+KNN_COMPRESSION_BADARG_TEST("throws if infer data column count differs from train data") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    this->check_column_count_mismatch(this->get_descriptor(2));
+}
+
+} // namespace oneapi::dal::knn::test
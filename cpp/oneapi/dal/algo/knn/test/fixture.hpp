@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/algo/knn/infer.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+
+namespace oneapi::dal::knn::test {
+
+namespace te = dal::test::engine;
+
+/// Declares the test of the knn method or task `tag` for each of the `types`
+#define KNN_METHOD_TEST(fixture, tag, types, name) \
+    TEMPLATE_LIST_TEST_M(fixture, name, "[synthetic-dataset][knn][" tag "][batch][test]", types)
+
+#define KNN_METHOD_BADARG_TEST(fixture, tag, types, name) \
+    TEMPLATE_LIST_TEST_M(fixture, name, "[knn][" tag "][badarg]", types)
+
+#define KNN_METHOD_PERF_TEST(fixture, tag, types, name) \
+    TEMPLATE_LIST_TEST_M(fixture, name, "[knn][" tag "][perf]", types)
+
+/// The synthetic data and the full scan search the tests of the knn methods and
+/// tasks are checked against. The descriptor uses the Euclidean distance
+template <typename TestType, typename Task = knn::task::search>
+class knn_fixture : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+    using descriptor_t = knn::descriptor<Float, Method, Task>;
+    using model_t = knn::model<Task>;
+    using result_t = knn::infer_result<Task>;
+    using train_input_t = knn::train_input<Task>;
+
+    bool not_available_on_device() {
+        return this->get_policy().is_gpu();
+    }
+
+    descriptor_t get_descriptor(std::int64_t neighbor_count) const {
+        return descriptor_t{ neighbor_count, minkowski_distance::descriptor<Float>(2.0) };
+    }
+
+    /// Uniform random values from `-1 + shift` to 1
+    table generate_data(std::int64_t row_count,
+                        std::int64_t column_count,
+                        double shift = 0.0,
+                        std::int64_t seed = 7777) const {
+        const auto dataframe = GENERATE_DATAFRAME(
+            te::dataframe_builder{ row_count, column_count }.fill_uniform(-1.0 + shift,
+                                                                          1.0,
+                                                                          seed));
+        return dataframe.get_table(this->get_homogen_table_id());
+    }
+
+    static double squared_distance(const Float* x, const Float* y, std::int64_t column_count) {
+        double sum = 0;
+        for (std::int64_t s = 0; s < column_count; ++s) {
+            const double diff = double(x[s]) - double(y[s]);
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+    /// Indices of the exact nearest neighbors computed by the full scan
+    static std::vector<std::int64_t> naive_knn_search(const table& train_data,
+                                                      const table& infer_data,
+                                                      std::int64_t neighbor_count) {
+        const auto m = train_data.get_row_count();
+        const auto n = infer_data.get_row_count();
+        const auto d = infer_data.get_column_count();
+        const auto train = row_accessor<const Float>(train_data).pull();
+        const auto infer = row_accessor<const Float>(infer_data).pull();
+
+        std::vector<std::int64_t> indices(n * neighbor_count);
+        std::vector<double> distances(m);
+        std::vector<std::int64_t> order(m);
+        for (std::int64_t j = 0; j < n; ++j) {
+            for (std::int64_t i = 0; i < m; ++i) {
+                distances[i] = squared_distance(&infer[j * d], &train[i * d], d);
+            }
+            std::iota(order.begin(), order.end(), std::int64_t(0));
+            std::partial_sort(order.begin(),
+                              order.begin() + neighbor_count,
+                              order.end(),
+                              [&](std::int64_t x, std::int64_t y) {
+                                  return distances[x] < distances[y];
+                              });
+            std::copy(order.begin(), order.begin() + neighbor_count, &indices[j * neighbor_count]);
+        }
+        return indices;
+    }
+
+    /// The share of the exact nearest neighbors found by the search
+    static double recall(const result_t& result,
+                         const std::vector<std::int64_t>& gtruth,
+                         std::int64_t neighbor_count) {
+        const auto indices = row_accessor<const std::int32_t>(result.get_indices()).pull();
+        const std::int64_t row_count = result.get_indices().get_row_count();
+        std::int64_t found_count = 0;
+        for (std::int64_t j = 0; j < row_count; ++j) {
+            const auto first = gtruth.begin() + j * neighbor_count;
+            const std::set<std::int64_t> expected(first, first + neighbor_count);
+            for (std::int64_t i = 0; i < neighbor_count; ++i) {
+                found_count += expected.count(indices[j * neighbor_count + i]);
+            }
+        }
+        return double(found_count) / double(row_count * neighbor_count);
+    }
+
+    static void check_distances_sorted(const result_t& result) {
+        const auto distances = row_accessor<const Float>(result.get_distances()).pull();
+        const std::int64_t row_count = result.get_distances().get_row_count();
+        const std::int64_t column_count = result.get_distances().get_column_count();
+        for (std::int64_t j = 0; j < row_count; ++j) {
+            for (std::int64_t i = 1; i < column_count; ++i) {
+                REQUIRE(distances[j * column_count + i - 1] <= distances[j * column_count + i]);
+            }
+        }
+    }
+
+    /// Appends the rows to the copy of the model
+    model_t append(const descriptor_t& desc, const model_t& model, const table& data) {
+        return this->train(desc, train_input_t{ data }.set_model(model)).get_model();
+    }
+
+    /// Merges the appended rows of the model into the rebuilt search structure
+    model_t compact(const descriptor_t& desc, const model_t& model) {
+        return this->train(desc, train_input_t{ table{} }.set_model(model)).get_model();
+    }
+
+    void check_column_count_mismatch(const descriptor_t& desc) {
+        const auto model = this->train(desc, generate_data(20, 3)).get_model();
+        REQUIRE_THROWS_AS(this->infer(desc, generate_data(5, 4), model), invalid_argument);
+    }
+};
+
+} // namespace oneapi::dal::knn::test
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <array>
+#include <set>
+
+#include "oneapi/dal/algo/knn/test/fixture.hpp"
+
+namespace oneapi::dal::knn::test {
+
+template <typename TestType>
+using knn_hnsw_test = knn_fixture<TestType>;
+
+using hnsw_types = COMBINE_TYPES((float, double), (knn::method::hnsw));
+
+#define KNN_HNSW_TEST(name) KNN_METHOD_TEST(knn_hnsw_test, "hnsw", hnsw_types, name)
+
+KNN_HNSW_TEST("hnsw finds exact neighbors when search breadth covers training set") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 300;
+    constexpr std::int64_t infer_row_count = 50;
+    constexpr std::int64_t column_count = 5;
+    constexpr std::int64_t neighbor_count = 5;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_infer = this->generate_data(infer_row_count, column_count, 0.2);
+
+    const auto desc = this->get_descriptor(neighbor_count)
+                          .set_construction_breadth(train_row_count)
+                          .set_search_breadth(train_row_count);
+
+    const auto model = this->train(desc, x_train).get_model();
+    const auto result = this->infer(desc, x_infer, model);
+
+    REQUIRE(result.get_indices().get_row_count() == infer_row_count);
+    REQUIRE(result.get_indices().get_column_count() == neighbor_count);
+    this->check_distances_sorted(result);
+
+    const auto gtruth = this->naive_knn_search(x_train, x_infer, neighbor_count);
+    REQUIRE(this->recall(result, gtruth, neighbor_count) == 1.0);
+}
+
+KNN_HNSW_TEST("hnsw has high recall with default parameters") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 5000;
+    constexpr std::int64_t infer_row_count = 200;
+    constexpr std::int64_t column_count = 16;
+    constexpr std::int64_t neighbor_count = 10;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_infer = this->generate_data(infer_row_count, column_count);
+
+    const auto desc = this->get_descriptor(neighbor_count);
+    const auto model = this->train(desc, x_train).get_model();
+    const auto result = this->infer(desc, x_infer, model);
+    this->check_distances_sorted(result);
+
+    const auto gtruth = this->naive_knn_search(x_train, x_infer, neighbor_count);
+    const double value = this->recall(result, gtruth, neighbor_count);
+    CAPTURE(value);
+    REQUIRE(value >= 0.9);
+}
+
+KNN_HNSW_TEST("hnsw returns all training rows if neighbor_count exceeds row count") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = std::tuple_element_t<0, TestType>;
+
+    constexpr std::int64_t train_row_count = 4;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t neighbor_count = 6;
+
+    constexpr std::array<Float, train_row_count * column_count> train = { 0.0, 0.0, 1.0, 0.0,
+                                                                          0.0, 2.0, 3.0, 3.0 };
+    const auto x_train = homogen_table::wrap(train.data(), train_row_count, column_count);
+
+    const auto desc = this->get_descriptor(neighbor_count);
+    const auto model = this->train(desc, x_train).get_model();
+    const auto result = this->infer(desc, x_train, model);
+
+    const auto indices = row_accessor<const std::int32_t>(result.get_indices()).pull();
+    for (std::int64_t j = 0; j < train_row_count; ++j) {
+        REQUIRE(indices[j * neighbor_count] == j);
+        std::set<std::int64_t> found(&indices[j * neighbor_count],
+                                     &indices[j * neighbor_count + train_row_count]);
+        REQUIRE(found.size() == train_row_count);
+        for (std::int64_t i = train_row_count; i < neighbor_count; ++i) {
+            REQUIRE(indices[j * neighbor_count + i] == -1);
+        }
+    }
+}
+
+#define KNN_HNSW_BADARG_TEST(name) \
+    KNN_METHOD_BADARG_TEST(knn_hnsw_test, "hnsw", hnsw_types, name)
+
+KNN_HNSW_BADARG_TEST("throws if max_degree is one") {
+    REQUIRE_THROWS_AS(this->get_descriptor(1).set_max_degree(1), domain_error);
+}
+
+KNN_HNSW_BADARG_TEST("throws if construction_breadth is zero") {
+    REQUIRE_THROWS_AS(this->get_descriptor(1).set_construction_breadth(0), domain_error);
+}
+
+KNN_HNSW_BADARG_TEST("throws if search_breadth is zero") {
+    REQUIRE_THROWS_AS(this->get_descriptor(1).set_search_breadth(0), domain_error);
+}
+
+KNN_HNSW_BADARG_TEST("throws if infer data column count differs from train data") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    this->check_column_count_mismatch(this->get_descriptor(2));
+}
+
+KNN_HNSW_BADARG_TEST("throws if model is trained by another method") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = std::tuple_element_t<0, TestType>;
+    const auto bf_desc = knn::descriptor<Float, knn::method::brute_force, knn::task::search>{
+        2,
+        minkowski_distance::descriptor<Float>(2.0)
+    };
+    const table x_train = this->generate_data(20, 3);
+    const auto bf_model = this->train(bf_desc, x_train).get_model();
+    REQUIRE_THROWS_AS(this->infer(this->get_descriptor(2), x_train, bf_model), invalid_argument);
+}
+
+} // namespace oneapi::dal::knn::test
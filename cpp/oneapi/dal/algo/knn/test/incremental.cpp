@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <set>
+
+#include "oneapi/dal/algo/knn/test/fixture.hpp"
+
+namespace oneapi::dal::knn::test {
+
+template <typename TestType>
+class knn_incremental_test : public knn_fixture<TestType> {
+public:
+    using base_t = knn_fixture<TestType>;
+    using Float = typename base_t::Float;
+    using descriptor_t = typename base_t::descriptor_t;
+    using model_t = typename base_t::model_t;
+
+    /// Copies the rows from `first` to `last` of the table into the new table
+    static table slice_rows(const table& data, std::int64_t first, std::int64_t last) {
+        const std::int64_t column_count = data.get_column_count();
+        auto arr = row_accessor<const Float>(data).pull({ first, last });
+        return homogen_table::wrap(arr, last - first, column_count);
+    }
+
+    /// Checks that the search finds the exact nearest neighbors among the rows of
+    /// `train_data`
+    void check_search(const descriptor_t& desc,
+                      const model_t& model,
+                      const table& train_data,
+                      const table& infer_data) {
+        const std::int64_t neighbor_count = desc.get_neighbor_count();
+        const auto result = this->infer(desc, infer_data, model);
+        REQUIRE(result.get_indices().get_row_count() == infer_data.get_row_count());
+        REQUIRE(result.get_indices().get_column_count() == neighbor_count);
+
+        const auto gtruth = base_t::naive_knn_search(train_data, infer_data, neighbor_count);
+        const std::int64_t n = infer_data.get_row_count();
+        const std::int64_t d = infer_data.get_column_count();
+        const auto train = row_accessor<const Float>(train_data).pull();
+        const auto infer = row_accessor<const Float>(infer_data).pull();
+        const auto indices = row_accessor<const std::int32_t>(result.get_indices()).pull();
+        const auto distances = row_accessor<const Float>(result.get_distances()).pull();
+
+        for (std::int64_t j = 0; j < n; ++j) {
+            const auto first = gtruth.begin() + j * neighbor_count;
+            const std::set<std::int64_t> expected(first, first + neighbor_count);
+            for (std::int64_t i = 0; i < neighbor_count; ++i) {
+                const std::int64_t index = indices[j * neighbor_count + i];
+                REQUIRE(expected.count(index) == 1);
+                const double expected_distance =
+                    std::sqrt(base_t::squared_distance(&infer[j * d], &train[index * d], d));
+                REQUIRE(std::abs(distances[j * neighbor_count + i] - expected_distance) < 1e-4);
+            }
+        }
+    }
+};
+
+using incremental_types =
+    COMBINE_TYPES((float, double), (knn::method::brute_force, knn::method::kd_tree));
+
+#define KNN_INCREMENTAL_TEST(name) \
+    KNN_METHOD_TEST(knn_incremental_test, "incremental", incremental_types, name)
+
+KNN_INCREMENTAL_TEST("appended rows are searched before compaction") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table x_train = this->generate_data(400, 4);
+    const table x_infer = this->generate_data(50, 4, 0.0, 8888);
+    const auto desc = this->get_descriptor(5);
+
+    auto model = this->train(desc, this->slice_rows(x_train, 0, 300)).get_model();
+    model = this->append(desc, model, this->slice_rows(x_train, 300, 350));
+    model = this->append(desc, model, this->slice_rows(x_train, 350, 400));
+    this->check_search(desc, model, x_train, x_infer);
+}
+
+KNN_INCREMENTAL_TEST("appended rows are merged into the search structure") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table x_train = this->generate_data(400, 4);
+    const table x_infer = this->generate_data(50, 4, 0.0, 8888);
+    auto desc = this->get_descriptor(5);
+
+    const auto model = this->train(desc, this->slice_rows(x_train, 0, 300)).get_model();
+    const auto extended_model = this->append(desc, model, this->slice_rows(x_train, 300, 400));
+
+    SECTION("by the explicit compaction") {
+        const auto compacted_model = this->compact(desc, extended_model);
+        this->check_search(desc, compacted_model, x_train, x_infer);
+    }
+
+    SECTION("when the delta buffer overflows") {
+        desc.set_max_delta_row_count(99);
+        const auto compacted_model =
+            this->append(desc, model, this->slice_rows(x_train, 300, 400));
+        this->check_search(desc, compacted_model, x_train, x_infer);
+    }
+
+    // The model the rows are appended to is not modified
+    this->check_search(desc, model, this->slice_rows(x_train, 0, 300), x_infer);
+}
+
+KNN_INCREMENTAL_TEST("appended rows outnumbering the rows of the model are searched") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table x_train = this->generate_data(60, 3);
+    const table x_infer = this->generate_data(20, 3, 0.0, 8888);
+    const auto desc = this->get_descriptor(8);
+
+    auto model = this->train(desc, this->slice_rows(x_train, 0, 10)).get_model();
+    model = this->append(desc, model, this->slice_rows(x_train, 10, 60));
+    this->check_search(desc, model, x_train, x_infer);
+}
+
+#define KNN_INCREMENTAL_BADARG_TEST(name) \
+    KNN_METHOD_BADARG_TEST(knn_incremental_test, "incremental", incremental_types, name)
+
+KNN_INCREMENTAL_BADARG_TEST("throws if max_delta_row_count is negative") {
+    REQUIRE_THROWS_AS(this->get_descriptor(1).set_max_delta_row_count(-1), domain_error);
+}
+
+KNN_INCREMENTAL_BADARG_TEST("throws if appended data column count differs from model") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const auto desc = this->get_descriptor(2);
+    const auto model = this->train(desc, this->generate_data(20, 3)).get_model();
+    REQUIRE_THROWS_AS(this->append(desc, model, this->generate_data(5, 4, 0.0, 8888)),
+                      invalid_argument);
+}
+
+KNN_INCREMENTAL_BADARG_TEST("throws if train data and model are empty") {
+    SKIP_IF(this->not_available_on_device());
+
+    const auto desc = this->get_descriptor(2);
+    const auto input = knn::train_input<knn::task::search>{ table{} };
+    REQUIRE_THROWS_AS(this->train(desc, input), domain_error);
+}
+
+KNN_INCREMENTAL_BADARG_TEST("throws if model is trained by another method") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+    using other_method_t = std::conditional_t<std::is_same_v<Method, knn::method::kd_tree>,
+                                              knn::method::brute_force,
+                                              knn::method::kd_tree>;
+    const auto other_desc = knn::descriptor<Float, other_method_t, knn::task::search>{
+        2,
+        minkowski_distance::descriptor<Float>(2.0)
+    };
+
+    const table x_train = this->generate_data(20, 3);
+    const auto model = this->train(other_desc, x_train).get_model();
+    REQUIRE_THROWS_AS(this->append(this->get_descriptor(2), model, x_train), invalid_argument);
+}
+
+} // namespace oneapi::dal::knn::test
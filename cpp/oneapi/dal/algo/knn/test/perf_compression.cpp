@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/test/fixture.hpp"
+
+namespace oneapi::dal::knn::test {
+
+template <typename TestType>
+using knn_compression_perf_test = knn_fixture<TestType>;
+
+using compression_perf_types = COMBINE_TYPES((float), (knn::method::brute_force));
+
+KNN_METHOD_PERF_TEST(knn_compression_perf_test,
+                     "compression",
+                     compression_perf_types,
+                     "benchmark of compressed search recall and throughput") {
+    constexpr std::int64_t train_row_count = 200000;
+    constexpr std::int64_t infer_row_count = 1000;
+    constexpr std::int64_t column_count = 128;
+    constexpr std::int64_t neighbor_count = 10;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_infer = this->generate_data(infer_row_count, column_count);
+    const auto gtruth = this->naive_knn_search(x_train, x_infer, neighbor_count);
+
+    const auto exact_desc = this->get_descriptor(neighbor_count);
+    const auto exact_model = this->train(exact_desc, x_train).get_model();
+    BENCHMARK(fmt::format("float search of {} queries", infer_row_count).c_str()) {
+        return this->infer(exact_desc, x_infer, exact_model);
+    };
+
+    auto desc = this->get_descriptor(neighbor_count).set_compression(knn::compression::int8);
+    const auto model = this->train(desc, x_train).get_model();
+    for (const std::int64_t factor : { 1, 2, 4, 8 }) {
+        desc.set_rerank_factor(factor);
+        const auto result = this->infer(desc, x_infer, model);
+        const double value = this->recall(result, gtruth, neighbor_count);
+        const auto name = fmt::format("int8 search of {} queries, rerank factor {}, recall {:.4f}",
+                                      infer_row_count,
+                                      factor,
+                                      value);
+        BENCHMARK(name.c_str()) {
+            return this->infer(desc, x_infer, model);
+        };
+    }
+}
+
+} // namespace oneapi::dal::knn::test
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/test/fixture.hpp"
+
+namespace oneapi::dal::knn::test {
+
+template <typename TestType>
+using knn_hnsw_perf_test = knn_fixture<TestType>;
+
+using hnsw_perf_types = COMBINE_TYPES((float), (knn::method::hnsw));
+
+KNN_METHOD_PERF_TEST(knn_hnsw_perf_test,
+                     "hnsw",
+                     hnsw_perf_types,
+                     "benchmark of hnsw recall and throughput against search breadth") {
+    constexpr std::int64_t train_row_count = 100000;
+    constexpr std::int64_t infer_row_count = 1000;
+    constexpr std::int64_t column_count = 32;
+    constexpr std::int64_t neighbor_count = 10;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_infer = this->generate_data(infer_row_count, column_count);
+    const auto gtruth = this->naive_knn_search(x_train, x_infer, neighbor_count);
+
+    auto desc = this->get_descriptor(neighbor_count);
+    const auto model = this->train(desc, x_train).get_model();
+
+    const auto bf_desc = knn::descriptor<float, knn::method::brute_force, knn::task::search>{
+        neighbor_count,
+        minkowski_distance::descriptor<float>(2.0)
+    };
+    const auto bf_model = this->train(bf_desc, x_train).get_model();
+    BENCHMARK("brute force search") {
+        return this->infer(bf_desc, x_infer, bf_model);
+    };
+
+    for (const std::int64_t breadth : { 10, 32, 64, 128, 256 }) {
+        desc.set_search_breadth(breadth);
+        const auto result = this->infer(desc, x_infer, model);
+        const double value = this->recall(result, gtruth, neighbor_count);
+        const auto name = fmt::format("hnsw search breadth {}, recall {:.4f}", breadth, value);
+        BENCHMARK(name.c_str()) {
+            return this->infer(desc, x_infer, model);
+        };
+    }
+}
+
+} // namespace oneapi::dal::knn::test
@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/test/fixture.hpp"
+
+namespace oneapi::dal::knn::test {
+
+template <typename TestType>
+using knn_incremental_perf_test = knn_fixture<TestType>;
+
+using incremental_perf_types = COMBINE_TYPES((float), (knn::method::kd_tree));
+
+KNN_METHOD_PERF_TEST(knn_incremental_perf_test,
+                     "incremental",
+                     incremental_perf_types,
+                     "benchmark of appending rows and searching the delta buffer") {
+    constexpr std::int64_t train_row_count = 1000000;
+    constexpr std::int64_t append_row_count = 1000;
+    constexpr std::int64_t infer_row_count = 1000;
+    constexpr std::int64_t column_count = 8;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_append = this->generate_data(append_row_count, column_count, 0.0, 8888);
+    const table x_infer = this->generate_data(infer_row_count, column_count, 0.0, 9999);
+    const auto desc = this->get_descriptor(10);
+
+    const auto model = this->train(desc, x_train).get_model();
+    BENCHMARK(fmt::format("append {} rows", append_row_count).c_str()) {
+        return this->append(desc, model, x_append);
+    };
+
+    const auto appended_model = this->append(desc, model, x_append);
+    BENCHMARK("compaction") {
+        return this->compact(desc, appended_model);
+    };
+
+    for (const std::int64_t delta_row_count : { 0, 1000, 10000, 60000 }) {
+        auto extended_model = model;
+        for (std::int64_t i = 0; i < delta_row_count; i += append_row_count) {
+            extended_model = this->append(desc, extended_model, x_append);
+        }
+        const auto name =
+            fmt::format("search {} queries, {} delta rows", infer_row_count, delta_row_count);
+        BENCHMARK(name.c_str()) {
+            return this->infer(desc, x_infer, extended_model);
+        };
+    }
+}
+
+} // namespace oneapi::dal::knn::test
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <array>
+#include <set>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/test/fixture.hpp"
+
+namespace oneapi::dal::knn::test {
+
+template <typename TestType>
+class knn_radius_search_test : public knn_fixture<TestType, knn::task::radius_search> {
+public:
+    using base_t = knn_fixture<TestType, knn::task::radius_search>;
+    using Float = typename base_t::Float;
+    using descriptor_t = typename base_t::descriptor_t;
+    using result_t = typename base_t::result_t;
+
+    result_t search(const table& x_train, const table& x_infer, double radius) {
+        const auto desc = descriptor_t{ radius };
+        const auto model = this->train(desc, x_train).get_model();
+        return this->infer(desc, x_infer, model);
+    }
+
+    /// Neighborhoods of the queries computed by the full scan
+    static std::vector<std::set<std::int64_t>> naive_radius_search(const table& train_data,
+                                                                   const table& infer_data,
+                                                                   double radius) {
+        const auto m = train_data.get_row_count();
+        const auto n = infer_data.get_row_count();
+        const auto d = infer_data.get_column_count();
+        const auto train = row_accessor<const Float>(train_data).pull();
+        const auto infer = row_accessor<const Float>(infer_data).pull();
+
+        std::vector<std::set<std::int64_t>> neighbors(n);
+        for (std::int64_t j = 0; j < n; ++j) {
+            for (std::int64_t i = 0; i < m; ++i) {
+                if (base_t::squared_distance(&infer[j * d], &train[i * d], d) <= radius * radius) {
+                    neighbors[j].insert(i);
+                }
+            }
+        }
+        return neighbors;
+    }
+
+    static void check_neighbors(const result_t& result,
+                                const std::vector<std::set<std::int64_t>>& expected,
+                                double radius) {
+        const std::int64_t row_count = expected.size();
+        REQUIRE(result.get_offsets().get_row_count() == row_count + 1);
+        REQUIRE(result.get_offsets().get_column_count() == 1);
+
+        const auto offsets = row_accessor<const std::int32_t>(result.get_offsets()).pull();
+        REQUIRE(offsets[0] == 0);
+        if (offsets[row_count] == 0) {
+            REQUIRE(!result.get_indices().has_data());
+            for (const auto& row : expected) {
+                REQUIRE(row.empty());
+            }
+            return;
+        }
+
+        REQUIRE(result.get_indices().get_row_count() == offsets[row_count]);
+        REQUIRE(result.get_distances().get_row_count() == offsets[row_count]);
+        const auto indices = row_accessor<const std::int32_t>(result.get_indices()).pull();
+        const auto distances = row_accessor<const Float>(result.get_distances()).pull();
+        for (std::int64_t j = 0; j < row_count; ++j) {
+            const std::set<std::int64_t> found(&indices[offsets[j]], &indices[offsets[j + 1]]);
+            REQUIRE(found == expected[j]);
+            REQUIRE(std::size_t(offsets[j + 1] - offsets[j]) == found.size());
+            for (std::int64_t i = offsets[j]; i < offsets[j + 1]; ++i) {
+                REQUIRE(distances[i] <= Float(radius) * (1 + 1e-5));
+                if (i > offsets[j]) {
+                    REQUIRE(distances[i - 1] <= distances[i]);
+                }
+            }
+        }
+    }
+};
+
+using radius_search_types =
+    COMBINE_TYPES((float, double), (knn::method::brute_force, knn::method::kd_tree));
+
+#define KNN_RADIUS_SEARCH_TEST(name) \
+    KNN_METHOD_TEST(knn_radius_search_test, "radius-search", radius_search_types, name)
+
+KNN_RADIUS_SEARCH_TEST("radius search finds the same neighbors as full scan") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 2000;
+    constexpr std::int64_t infer_row_count = 300;
+    constexpr std::int64_t column_count = 3;
+
+    const table x_train = this->generate_data(train_row_count, column_count);
+    const table x_infer = this->generate_data(infer_row_count, column_count, 0.3);
+
+    for (const double radius : { 0.05, 0.2, 0.5 }) {
+        CAPTURE(radius);
+        const auto result = this->search(x_train, x_infer, radius);
+        this->check_neighbors(result,
+                              this->naive_radius_search(x_train, x_infer, radius),
+                              radius);
+    }
+}
+
+KNN_RADIUS_SEARCH_TEST("radius search returns empty neighborhoods") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = std::tuple_element_t<0, TestType>;
+
+    constexpr std::int64_t train_row_count = 4;
+    constexpr std::int64_t infer_row_count = 3;
+    constexpr std::int64_t column_count = 2;
+
+    constexpr std::array<Float, train_row_count * column_count> train = { 0.0, 0.0, 1.0, 0.0,
+                                                                          0.0, 2.0, 3.0, 3.0 };
+    constexpr std::array<Float, infer_row_count * column_count> infer = { 0.0, 0.0, 10.0, 10.0,
+                                                                          1.0, 0.5 };
+    const auto x_train = homogen_table::wrap(train.data(), train_row_count, column_count);
+    const auto x_infer = homogen_table::wrap(infer.data(), infer_row_count, column_count);
+
+    const auto result = this->search(x_train, x_infer, 0.5);
+    this->check_neighbors(result, { { 0 }, {}, { 1 } }, 0.5);
+
+    const auto distances = row_accessor<const Float>(result.get_distances()).pull();
+    REQUIRE(distances[0] == Float(0));
+    REQUIRE(distances[1] == Float(0.5));
+
+    const auto x_far = homogen_table::wrap(infer.data() + column_count, 1, column_count);
+    this->check_neighbors(this->search(x_train, x_far, 1.0),
+                          std::vector<std::set<std::int64_t>>(1),
+                          1.0);
+}
+
+KNN_RADIUS_SEARCH_TEST("radius search with zero radius finds duplicates of the query") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table x_train = this->generate_data(500, 4);
+    const auto result = this->search(x_train, x_train, 0.0);
+    this->check_neighbors(result, this->naive_radius_search(x_train, x_train, 0.0), 0.0);
+}
+
+#define KNN_RADIUS_SEARCH_BADARG_TEST(name) \
+    KNN_METHOD_BADARG_TEST(knn_radius_search_test, "radius-search", radius_search_types, name)
+
+KNN_RADIUS_SEARCH_BADARG_TEST("throws if radius is negative") {
+    using descriptor_t = typename knn_radius_search_test<TestType>::descriptor_t;
+    REQUIRE_THROWS_AS(descriptor_t{ -1.0 }, domain_error);
+    REQUIRE_THROWS_AS(descriptor_t{ 1.0 }.set_radius(-0.5), domain_error);
+}
+
+KNN_RADIUS_SEARCH_BADARG_TEST("throws if infer data column count differs from train data") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    using descriptor_t = typename knn_radius_search_test<TestType>::descriptor_t;
+    this->check_column_count_mismatch(descriptor_t{ 0.5 });
+}
+
+} // namespace oneapi::dal::knn::test
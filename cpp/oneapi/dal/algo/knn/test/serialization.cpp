@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/infer.hpp"
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/serialization.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+
+namespace oneapi::dal::knn::test {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+class knn_serialization_test : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using task_t = std::tuple_element_t<2, TestType>;
+    using descriptor_t = descriptor<float_t, method_t, task_t>;
+
+    static constexpr std::int64_t class_count = 2;
+    static constexpr std::int64_t neighbor_count = 3;
+
+    bool not_available_on_device() {
+        constexpr bool is_brute_force = std::is_same_v<method_t, knn::method::brute_force>;
+        return this->get_policy().is_gpu() && !is_brute_force;
+    }
+
+    descriptor_t get_descriptor() const {
+        return descriptor_t{ class_count, neighbor_count };
+    }
+
+    table get_train_data() const {
+        constexpr std::int64_t row_count = 10;
+        constexpr std::int64_t feature_count = 2;
+        static const float_t x_train[] = {
+            1.0,  1.0, //
+            2.0,  2.0, //
+            1.0,  2.0, //
+            2.0,  1.0, //
+            1.5,  1.4, //
+            -1.0, -1.0, //
+            -1.0, -2.0, //
+            -2.0, -1.0, //
+            -2.0, -2.0, //
+            -1.3, -1.6, //
+        };
+        return homogen_table::wrap(x_train, row_count, feature_count);
+    }
+
+    table get_train_responses() const {
+        constexpr std::int64_t row_count = 10;
+        static const float_t y_train[] = { 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+        return homogen_table::wrap(y_train, row_count, 1);
+    }
+
+    table get_test_data() const {
+        constexpr std::int64_t row_count = 5;
+        constexpr std::int64_t feature_count = 2;
+        static const float_t x_test[] = {
+            1.1,  1.2, //
+            2.5,  0.9, //
+            -1.5, -1.1, //
+            -0.4, -2.2, //
+            0.1,  0.3, //
+        };
+        return homogen_table::wrap(x_test, row_count, feature_count);
+    }
+
+    model<task_t> train_model() {
+        if constexpr (std::is_same_v<task_t, task::search>) {
+            return this->train(this->get_descriptor(), this->get_train_data()).get_model();
+        }
+        else {
+            return this
+                ->train(this->get_descriptor(), this->get_train_data(), this->get_train_responses())
+                .get_model();
+        }
+    }
+
+    infer_result<task_t> run_inference(const model<task_t>& m) {
+        return this->infer(this->get_descriptor(), this->get_test_data(), m);
+    }
+
+    void compare_infer_results(const infer_result<task_t>& actual,
+                               const infer_result<task_t>& reference) {
+        if constexpr (std::is_same_v<task_t, task::search>) {
+            INFO("compare indices") {
+                te::check_if_tables_equal<std::int32_t>(actual.get_indices(),
+                                                        reference.get_indices());
+            }
+            INFO("compare distances") {
+                te::check_if_tables_equal<float_t>(actual.get_distances(),
+                                                   reference.get_distances());
+            }
+        }
+        else {
+            INFO("compare responses") {
+                te::check_if_tables_equal<float_t>(actual.get_responses(),
+                                                   reference.get_responses());
+            }
+        }
+    }
+
+    void run_test() {
+        INFO("training");
+        const auto model = train_model();
+
+        INFO("serialization");
+        const auto deserialized_model = te::serialize_deserialize(model);
+
+        INFO("inference");
+        const auto expected = run_inference(model);
+        const auto actual = run_inference(deserialized_model);
+        compare_infer_results(actual, expected);
+    }
+};
+
+using knn_cls_types = COMBINE_TYPES((float, double),
+                                    (knn::method::brute_force, knn::method::kd_tree),
+                                    (knn::task::classification));
+
+using knn_search_types = COMBINE_TYPES((float, double),
+                                       (knn::method::brute_force, knn::method::hnsw),
+                                       (knn::task::search));
+
+TEMPLATE_LIST_TEST_M(knn_serialization_test,
+                     "serialize/deserialize classification knn model",
+                     "[cls]",
+                     knn_cls_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->not_available_on_device());
+
+    this->run_test();
+}
+
+TEMPLATE_LIST_TEST_M(knn_serialization_test,
+                     "serialize/deserialize search knn model",
+                     "[search]",
+                     knn_search_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->not_available_on_device());
+
+    this->run_test();
+}
+
+} // namespace oneapi::dal::knn::test
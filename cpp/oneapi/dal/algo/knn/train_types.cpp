@@ -28,6 +28,7 @@ public:
 
     table data;
     table responses;
+    model<Task> trained_model;
 };
 
 template <typename Task>
@@ -68,6 +69,16 @@ void train_input<Task>::set_responses_impl(const table& value) {
     impl_->responses = value;
 }
 
+template <typename Task>
+const model<Task>& train_input<Task>::get_model() const {
+    return impl_->trained_model;
+}
+
+template <typename Task>
+void train_input<Task>::set_model_impl(const model<Task>& value) {
+    impl_->trained_model = value;
+}
+
 template <typename Task>
 train_result<Task>::train_result() : impl_(new train_result_impl<Task>{}) {}
 
@@ -85,6 +96,8 @@ template class ONEDAL_EXPORT train_input<task::classification>;
 template class ONEDAL_EXPORT train_result<task::classification>;
 template class ONEDAL_EXPORT train_input<task::search>;
 template class ONEDAL_EXPORT train_result<task::search>;
+template class ONEDAL_EXPORT train_input<task::radius_search>;
+template class ONEDAL_EXPORT train_result<task::radius_search>;
 
 } // namespace v1
 } // namespace oneapi::dal::knn
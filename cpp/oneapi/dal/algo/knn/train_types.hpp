@@ -81,9 +81,24 @@ public:
         return *this;
     }
 
+    /// The previously trained model the training set X is appended to. If it is not
+    /// empty, the training returns this model extended with X, the rows of X get the
+    /// indices following the rows of the model. X may be empty then, the training
+    /// merges the rows appended earlier into the rebuilt search structure.
+    /// Used with :expr:`method::brute_force` and :expr:`method::kd_tree` only.
+    /// @remark default = model<Task>{}
+    const model<Task>& get_model() const;
+
+    template <typename T = Task, typename = detail::enable_if_search_t<T>>
+    auto& set_model(const model<Task>& value) {
+        set_model_impl(value);
+        return *this;
+    }
+
 protected:
     void set_data_impl(const table& data);
     void set_responses_impl(const table& responses);
+    void set_model_impl(const model<Task>& value);
 
 private:
     dal::detail::pimpl<detail::train_input_impl<Task>> impl_;
@@ -24,23 +24,28 @@
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/graph/detail/container.hpp"
 
 namespace oneapi::dal::preview::shortest_paths::backend {
 using namespace oneapi::dal::preview::detail;
 using namespace oneapi::dal::preview::backend;
 
+template <typename EdgeValue>
+inline std::int64_t get_bin_index(const EdgeValue& dist, const EdgeValue& delta) {
+    ONEDAL_ASSERT(delta > 0);
+    ONEDAL_ASSERT(dist / delta <= std::numeric_limits<EdgeValue>::max());
+    ONEDAL_ASSERT(dist / delta <= static_cast<EdgeValue>(std::numeric_limits<std::int64_t>::max()));
+    return static_cast<std::int64_t>(dist / delta);
+}
+
 template <typename Vertex, typename EdgeValue, typename BinsVector>
 inline void update_bins(const Vertex& v,
                         const EdgeValue& new_dist,
                         const EdgeValue& delta,
                         BinsVector& local_bins) {
     ONEDAL_ASSERT(new_dist > 0);
-    ONEDAL_ASSERT(delta > 0);
-    ONEDAL_ASSERT(new_dist / delta <= std::numeric_limits<EdgeValue>::max());
-    ONEDAL_ASSERT(new_dist / delta <=
-                  static_cast<EdgeValue>(std::numeric_limits<std::int64_t>::max()));
-    const std::int64_t dest_bin = static_cast<std::int64_t>(new_dist / delta);
+    const std::int64_t dest_bin = get_bin_index(new_dist, delta);
     ONEDAL_ASSERT(dest_bin >= 0);
     if (dest_bin >= local_bins.size()) {
         local_bins.resize(dest_bin + 1);
@@ -48,12 +53,15 @@ inline void update_bins(const Vertex& v,
     local_bins[dest_bin].push_back(v);
 }
 
+/// Relaxes the edges outgoing from `u`. If `pred` is not null, `u` becomes the
+/// predecessor of each vertex whose distance it improves
 template <typename Topology, typename EdgeValue, typename BinsVector>
 inline void relax_edges(const Topology& t,
                         const EdgeValue* vals,
                         typename Topology::vertex_type u,
                         EdgeValue delta,
                         EdgeValue* dist,
+                        typename Topology::vertex_type* pred,
                         BinsVector& local_bins) {
     for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
         const auto v = t._cols_ptr[v_];
@@ -62,42 +70,9 @@ inline void relax_edges(const Topology& t,
         const EdgeValue new_dist = dist[u] + v_w;
         if (new_dist < old_dist) {
             dist[v] = new_dist;
-            update_bins(v, new_dist, delta, local_bins);
-        }
-    }
-}
-
-template <typename EV, typename VT>
-struct dist_pred {
-    dist_pred(const EV& dist_, const VT& pred_) : dist(dist_), pred(pred_) {}
-    EV dist = 0;
-    VT pred = 0;
-};
-
-template <class T1, class T2>
-bool operator==(const dist_pred<T1, T2>& lhs, const dist_pred<T1, T2>& rhs) {
-    return lhs.first == rhs.first && lhs.second == rhs.second;
-}
-
-template <class T1, class T2>
-bool operator!=(const dist_pred<T1, T2>& lhs, const dist_pred<T1, T2>& rhs) {
-    return !(lhs == rhs);
-}
-
-template <typename Topology, typename EdgeValue, typename DP, typename BinsVector>
-inline void relax_edges_with_pred(const Topology& t,
-                                  const EdgeValue* vals,
-                                  typename Topology::vertex_type u,
-                                  EdgeValue delta,
-                                  DP* dp,
-                                  BinsVector& local_bins) {
-    for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
-        const auto v = t._cols_ptr[v_];
-        const auto v_w = vals[v_];
-        auto old_dp = dp[v];
-        const EdgeValue new_dist = dp[u].dist + v_w;
-        if (new_dist < old_dp.dist) {
-            dp[v] = dist_pred(new_dist, u);
+            if (pred != nullptr) {
+                pred[v] = u;
+            }
             update_bins(v, new_dist, delta, local_bins);
         }
     }
@@ -139,216 +114,429 @@ inline std::int64_t reduce_to_common_bin_seq(const std::int64_t& curr_bin_index,
     return curr_shared_bin_tail;
 }
 
-template <typename Cpu, typename EdgeValue>
-struct delta_stepping {
-    traverse_result<task::one_to_all> operator()(
-        const detail::descriptor_base<task::one_to_all>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t,
-        const EdgeValue* vals,
-        byte_alloc_iface* alloc_ptr) {
-        {
-            using value_type = EdgeValue;
-            using vertex_type = std::int32_t;
-            using value_allocator_type = inner_alloc<value_type>;
-            using vertex_allocator_type = inner_alloc<vertex_type>;
-
-            vertex_allocator_type vertex_allocator(alloc_ptr);
-            value_allocator_type value_allocator(alloc_ptr);
-
-            const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
-            const value_type delta = desc.get_delta();
-
-            const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
-            const std::int64_t max_elements_in_bin = 1000;
-            const auto vertex_count = t.get_vertex_count();
-            const value_type max_dist = std::numeric_limits<value_type>::max();
-
-            value_type* dist = allocate(value_allocator, vertex_count);
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                dist[i] = max_dist;
+/// The graphs with less vertices are processed by the sequential kernels
+constexpr std::int64_t min_vertex_count_for_parallel_traverse = 1024;
+
+inline bool use_parallel_delta_stepping(std::int64_t vertex_count) {
+    return vertex_count >= min_vertex_count_for_parallel_traverse &&
+           dal::detail::threader_get_max_threads() > 1;
+}
+
+/// Relaxes either light (`weight < delta`) or heavy edges outgoing from `u`.
+/// The distances are updated with atomic minimum, so the edges can be relaxed
+/// concurrently. The improved vertices are put to the bins of the calling thread
+template <typename Topology, typename EdgeValue, typename BinsVector>
+inline void relax_edges_par(const Topology& t,
+                            const EdgeValue* vals,
+                            typename Topology::vertex_type u,
+                            EdgeValue delta,
+                            bool light,
+                            EdgeValue* dist,
+                            BinsVector& local_bins) {
+    const EdgeValue dist_u = dal::detail::atomic_load_relaxed(dist[u]);
+    for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+        const auto v_w = vals[v_];
+        if ((v_w < delta) != light) {
+            continue;
+        }
+        const auto v = t._cols_ptr[v_];
+        const EdgeValue new_dist = dist_u + v_w;
+        if (dal::detail::atomic_min(dist[v], new_dist)) {
+            update_bins(v, new_dist, delta, local_bins);
+        }
+    }
+}
+
+/// Finds the first non-empty bin with the index not less than `curr_bin_index`
+/// among the bins of all threads
+template <typename BinsVector>
+inline bool find_next_bin_index_par(std::int64_t& curr_bin_index, const BinsVector& local_bins) {
+    const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+    std::int64_t next_bin_index = std::numeric_limits<std::int64_t>::max();
+    for (std::int64_t thread = 0; thread < local_bins.size(); thread++) {
+        const auto& thread_bins = local_bins[thread];
+        const std::int64_t last = std::min(thread_bins.size(), next_bin_index);
+        for (std::int64_t i = curr_bin_index; i < last; i++) {
+            if (!thread_bins[i].empty()) {
+                next_bin_index = i;
+                break;
             }
+        }
+    }
+
+    const bool is_queue_empty = (next_bin_index == std::numeric_limits<std::int64_t>::max());
+    if (!is_queue_empty) {
+        curr_bin_index = std::min(next_bin_index, max_bin_count);
+    }
+    return is_queue_empty;
+}
 
-            dist[source] = 0;
+/// Moves the contents of per-thread vectors to `shared_bin` in parallel and
+/// returns the number of moved elements. `get_thread_vector(thread)` returns
+/// the pointer to the vector of the thread or `nullptr` if the thread has no one
+template <typename GetThreadVector, typename OffsetContainer, typename SharedBinContainer>
+inline std::int64_t merge_thread_vectors_par(std::int64_t thread_count,
+                                             GetThreadVector&& get_thread_vector,
+                                             OffsetContainer& offsets,
+                                             SharedBinContainer& shared_bin) {
+    ONEDAL_ASSERT(offsets.size() > thread_count);
+    offsets[0] = 0;
+    for (std::int64_t thread = 0; thread < thread_count; thread++) {
+        const auto thread_vector = get_thread_vector(thread);
+        const std::int64_t size = thread_vector ? thread_vector->size() : 0;
+        offsets[thread + 1] = offsets[thread] + size;
+    }
 
-            vector_container<vertex_type, vertex_allocator_type> shared_bin(t.get_edge_count(),
-                                                                            vertex_allocator);
+    const std::int64_t total_size = offsets[thread_count];
+    if (total_size > shared_bin.size()) {
+        shared_bin.resize(total_size);
+    }
 
-            shared_bin[0] = source;
-            std::int64_t curr_bin_index = 0;
-            std::int64_t curr_shared_bin_tail = 1;
-            bool empty_queue = false;
+    dal::detail::threader_for(thread_count, thread_count, [&](std::int32_t thread) {
+        auto thread_vector = get_thread_vector(thread);
+        if (thread_vector && !thread_vector->empty()) {
+            copy(thread_vector->begin(),
+                 thread_vector->end(),
+                 shared_bin.get_mutable_data() + offsets[thread]);
+            thread_vector->resize(0);
+        }
+    });
+    return total_size;
+}
 
-            using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
-            using v1a_t = inner_alloc<v1v_t>;
-            using v2v_t = vector_container<v1v_t, v1a_t>;
-            using v2a_t = inner_alloc<v2v_t>;
-            using v3v_t = vector_container<v2v_t, v2a_t>;
-            v2a_t v2a(alloc_ptr);
-            v3v_t local_bins(1, v2a);
+template <typename BinsVector, typename OffsetContainer, typename SharedBinContainer>
+inline std::int64_t reduce_to_common_bin_par(const std::int64_t& curr_bin_index,
+                                             BinsVector& local_bins,
+                                             OffsetContainer& offsets,
+                                             SharedBinContainer& shared_bin) {
+    return merge_thread_vectors_par(
+        local_bins.size(),
+        [&](std::int64_t thread) {
+            auto& thread_bins = local_bins[thread];
+            return curr_bin_index < thread_bins.size() ? &thread_bins[curr_bin_index] : nullptr;
+        },
+        offsets,
+        shared_bin);
+}
 
-            std::int64_t iter = 0;
+/// Parallel delta-stepping. Each thread puts the vertices to its own array of
+/// bins. The bins with the current index are merged into the shared frontier which
+/// is processed in parallel while the light edges refill the current bin. Then
+/// the heavy edges of all vertices settled in the bin are relaxed at once.
+/// `relax(u, light, local_bins)` relaxes the edges of `u`.
+template <typename Topology, typename EdgeValue, typename Relax>
+inline void delta_stepping_par(const Topology& t,
+                               typename Topology::vertex_type source,
+                               EdgeValue delta,
+                               const EdgeValue* dist,
+                               byte_alloc_iface* alloc_ptr,
+                               Relax&& relax) {
+    using vertex_type = typename Topology::vertex_type;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+    using offset_allocator_type = inner_alloc<std::int64_t>;
+    using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
+    using v1a_t = inner_alloc<v1v_t>;
+    using v2v_t = vector_container<v1v_t, v1a_t>;
+    using v2a_t = inner_alloc<v2v_t>;
+    using v3v_t = vector_container<v2v_t, v2a_t>;
 
-            while (curr_bin_index != max_bin_count && iter != max_bin_count && !empty_queue) {
-                for (std::int64_t i = 0; i < curr_shared_bin_tail; ++i) {
-                    vertex_type u = shared_bin[i];
-                    if (dist[u] >= delta * static_cast<value_type>(curr_bin_index)) {
-                        relax_edges(t, vals, u, delta, dist, local_bins[0]);
-                    }
-                }
+    const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+
+    vertex_allocator_type vertex_allocator(alloc_ptr);
+    v1a_t v1a(alloc_ptr);
+    v2a_t v2a(alloc_ptr);
+    v3v_t local_bins(thread_count, v2a);
+    v2v_t local_settled(thread_count, v1a);
+
+    v1v_t shared_bin(t.get_vertex_count(), vertex_allocator);
+    v1v_t shared_settled(t.get_vertex_count(), vertex_allocator);
+    vector_container<std::int64_t, offset_allocator_type> offsets(
+        thread_count + 1,
+        offset_allocator_type(alloc_ptr));
+
+    local_bins[0].resize(1);
+    local_bins[0][0].push_back(source);
+
+    std::int64_t curr_bin_index = 0;
+    while (!find_next_bin_index_par(curr_bin_index, local_bins) &&
+           curr_bin_index != max_bin_count) {
+        for (;;) {
+            const std::int64_t frontier_size =
+                reduce_to_common_bin_par(curr_bin_index, local_bins, offsets, shared_bin);
+            if (frontier_size == 0) {
+                break;
+            }
 
-                while (curr_bin_index < local_bins[0].size() &&
-                       !local_bins[0][curr_bin_index].empty() &&
-                       local_bins[0][curr_bin_index].size() < max_elements_in_bin) {
-                    vector_container<vertex_type> curr_bin_copy(
-                        local_bins[0][curr_bin_index].size());
-                    copy(local_bins[0][curr_bin_index].begin(),
-                         local_bins[0][curr_bin_index].end(),
-                         curr_bin_copy.begin());
-
-                    local_bins[0][curr_bin_index].resize(0);
-                    for (std::int64_t j = 0; j < curr_bin_copy.size(); ++j) {
-                        relax_edges(t, vals, curr_bin_copy[j], delta, dist, local_bins[0]);
-                    }
+            dal::detail::threader_for_int64(frontier_size, [&](std::int64_t i) {
+                const vertex_type u = shared_bin[i];
+                const EdgeValue dist_u = dal::detail::atomic_load_relaxed(dist[u]);
+                // Skip the vertex moved to the bin with less index
+                if (get_bin_index(dist_u, delta) < curr_bin_index) {
+                    return;
                 }
 
-                empty_queue = find_next_bin_index_seq(curr_bin_index, local_bins);
+                const int thread = dal::detail::threader_get_current_thread_index();
+                ONEDAL_ASSERT(thread < thread_count);
+                local_settled[thread].push_back(u);
+                relax(u, true, local_bins[thread]);
+            });
+        }
 
-                curr_shared_bin_tail =
-                    reduce_to_common_bin_seq(curr_bin_index, local_bins, shared_bin);
+        const std::int64_t settled_count = merge_thread_vectors_par(
+            thread_count,
+            [&](std::int64_t thread) {
+                return &local_settled[thread];
+            },
+            offsets,
+            shared_settled);
+
+        dal::detail::threader_for_int64(settled_count, [&](std::int64_t i) {
+            const int thread = dal::detail::threader_get_current_thread_index();
+            ONEDAL_ASSERT(thread < thread_count);
+            relax(shared_settled[i], false, local_bins[thread]);
+        });
+    }
+}
 
-                iter++;
+template <typename EdgeValue>
+inline EdgeValue* allocate_distances(inner_alloc<EdgeValue>& value_allocator,
+                                     std::int64_t vertex_count,
+                                     std::int64_t source) {
+    EdgeValue* dist = allocate(value_allocator, vertex_count);
+    const EdgeValue max_dist = std::numeric_limits<EdgeValue>::max();
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t i) {
+        dist[i] = max_dist;
+    });
+    dist[source] = 0;
+    return dist;
+}
+
+/// Computes the predecessors from the final distances, so they do not depend on
+/// the order of the relaxations. The predecessor of the vertex is the smallest
+/// vertex with the shortest path through the edge increasing the distance. The
+/// vertices reached only by the edges that keep the distance take the parents in
+/// the breadth first order started from the other reachable vertices
+template <typename Topology, typename EdgeValue>
+inline void compute_predecessors(const Topology& t,
+                                 const EdgeValue* vals,
+                                 typename Topology::vertex_type source,
+                                 const EdgeValue* dist,
+                                 typename Topology::vertex_type* pred,
+                                 byte_alloc_iface* alloc_ptr) {
+    using vertex_type = typename Topology::vertex_type;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+
+    const std::int64_t vertex_count = t.get_vertex_count();
+    const EdgeValue max_dist = std::numeric_limits<EdgeValue>::max();
+    const vertex_type no_pred = std::numeric_limits<vertex_type>::max();
+
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t i) {
+        pred[i] = no_pred;
+    });
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+        const EdgeValue dist_u = dist[u];
+        if (dist_u == max_dist) {
+            return;
+        }
+        for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+            const auto v = t._cols_ptr[v_];
+            if (v != source && dist_u < dist[v] && dist_u + vals[v_] == dist[v]) {
+                dal::detail::atomic_min(pred[v], static_cast<vertex_type>(u));
+            }
+        }
+    });
+
+    vertex_allocator_type vertex_allocator(alloc_ptr);
+    vector_container<vertex_type, vertex_allocator_type> queue(vertex_count, vertex_allocator);
+    std::int64_t tail = 0;
+    bool has_unresolved = false;
+    for (std::int64_t v = 0; v < vertex_count; ++v) {
+        if (v == source || pred[v] != no_pred) {
+            queue[tail++] = v;
+        }
+        else if (dist[v] != max_dist) {
+            has_unresolved = true;
+        }
+    }
+    for (std::int64_t head = 0; has_unresolved && head < tail; ++head) {
+        const vertex_type u = queue[head];
+        for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+            const auto v = t._cols_ptr[v_];
+            if (v != source && pred[v] == no_pred && dist[u] == dist[v] &&
+                dist[u] + vals[v_] == dist[v]) {
+                pred[v] = u;
+                queue[tail++] = v;
             }
+        }
+    }
+
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t i) {
+        if (pred[i] == no_pred) {
+            pred[i] = -1;
+        }
+    });
+}
+
+/// Computes the distances from the source. The graphs with less than
+/// `min_vertex_count_for_parallel_traverse` vertices or the calls limited to a
+/// single thread are processed by the sequential delta-stepping. If `pred` is not
+/// null, the predecessors are computed as well: the sequential kernel keeps the
+/// vertex which relaxed the final distance first, while the parallel one derives
+/// the predecessors from the distances, so they do not depend on the schedule
+template <typename Topology, typename EdgeValue>
+inline void compute_distances(const Topology& t,
+                              const EdgeValue* vals,
+                              typename Topology::vertex_type source,
+                              EdgeValue delta,
+                              EdgeValue* dist,
+                              typename Topology::vertex_type* pred,
+                              byte_alloc_iface* alloc_ptr) {
+    using vertex_type = typename Topology::vertex_type;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+
+    if (use_parallel_delta_stepping(t.get_vertex_count())) {
+        delta_stepping_par(t,
+                           source,
+                           delta,
+                           dist,
+                           alloc_ptr,
+                           [&](vertex_type u, bool light, auto& local_bins) {
+                               relax_edges_par(t, vals, u, delta, light, dist, local_bins);
+                           });
+        if (pred != nullptr) {
+            compute_predecessors(t, vals, source, dist, pred, alloc_ptr);
+        }
+        return;
+    }
 
-            auto dist_arr = array<value_type>::empty(vertex_count);
-            value_type* dist_ = dist_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                dist_[i] = dist[i];
+    const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+    const std::int64_t max_elements_in_bin = 1000;
+
+    vertex_allocator_type vertex_allocator(alloc_ptr);
+    vector_container<vertex_type, vertex_allocator_type> shared_bin(t.get_edge_count(),
+                                                                    vertex_allocator);
+
+    shared_bin[0] = source;
+    std::int64_t curr_bin_index = 0;
+    std::int64_t curr_shared_bin_tail = 1;
+    bool empty_queue = false;
+
+    using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
+    using v1a_t = inner_alloc<v1v_t>;
+    using v2v_t = vector_container<v1v_t, v1a_t>;
+    using v2a_t = inner_alloc<v2v_t>;
+    using v3v_t = vector_container<v2v_t, v2a_t>;
+    v2a_t v2a(alloc_ptr);
+    v3v_t local_bins(1, v2a);
+
+    std::int64_t iter = 0;
+
+    while (curr_bin_index != max_bin_count && iter != max_bin_count && !empty_queue) {
+        for (std::int64_t i = 0; i < curr_shared_bin_tail; ++i) {
+            vertex_type u = shared_bin[i];
+            if (dist[u] >= delta * static_cast<EdgeValue>(curr_bin_index)) {
+                relax_edges(t, vals, u, delta, dist, pred, local_bins[0]);
             }
+        }
 
-            deallocate(value_allocator, dist, vertex_count);
-            return traverse_result<task::one_to_all>().set_distances(
-                dal::detail::homogen_table_builder{}
-                    .reset(dist_arr, t.get_vertex_count(), 1)
-                    .build());
+        while (curr_bin_index < local_bins[0].size() && !local_bins[0][curr_bin_index].empty() &&
+               local_bins[0][curr_bin_index].size() < max_elements_in_bin) {
+            vector_container<vertex_type> curr_bin_copy(local_bins[0][curr_bin_index].size());
+            copy(local_bins[0][curr_bin_index].begin(),
+                 local_bins[0][curr_bin_index].end(),
+                 curr_bin_copy.begin());
+
+            local_bins[0][curr_bin_index].resize(0);
+            for (std::int64_t j = 0; j < curr_bin_copy.size(); ++j) {
+                relax_edges(t, vals, curr_bin_copy[j], delta, dist, pred, local_bins[0]);
+            }
         }
+
+        empty_queue = find_next_bin_index_seq(curr_bin_index, local_bins);
+
+        curr_shared_bin_tail = reduce_to_common_bin_seq(curr_bin_index, local_bins, shared_bin);
+
+        iter++;
     }
-};
+}
 
-template <typename Cpu, typename EdgeValue>
-struct delta_stepping_with_pred {
+template <typename Cpu, typename EdgeValue, typename IndexType>
+struct delta_stepping {
     traverse_result<task::one_to_all> operator()(
         const detail::descriptor_base<task::one_to_all>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t,
+        const dal::preview::detail::topology<IndexType>& t,
         const EdgeValue* vals,
         byte_alloc_iface* alloc_ptr) {
         using value_type = EdgeValue;
-        using vertex_type = std::int32_t;
-        using vp_type = dist_pred<value_type, vertex_type>;
-        using vp_allocator_type = inner_alloc<vp_type>;
-        using vertex_allocator_type = inner_alloc<vertex_type>;
-
-        vertex_allocator_type vertex_allocator(alloc_ptr);
-        vp_allocator_type vp_allocator(alloc_ptr);
+        using value_allocator_type = inner_alloc<value_type>;
 
-        const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
+        value_allocator_type value_allocator(alloc_ptr);
 
+        const auto source = dal::detail::integral_cast<IndexType>(desc.get_source());
         const value_type delta = desc.get_delta();
-
-        const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
-        const std::int64_t max_elements_in_bin = 1000;
         const auto vertex_count = t.get_vertex_count();
-        const value_type max_dist = std::numeric_limits<value_type>::max();
 
-        vp_type* dp = allocate(vp_allocator, vertex_count);
+        value_type* dist = allocate_distances(value_allocator, vertex_count, source);
+        compute_distances(t, vals, source, delta, dist, nullptr, alloc_ptr);
+
+        auto dist_arr = array<value_type>::empty(vertex_count);
+        value_type* dist_ = dist_arr.get_mutable_data();
         for (std::int64_t i = 0; i < vertex_count; ++i) {
-            new (dp + i) dist_pred<value_type, vertex_type>(max_dist, -1);
+            dist_[i] = dist[i];
         }
 
-        dp[source] = dist_pred<value_type, vertex_type>(0, -1);
-
-        vector_container<vertex_type, vertex_allocator_type> shared_bin(t.get_edge_count(),
-                                                                        vertex_allocator);
-
-        shared_bin[0] = source;
-        std::int64_t curr_bin_index = 0;
-        std::int64_t curr_shared_bin_tail = 1;
-        bool empty_queue = false;
-
-        using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
-        using v1a_t = inner_alloc<v1v_t>;
-
-        using v2v_t = vector_container<v1v_t, v1a_t>;
-        using v2a_t = inner_alloc<v2v_t>;
-        using v3v_t = vector_container<v2v_t, v2a_t>;
-
-        v2a_t v2a(alloc_ptr);
-        v3v_t local_bins(1, v2a);
-
-        std::int64_t iter = 0;
+        deallocate(value_allocator, dist, vertex_count);
+        return traverse_result<task::one_to_all>().set_distances(
+            dal::detail::homogen_table_builder{}
+                .reset(dist_arr, t.get_vertex_count(), 1)
+                .build());
+    }
+};
 
-        while (curr_bin_index != max_bin_count && iter != max_bin_count && !empty_queue) {
-            for (std::int64_t i = 0; i < curr_shared_bin_tail; ++i) {
-                vertex_type u = shared_bin[i];
-                if (dp[u].dist >= delta * static_cast<value_type>(curr_bin_index)) {
-                    relax_edges_with_pred(t, vals, u, delta, dp, local_bins[0]);
-                }
-            }
+template <typename Cpu, typename EdgeValue, typename IndexType>
+struct delta_stepping_with_pred {
+    traverse_result<task::one_to_all> operator()(
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<IndexType>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        using value_type = EdgeValue;
+        using vertex_type = IndexType;
 
-            while (curr_bin_index < local_bins[0].size() &&
-                   !local_bins[0][curr_bin_index].empty() &&
-                   local_bins[0][curr_bin_index].size() < max_elements_in_bin) {
-                vector_container<vertex_type> curr_bin_copy(local_bins[0][curr_bin_index].size());
-                copy(local_bins[0][curr_bin_index].begin(),
-                     local_bins[0][curr_bin_index].end(),
-                     curr_bin_copy.begin());
-
-                local_bins[0][curr_bin_index].resize(0);
-                for (std::int64_t j = 0; j < curr_bin_copy.size(); ++j) {
-                    relax_edges_with_pred(t, vals, curr_bin_copy[j], delta, dp, local_bins[0]);
-                }
-            }
+        const auto source = dal::detail::integral_cast<IndexType>(desc.get_source());
+        const value_type delta = desc.get_delta();
+        const auto vertex_count = t.get_vertex_count();
+        const value_type max_dist = std::numeric_limits<value_type>::max();
 
-            empty_queue = find_next_bin_index_seq(curr_bin_index, local_bins);
+        auto dist_arr = array<value_type>::empty(vertex_count);
+        auto pred_arr = array<vertex_type>::empty(vertex_count);
+        value_type* dist = dist_arr.get_mutable_data();
+        vertex_type* pred = pred_arr.get_mutable_data();
 
-            curr_shared_bin_tail = reduce_to_common_bin_seq(curr_bin_index, local_bins, shared_bin);
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t i) {
+            dist[i] = max_dist;
+            pred[i] = -1;
+        });
+        dist[source] = 0;
 
-            iter++;
-        }
+        compute_distances(t, vals, source, delta, dist, pred, alloc_ptr);
+        return make_result(desc, dist_arr, pred_arr, vertex_count);
+    }
 
+private:
+    static traverse_result<task::one_to_all> make_result(
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const array<EdgeValue>& dist_arr,
+        const array<IndexType>& pred_arr,
+        std::int64_t vertex_count) {
+        auto result = traverse_result<task::one_to_all>().set_predecessors(
+            dal::detail::homogen_table_builder{}.reset(pred_arr, vertex_count, 1).build());
         if (desc.get_optional_results() & optional_results::distances) {
-            auto dist_arr = array<value_type>::empty(vertex_count);
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            value_type* dist_ = dist_arr.get_mutable_data();
-            vertex_type* pred_ = pred_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                const auto dp_i = dp[i];
-                dist_[i] = dp_i.dist;
-                pred_[i] = dp_i.pred;
-            }
-
-            deallocate(vp_allocator, dp, vertex_count);
-            return traverse_result<task::one_to_all>()
-                .set_distances(dal::detail::homogen_table_builder{}
-                                   .reset(dist_arr, t.get_vertex_count(), 1)
-                                   .build())
-                .set_predecessors(dal::detail::homogen_table_builder{}
-                                      .reset(pred_arr, t.get_vertex_count(), 1)
-                                      .build());
-        }
-        else {
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            vertex_type* pred_ = pred_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                const auto dp_i = dp[i];
-                pred_[i] = dp_i.pred;
-            }
-
-            deallocate(vp_allocator, dp, vertex_count);
-            return traverse_result<task::one_to_all>().set_predecessors(
-                dal::detail::homogen_table_builder{}
-                    .reset(pred_arr, t.get_vertex_count(), 1)
-                    .build());
+            result.set_distances(
+                dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build());
         }
+        return result;
     }
 };
 
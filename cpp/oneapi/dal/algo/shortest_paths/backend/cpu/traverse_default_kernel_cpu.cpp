@@ -18,12 +18,15 @@
 
 namespace oneapi::dal::preview::shortest_paths::backend {
 
-template struct delta_stepping<__CPU_TAG__, std::int32_t>;
+#define INSTANTIATE(EdgeValue, IndexType)                              \
+    template struct delta_stepping<__CPU_TAG__, EdgeValue, IndexType>; \
+    template struct delta_stepping_with_pred<__CPU_TAG__, EdgeValue, IndexType>;
 
-template struct delta_stepping<__CPU_TAG__, double>;
+INSTANTIATE(std::int32_t, std::int32_t)
+INSTANTIATE(double, std::int32_t)
+INSTANTIATE(std::int32_t, std::int64_t)
+INSTANTIATE(double, std::int64_t)
 
-template struct delta_stepping_with_pred<__CPU_TAG__, std::int32_t>;
-
-template struct delta_stepping_with_pred<__CPU_TAG__, double>;
+#undef INSTANTIATE
 
 } // namespace oneapi::dal::preview::shortest_paths::backend
@@ -20,53 +20,57 @@
 
 namespace oneapi::dal::preview::shortest_paths::detail {
 
-template <typename Float, typename EdgeValue>
+template <typename Float, typename EdgeValue, typename IndexType>
 traverse_result<task::one_to_all>
-delta_stepping<Float, task::one_to_all, dal::preview::detail::topology<std::int32_t>, EdgeValue>::
+delta_stepping<Float, task::one_to_all, dal::preview::detail::topology<IndexType>, EdgeValue>::
 operator()(const dal::detail::host_policy& policy,
            const detail::descriptor_base<task::one_to_all>& desc,
-           const dal::preview::detail::topology<std::int32_t>& t,
+           const dal::preview::detail::topology<IndexType>& t,
            const EdgeValue* vals,
            byte_alloc_iface* alloc_ptr) const {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
-        return backend::delta_stepping<decltype(cpu), EdgeValue>{}(desc, t, vals, alloc_ptr);
+        return backend::delta_stepping<decltype(cpu), EdgeValue, IndexType>{}(desc,
+                                                                              t,
+                                                                              vals,
+                                                                              alloc_ptr);
     });
 }
 
-template <typename Float, typename EdgeValue>
+template <typename Float, typename EdgeValue, typename IndexType>
 traverse_result<task::one_to_all> delta_stepping_with_pred<
     Float,
     task::one_to_all,
-    dal::preview::detail::topology<std::int32_t>,
+    dal::preview::detail::topology<IndexType>,
     EdgeValue>::operator()(const dal::detail::host_policy& policy,
                            const detail::descriptor_base<task::one_to_all>& desc,
-                           const dal::preview::detail::topology<std::int32_t>& t,
+                           const dal::preview::detail::topology<IndexType>& t,
                            const EdgeValue* vals,
                            byte_alloc_iface* alloc_ptr) const {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
-        return backend::delta_stepping_with_pred<decltype(cpu), EdgeValue>{}(desc,
-                                                                             t,
-                                                                             vals,
-                                                                             alloc_ptr);
+        return backend::delta_stepping_with_pred<decltype(cpu), EdgeValue, IndexType>{}(desc,
+                                                                                        t,
+                                                                                        vals,
+                                                                                        alloc_ptr);
     });
 }
 
-template struct ONEDAL_EXPORT delta_stepping<float,
-                                             task::one_to_all,
-                                             dal::preview::detail::topology<std::int32_t>,
-                                             std::int32_t>;
+#define INSTANTIATE(EdgeValue, IndexType)                                                   \
+    template struct ONEDAL_EXPORT delta_stepping<float,                                     \
+                                                 task::one_to_all,                          \
+                                                 dal::preview::detail::topology<IndexType>, \
+                                                 EdgeValue>;                                \
+                                                                                            \
+    template struct ONEDAL_EXPORT                                                           \
+        delta_stepping_with_pred<float,                                                     \
+                                 task::one_to_all,                                          \
+                                 dal::preview::detail::topology<IndexType>,                 \
+                                 EdgeValue>;
 
-template struct ONEDAL_EXPORT
-    delta_stepping<float, task::one_to_all, dal::preview::detail::topology<std::int32_t>, double>;
+INSTANTIATE(std::int32_t, std::int32_t)
+INSTANTIATE(double, std::int32_t)
+INSTANTIATE(std::int32_t, std::int64_t)
+INSTANTIATE(double, std::int64_t)
 
-template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
-                                                       task::one_to_all,
-                                                       dal::preview::detail::topology<std::int32_t>,
-                                                       std::int32_t>;
-
-template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
-                                                       task::one_to_all,
-                                                       dal::preview::detail::topology<std::int32_t>,
-                                                       double>;
+#undef INSTANTIATE
 
 } // namespace oneapi::dal::preview::shortest_paths::detail
@@ -45,15 +45,15 @@ struct delta_stepping {
                                      byte_alloc_iface* alloc) const;
 };
 
-template <typename Float, typename EdgeValue>
+template <typename Float, typename EdgeValue, typename IndexType>
 struct delta_stepping<Float,
                       task::one_to_all,
-                      dal::preview::detail::topology<std::int32_t>,
+                      dal::preview::detail::topology<IndexType>,
                       EdgeValue> {
     traverse_result<task::one_to_all> operator()(
         const dal::detail::host_policy& ctx,
         const detail::descriptor_base<task::one_to_all>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t,
+        const dal::preview::detail::topology<IndexType>& t,
         const EdgeValue* vals,
         byte_alloc_iface* alloc) const;
 };
@@ -67,15 +67,15 @@ struct delta_stepping_with_pred {
                                      byte_alloc_iface* alloc) const;
 };
 
-template <typename Float, typename EdgeValue>
+template <typename Float, typename EdgeValue, typename IndexType>
 struct delta_stepping_with_pred<Float,
                                 task::one_to_all,
-                                dal::preview::detail::topology<std::int32_t>,
+                                dal::preview::detail::topology<IndexType>,
                                 EdgeValue> {
     traverse_result<task::one_to_all> operator()(
         const dal::detail::host_policy& ctx,
         const detail::descriptor_base<task::one_to_all>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t,
+        const dal::preview::detail::topology<IndexType>& t,
         const EdgeValue* vals,
         byte_alloc_iface* alloc) const;
 };
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/shortest_paths/traverse.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+
+namespace oneapi::dal::algo::shortest_paths::test {
+
+namespace sp = dal::preview::shortest_paths;
+namespace te = dal::test::engine;
+
+using graph_t = dal::preview::directed_adjacency_vector_graph<std::int32_t, double>;
+
+class shortest_paths_perf_test {
+public:
+    /// Generates the directed graph of the random edges with the uniform weights
+    /// from 0 to 1
+    graph_t create_graph(std::int64_t vertex_count, std::int64_t average_degree) {
+        const auto neighbors =
+            te::make_adjacency(vertex_count,
+                               te::generate_edges(vertex_count, vertex_count * average_degree),
+                               true);
+        std::mt19937 generator(7777);
+        std::uniform_real_distribution<double> weight(0.0, 1.0);
+        weights_.clear();
+        for (const auto &list : neighbors) {
+            for (std::size_t i = 0; i < list.size(); ++i) {
+                weights_.push_back(weight(generator));
+            }
+        }
+        return builder_.build<graph_t>(neighbors, weights_);
+    }
+
+    /// The thread counts from one to the maximal one doubling each time
+    static std::vector<std::int64_t> get_thread_counts() {
+        const std::int64_t max_thread_count = dal::detail::threader_get_max_threads();
+        std::vector<std::int64_t> thread_counts;
+        for (std::int64_t count = 1; count < max_thread_count; count *= 2) {
+            thread_counts.push_back(count);
+        }
+        thread_counts.push_back(max_thread_count);
+        return thread_counts;
+    }
+
+    /// Runs the algorithm within the arena of `thread_count` threads. A single
+    /// thread selects the sequential kernel
+    template <typename Descriptor>
+    static auto traverse(std::int64_t thread_count, const Descriptor &desc, const graph_t &g) {
+        std::optional<sp::traverse_result<sp::task::one_to_all>> result;
+        dal::detail::threader_execute_in_arena(thread_count, -1, [&]() {
+            result.emplace(dal::preview::traverse(desc, g));
+        });
+        return std::move(*result);
+    }
+
+private:
+    te::graph_builder builder_;
+    std::vector<double> weights_;
+};
+
+TEST_M(shortest_paths_perf_test,
+       "benchmark for shortest paths scaling",
+       "[shortest_paths][perf]") {
+    const std::int64_t vertex_count = GENERATE(1 << 16, 1 << 20, 1 << 22);
+    const std::int64_t average_degree = GENERATE(4, 16);
+    const auto g = create_graph(vertex_count, average_degree);
+    const auto optional_results = GENERATE(sp::optional_results::distances,
+                                           sp::optional_results::distances |
+                                               sp::optional_results::predecessors);
+    const auto desc = sp::descriptor<>(0, 1.0 / average_degree, optional_results);
+
+    const auto graph_name = fmt::format("vertex_count {}, average_degree {}, {}",
+                                        vertex_count,
+                                        average_degree,
+                                        (optional_results & sp::optional_results::predecessors)
+                                            ? "predecessors"
+                                            : "distances");
+    for (const std::int64_t thread_count : get_thread_counts()) {
+        BENCHMARK(fmt::format("Delta-stepping: {}, {} threads", graph_name, thread_count)
+                      .c_str()) {
+            return traverse(thread_count, desc, g);
+        };
+    }
+}
+
+} // namespace oneapi::dal::algo::shortest_paths::test
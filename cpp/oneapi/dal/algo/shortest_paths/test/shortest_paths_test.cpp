@@ -14,12 +14,283 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <array>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "oneapi/dal/algo/shortest_paths/traverse.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
 
 #include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+#include "oneapi/dal/test/engine/graph/loader.hpp"
 
 namespace oneapi::dal::algo::shortest_paths::test {
 
+namespace sp = dal::preview::shortest_paths;
+namespace te = dal::test::engine;
+
+template <typename EdgeValue, typename IndexType = std::int32_t>
+using graph_t = dal::preview::
+    directed_adjacency_vector_graph<std::int32_t, EdgeValue, dal::preview::empty_value, IndexType>;
+
+class shortest_paths_test {
+public:
+    /// Generates the directed graph with the random weights from 0 to 4 with the
+    /// step 1/4 for the floating-point weights, so the path lengths are exact
+    template <typename EdgeValue>
+    graph_t<EdgeValue> create_graph(std::int64_t vertex_count, std::int64_t edge_count) {
+        adjacency_ =
+            te::make_adjacency(vertex_count, te::generate_edges(vertex_count, edge_count), true);
+
+        std::mt19937 generator(7777);
+        std::uniform_int_distribution<std::int32_t> weight(0, 16);
+        const double scale = std::is_integral_v<EdgeValue> ? 1.0 : 4.0;
+        weights_.clear();
+        for (const auto &list : adjacency_) {
+            for (std::size_t i = 0; i < list.size(); ++i) {
+                weights_.push_back(weight(generator) / scale);
+            }
+        }
+
+        if constexpr (std::is_integral_v<EdgeValue>) {
+            int32_weights_.assign(weights_.begin(), weights_.end());
+            return builder_.build<graph_t<EdgeValue>>(adjacency_, int32_weights_);
+        }
+        else {
+            return builder_.build<graph_t<EdgeValue>>(adjacency_, weights_);
+        }
+    }
+
+    /// Dijkstra's algorithm
+    std::vector<double> compute_reference_distances(std::int32_t source) const {
+        const double max_dist = std::numeric_limits<double>::max();
+        const std::int64_t vertex_count = adjacency_.size();
+        std::vector<double> dist(vertex_count, max_dist);
+        using item_t = std::pair<double, std::int32_t>;
+        std::priority_queue<item_t, std::vector<item_t>, std::greater<item_t>> queue;
+        dist[source] = 0;
+        queue.emplace(0, source);
+        while (!queue.empty()) {
+            const auto [dist_u, u] = queue.top();
+            queue.pop();
+            if (dist_u > dist[u]) {
+                continue;
+            }
+            const std::int64_t offset = builder_.get_rows()[u];
+            for (std::size_t i = 0; i < adjacency_[u].size(); ++i) {
+                const std::int32_t v = adjacency_[u][i];
+                const double new_dist = dist_u + weights_[offset + i];
+                if (new_dist < dist[v]) {
+                    dist[v] = new_dist;
+                    queue.emplace(new_dist, v);
+                }
+            }
+        }
+        return dist;
+    }
+
+    /// Runs the algorithm within the arena of a single thread, so the sequential
+    /// kernel is used
+    template <typename Descriptor, typename Graph>
+    auto traverse_sequential(const Descriptor &desc, const Graph &g) {
+        std::optional<sp::traverse_result<sp::task::one_to_all>> result;
+        dal::detail::threader_execute_in_arena(1, -1, [&]() {
+            result.emplace(dal::preview::traverse(desc, g));
+        });
+        return std::move(*result);
+    }
+
+    template <typename EdgeValue>
+    void check_distances(const table &distances, const std::vector<double> &reference) {
+        const std::int64_t vertex_count = reference.size();
+        REQUIRE(distances.get_row_count() == vertex_count);
+        REQUIRE(distances.get_column_count() == 1);
+        const auto dist = row_accessor<const EdgeValue>(distances).pull();
+        const EdgeValue max_dist = std::numeric_limits<EdgeValue>::max();
+        for (std::int64_t v = 0; v < vertex_count; ++v) {
+            if (reference[v] == std::numeric_limits<double>::max()) {
+                REQUIRE(dist[v] == max_dist);
+            }
+            else {
+                REQUIRE(double(dist[v]) == reference[v]);
+            }
+        }
+    }
+
+    /// Checks that the predecessor of each reachable vertex ends its shortest path
+    void check_predecessors(const table &predecessors,
+                            const std::vector<double> &reference,
+                            std::int32_t source) {
+        const std::int64_t vertex_count = reference.size();
+        REQUIRE(predecessors.get_row_count() == vertex_count);
+        const auto pred = row_accessor<const std::int32_t>(predecessors).pull();
+        for (std::int32_t v = 0; v < vertex_count; ++v) {
+            const std::int32_t u = pred[v];
+            if (v == source || reference[v] == std::numeric_limits<double>::max()) {
+                REQUIRE(u == -1);
+                continue;
+            }
+            REQUIRE(u >= 0);
+            bool has_tight_edge = false;
+            const std::int64_t offset = builder_.get_rows()[u];
+            for (std::size_t i = 0; i < adjacency_[u].size(); ++i) {
+                has_tight_edge |= (adjacency_[u][i] == v &&
+                                   reference[u] + weights_[offset + i] == reference[v]);
+            }
+            REQUIRE(has_tight_edge);
+        }
+    }
+
+    void check_same(const table &expected, const table &actual) {
+        const auto expected_rows = row_accessor<const double>(expected).pull();
+        const auto actual_rows = row_accessor<const double>(actual).pull();
+        REQUIRE(expected_rows.get_count() == actual_rows.get_count());
+        for (std::int64_t i = 0; i < expected_rows.get_count(); ++i) {
+            REQUIRE(expected_rows[i] == actual_rows[i]);
+        }
+    }
+
+    /// Compares the results of the parallel kernels with the sequential ones and
+    /// the reference distances
+    template <typename EdgeValue>
+    void check(const graph_t<EdgeValue> &g, std::int32_t source, double delta) {
+        const auto reference = compute_reference_distances(source);
+
+        const auto dist_desc = sp::descriptor<>(source, delta);
+        check_distances<EdgeValue>(dal::preview::traverse(dist_desc, g).get_distances(),
+                                   reference);
+        check_distances<EdgeValue>(traverse_sequential(dist_desc, g).get_distances(),
+                                   reference);
+
+        const auto pred_desc =
+            sp::descriptor<>(source,
+                             delta,
+                             sp::optional_results::distances | sp::optional_results::predecessors);
+        const auto result = dal::preview::traverse(pred_desc, g);
+        const auto sequential_result = traverse_sequential(pred_desc, g);
+        check_distances<EdgeValue>(result.get_distances(), reference);
+        check_predecessors(result.get_predecessors(), reference, source);
+        check_predecessors(sequential_result.get_predecessors(), reference, source);
+        check_same(sequential_result.get_distances(), result.get_distances());
+    }
+
+    /// Loads the graph with the 32-bit and the 64-bit vertex indices from the edge
+    /// list and checks that the same paths are found in both graphs
+    template <typename EdgeValue>
+    void check_64_bit_indices(const te::edge_list_t &edges,
+                              const std::vector<double> &weights,
+                              std::int32_t source,
+                              double delta) {
+        const te::edge_list_file file{ "shortest_paths_test.csv", edges, weights };
+        const auto g = file.load<graph_t<EdgeValue>>();
+        const auto g_64 = file.load<graph_t<EdgeValue, std::int64_t>>();
+
+        const auto desc =
+            sp::descriptor<>(source,
+                             delta,
+                             sp::optional_results::distances | sp::optional_results::predecessors);
+        const auto result = dal::preview::traverse(desc, g);
+        const auto result_64 = dal::preview::traverse(desc, g_64);
+        check_same(result.get_distances(), result_64.get_distances());
+        check_same(result.get_predecessors(), result_64.get_predecessors());
+    }
+
+private:
+    te::graph_builder builder_;
+    te::adjacency_t adjacency_;
+    std::vector<double> weights_;
+    std::vector<std::int32_t> int32_weights_;
+};
+
+TEST_M(shortest_paths_test, "distances and predecessors of a small graph", "[shortest_paths]") {
+    // The vertex 3 is reached by the paths of the same length through the vertices
+    // 1, 2 and 4, the vertex 1 relaxes it first
+    const te::adjacency_t neighbors = { { 1, 2 }, { 3 }, { 3, 4 }, {}, { 3 }, {} };
+    const std::vector<std::int32_t> weights = { 1, 1, 1, 1, 1, 0 };
+    te::graph_builder builder;
+    const auto g = builder.build<graph_t<std::int32_t>>(neighbors, weights);
+
+    const auto desc = sp::descriptor<>(0,
+                                       1.0,
+                                       sp::optional_results::distances |
+                                           sp::optional_results::predecessors);
+    const auto result = dal::preview::traverse(desc, g);
+
+    const auto dist = row_accessor<const std::int32_t>(result.get_distances()).pull();
+    const auto pred = row_accessor<const std::int32_t>(result.get_predecessors()).pull();
+    const std::int32_t max_dist = std::numeric_limits<std::int32_t>::max();
+    const std::int32_t expected_dist[] = { 0, 1, 1, 2, 2, max_dist };
+    const std::int32_t expected_pred[] = { -1, 0, 0, 1, 2, -1 };
+    for (std::int64_t v = 0; v < 6; ++v) {
+        REQUIRE(dist[v] == expected_dist[v]);
+        REQUIRE(pred[v] == expected_pred[v]);
+    }
+}
+
+TEST_M(shortest_paths_test,
+       "sequential kernel keeps the predecessor which relaxed the vertex first",
+       "[shortest_paths]") {
+    // The vertex 2 is reached by the paths of the length 2 through the vertices 3
+    // and 1, the vertex 3 is settled earlier
+    const te::adjacency_t neighbors = { { 1, 3 }, { 2 }, {}, { 2 } };
+    const std::vector<std::int32_t> weights = { 2, 1, 0, 1 };
+    te::graph_builder builder;
+    const auto g = builder.build<graph_t<std::int32_t>>(neighbors, weights);
+
+    const auto desc = sp::descriptor<>(0, 1.0, sp::optional_results::predecessors);
+    const auto pred = row_accessor<const std::int32_t>(
+                          traverse_sequential(desc, g).get_predecessors())
+                          .pull();
+    const std::int32_t expected_pred[] = { -1, 0, 3, 0 };
+    for (std::int64_t v = 0; v < 4; ++v) {
+        REQUIRE(pred[v] == expected_pred[v]);
+    }
+}
+
+TEST_M(shortest_paths_test, "shortest paths of random graphs", "[shortest_paths]") {
+    // The graphs with at least 1024 vertices are processed by the parallel kernels
+    const std::int64_t vertex_count = GENERATE(100, 2000, 20000);
+    const std::int64_t degree = GENERATE(1, 4, 16);
+    const std::int64_t edge_count = vertex_count * degree;
+
+    SECTION("integer weights") {
+        const auto g = create_graph<std::int32_t>(vertex_count, edge_count);
+        check(g, 0, 3.0);
+        check(g, vertex_count - 1, 20.0);
+    }
+    SECTION("floating-point weights") {
+        const auto g = create_graph<double>(vertex_count, edge_count);
+        check(g, 0, 0.5);
+        check(g, vertex_count / 2, 8.0);
+    }
+}
+
+TEST_M(shortest_paths_test,
+       "graph with 64-bit vertex indices loaded from the edge list",
+       "[shortest_paths]") {
+    const std::int64_t vertex_count = GENERATE(100, 2000);
+    const auto edges = te::generate_edges(vertex_count, vertex_count * 8);
+    std::vector<double> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = double(i % 17);
+    }
+
+    SECTION("integer weights") {
+        check_64_bit_indices<std::int32_t>(edges, weights, 0, 3.0);
+    }
+    SECTION("floating-point weights") {
+        for (auto &weight : weights) {
+            weight /= 4;
+        }
+        check_64_bit_indices<double>(edges, weights, 1, 0.5);
+    }
+}
+
 } // namespace oneapi::dal::algo::shortest_paths::test
@@ -16,18 +16,25 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/compiler_adapt.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/inner_alloc.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/bit_vector.hpp"
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::preview::subgraph_isomorphism::backend {
 
 // 1/64 for memory capacity and ~0.005 for cpu.
 constexpr double density_threshold = 0.015625;
 
+// The ratio of the list lengths starting from which the candidates are looked up
+// in the adjacency list by the binary search instead of merging the lists
+constexpr std::int64_t binary_search_filter_ratio = 8;
+
 enum graph_storage_scheme { auto_detect, bit, list };
 
 enum edge_direction {
@@ -53,6 +60,11 @@ public:
 
     edge_direction check_edge(const std::int64_t current_vertex, const std::int64_t vertex) const;
 
+    std::int64_t filter_candidates(const std::int64_t vertex,
+                                   const edge_direction direction,
+                                   std::int64_t* candidates,
+                                   const std::int64_t candidate_count) const;
+
     std::int64_t get_max_degree() const;
     std::int64_t get_max_vertex_attribute() const;
 
@@ -63,8 +75,9 @@ public:
     bool bit_representation;
     inner_alloc allocator;
     std::int64_t* p_degree; /* vertex data dergee arrays */
-    std::uint8_t** p_edges_bit; /* bit vectors of edges */
-    std::int64_t** p_edges_list; /* adj list of edges */
+    std::uint8_t** p_edges_bit; /* bit vectors of edges, only dense vertices in list case */
+    std::int64_t** p_edges_list; /* sorted adj list of edges */
+    std::int64_t* p_edges_list_data; /* storage of all adj lists */
     std::int64_t* p_vertex_attribute; /* vertices attribute array */
     std::int64_t** p_edges_attribute; /* edges attribute list */
 
@@ -77,9 +90,12 @@ public:
     void init_list_representation(const dal::preview::detail::topology<std::int32_t>& t);
     void allocate_arrays();
 
+    bool is_dense_vertex(const std::int64_t degree) const;
+
 private:
     std::int64_t vertex_count_; /* number of graph vertices */
     std::int64_t edge_count_; /* number of graph edges */
+    std::int64_t edges_list_data_size_ = 0; /* size of adj lists storage */
 };
 
 template <typename Cpu>
@@ -101,12 +117,20 @@ void graph<Cpu>::allocate_arrays() {
     }
     else {
         p_edges_list = allocator.template allocate<std::int64_t*>(vertex_count_);
+        p_edges_bit = allocator.template allocate<std::uint8_t*>(vertex_count_);
         for (int64_t i = 0; i < vertex_count_; i++) {
             p_edges_list[i] = nullptr;
+            p_edges_bit[i] = nullptr;
         }
     }
 }
 
+template <typename Cpu>
+bool graph<Cpu>::is_dense_vertex(const std::int64_t degree) const {
+    // the bit vector of the vertex takes not more memory than its adjacency list
+    return degree > 0 && !(degree < density_threshold * vertex_count_);
+}
+
 template <typename Cpu>
 graph<Cpu>::graph(const dal::preview::detail::topology<std::int32_t>& t,
                   graph_storage_scheme storage_scheme,
@@ -114,6 +138,9 @@ graph<Cpu>::graph(const dal::preview::detail::topology<std::int32_t>& t,
         : external_data(true),
           bit_representation(false),
           allocator(byte_alloc),
+          p_edges_bit(nullptr),
+          p_edges_list(nullptr),
+          p_edges_list_data(nullptr),
           p_vertex_attribute(nullptr),
           p_edges_attribute(nullptr),
           vertex_count_(t.get_vertex_count()),
@@ -163,40 +190,45 @@ void graph<Cpu>::init_bit_representation(const dal::preview::detail::topology<st
     return;
 }
 
+/// Stores the sorted adjacency lists of all vertices in one array. The dense vertices
+/// additionally get the bit vectors of edges, so the memory stays O(E) while the edge
+/// checks against the high-degree vertices take constant time
 template <typename Cpu>
 void graph<Cpu>::init_list_representation(const dal::preview::detail::topology<std::int32_t>& t) {
-    bool has_edges_attribute = false;
+    std::int64_t list_data_size = 0;
     for (std::int64_t i = 0; i < vertex_count_; i++) {
-        auto degree = t._degrees[i];
-        p_degree[i] = degree;
-        if (degree > 0) {
-            p_edges_list[i] = allocator.allocate<std::int64_t>(degree);
-        }
-        else {
-            p_edges_list[i] = nullptr;
-        }
+        p_degree[i] = t._degrees[i];
+        list_data_size += p_degree[i];
     }
 
+    p_edges_list_data = allocator.allocate<std::int64_t>(list_data_size + 1);
+    edges_list_data_size_ = list_data_size + 1;
+
+    const std::int64_t bit_array_size = bit_vector<Cpu>::bit_vector_size(vertex_count_);
+    std::int64_t offset = 0;
     for (std::int64_t i = 0; i < vertex_count_; i++) {
-        auto degree = t._degrees[i];
+        p_edges_list[i] = p_edges_list_data + offset;
+        offset += p_degree[i];
+        if (is_dense_vertex(p_degree[i])) {
+            p_edges_bit[i] = allocator.allocate<std::uint8_t>(bit_array_size);
+            bit_vector<Cpu>::set(bit_array_size, p_edges_bit[i]);
+        }
+    }
 
+    dal::detail::threader_for_int64(vertex_count_, [&](std::int64_t i) {
+        const std::int64_t degree = p_degree[i];
+        std::int64_t* const neighbors = p_edges_list[i];
         for (std::int64_t j = 0; j < degree; j++) {
-            std::int64_t edge_attr = 0;
-            std::int64_t vertex_2 = t._cols[t._rows[i] + j];
+            neighbors[j] = t._cols[t._rows[i] + j];
+        }
+        std::sort(neighbors, neighbors + degree);
 
-            p_edges_list[i][j] = vertex_2;
-            if (edge_attr >= 0 && has_edges_attribute) {
-                if (p_edges_attribute[i] == nullptr) {
-                    // in case of subsequent calls of this function,
-                    // p_edges_attribute can have not enough memory to store data
-                    p_edges_attribute[i] = allocator.allocate<std::int64_t>(degree);
-                    has_edges_attribute = true;
-                }
-                p_edges_attribute[i][j] = edge_attr;
+        if (p_edges_bit[i] != nullptr) {
+            for (std::int64_t j = 0; j < degree; j++) {
+                bit_vector<Cpu>::set_bit(p_edges_bit[i], neighbors[j], vertex_count_);
             }
         }
-    }
-    return;
+    });
 }
 
 template <typename Cpu>
@@ -216,15 +248,14 @@ void graph<Cpu>::delete_bit_arrays() {
 template <typename Cpu>
 void graph<Cpu>::delete_list_arrays() {
     if (p_edges_list != nullptr) {
-        for (std::int64_t i = 0; i < vertex_count_; ++i) {
-            if (p_edges_list[i] != nullptr) {
-                allocator.deallocate(p_edges_list[i], 0);
-                p_edges_list[i] = nullptr;
-            }
-        }
         allocator.deallocate(p_edges_list, vertex_count_);
         p_edges_list = nullptr;
     }
+    if (p_edges_list_data != nullptr) {
+        allocator.deallocate(p_edges_list_data, edges_list_data_size_);
+        p_edges_list_data = nullptr;
+    }
+    delete_bit_arrays();
 }
 
 template <typename Cpu>
@@ -282,11 +313,69 @@ void graph<Cpu>::set_edge_attribute_lists(const std::int64_t vertex_count,
 template <typename Cpu>
 edge_direction graph<Cpu>::check_edge(const std::int64_t current_vertex,
                                       const std::int64_t vertex) const {
+    if (p_edges_bit[current_vertex] == nullptr) {
+        const std::int64_t* neighbors = p_edges_list[current_vertex];
+        return static_cast<edge_direction>(
+            std::binary_search(neighbors, neighbors + p_degree[current_vertex], vertex));
+    }
     return static_cast<edge_direction>(
         (bool)(p_edges_bit[current_vertex][bit_vector<Cpu>::byte(vertex)] &
                bit_vector<Cpu>::bit(vertex)));
 }
 
+/// Compacts the sorted array of candidates to the vertices whose edge with the given vertex
+/// matches the direction and returns the number of the candidates left
+template <typename Cpu>
+std::int64_t graph<Cpu>::filter_candidates(const std::int64_t vertex,
+                                           const edge_direction direction,
+                                           std::int64_t* candidates,
+                                           const std::int64_t candidate_count) const {
+    const bool keep_adjacent = (direction != none);
+    std::int64_t count = 0;
+
+    if (p_edges_bit[vertex] != nullptr) {
+        const std::uint8_t* edges_bit = p_edges_bit[vertex];
+        for (std::int64_t i = 0; i < candidate_count; i++) {
+            const std::int64_t candidate = candidates[i];
+            candidates[count] = candidate;
+            count += ((bool)(edges_bit[bit_vector<Cpu>::byte(candidate)] &
+                             bit_vector<Cpu>::bit(candidate)) == keep_adjacent);
+        }
+        return count;
+    }
+
+    const std::int64_t* neighbors = p_edges_list[vertex];
+    const std::int64_t degree = p_degree[vertex];
+
+    if (candidate_count * binary_search_filter_ratio <= degree) {
+        const std::int64_t* neighbor = neighbors;
+        for (std::int64_t i = 0; i < candidate_count; i++) {
+            const std::int64_t candidate = candidates[i];
+            neighbor = std::lower_bound(neighbor, neighbors + degree, candidate);
+            candidates[count] = candidate;
+            count += ((neighbor != neighbors + degree && *neighbor == candidate) == keep_adjacent);
+        }
+        return count;
+    }
+
+    // branchless merge of the sorted lists
+    std::int64_t i = 0, j = 0;
+    while (i < candidate_count && j < degree) {
+        const std::int64_t candidate = candidates[i];
+        const std::int64_t neighbor = neighbors[j];
+        candidates[count] = candidate;
+        count += (candidate <= neighbor) && ((candidate == neighbor) == keep_adjacent);
+        i += (candidate <= neighbor);
+        j += (neighbor <= candidate);
+    }
+    if (!keep_adjacent) {
+        for (; i < candidate_count; i++) {
+            candidates[count++] = candidates[i];
+        }
+    }
+    return count;
+}
+
 template <typename Cpu>
 std::int64_t graph<Cpu>::get_max_degree() const {
     return max_element(p_degree);
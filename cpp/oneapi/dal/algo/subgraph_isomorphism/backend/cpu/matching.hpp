@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <thread>
+
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/sorter.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/solution.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/stack.hpp"
@@ -29,6 +31,46 @@ namespace oneapi::dal::preview::subgraph_isomorphism::backend {
 template <typename Cpu>
 class engine_bundle;
 
+/// Balances the search between the matching engines. Every engine owns a stack of the
+/// partial search states, splits its search tree into the stack only when some engine
+/// is idle and steals the states from the other engines when its own work is over.
+/// Stops all engines once max_match_count matches are found, zero means no limit
+template <typename Cpu>
+class engine_scheduler {
+public:
+    engine_scheduler(std::int64_t engine_count,
+                     std::int64_t pattern_vertex_count,
+                     std::int64_t max_match_count,
+                     inner_alloc alloc);
+    engine_scheduler(const engine_scheduler&) = delete;
+    engine_scheduler& operator=(const engine_scheduler&) = delete;
+    ~engine_scheduler();
+
+    void share(std::int64_t engine_index, dfs_stack<Cpu>& s);
+    bool take(std::int64_t engine_index, dfs_stack<Cpu>& s);
+
+    void start();
+    void finish(bool is_busy_engine);
+    void set_busy();
+    void set_idle();
+    bool has_busy_engines();
+
+    bool add_match();
+    bool is_stopped() const;
+
+private:
+    inner_alloc allocator;
+    std::int64_t engine_count_;
+    global_stack<Cpu>* engine_stacks_;
+
+    std::int64_t busy_engine_count_;
+    std::int64_t idle_engine_count_;
+
+    std::int64_t max_match_count_;
+    std::int64_t match_count_;
+    std::int64_t stopped_;
+};
+
 template <typename Cpu>
 class matching_engine {
 public:
@@ -45,7 +87,9 @@ public:
                     inner_alloc alloc);
     virtual ~matching_engine();
 
-    void run_and_wait(global_stack<Cpu>& gstack, std::int64_t& busy_engine_count, bool main_engine);
+    void run_and_wait(engine_scheduler<Cpu>& scheduler,
+                      std::int64_t engine_index,
+                      bool main_engine);
     solution<Cpu> get_solution();
 
     std::int64_t state_exploration_bit(bool check_solution = true);
@@ -63,6 +107,7 @@ public:
     const std::int64_t* predecessor;
     const edge_direction* direction;
     const sconsistent_conditions<Cpu>* pconsistent_conditions;
+    engine_scheduler<Cpu>* scheduler;
 
     std::int64_t solution_length;
     bit_vector<Cpu> vertex_candidates;
@@ -80,6 +125,7 @@ public:
 
     std::int64_t extract_candidates(bool check_solution);
     bool check_vertex_candidate(bool check_solution, std::int64_t candidate);
+    bool is_matched_vertex(const std::int64_t vertex) const;
 };
 
 template <typename Cpu>
@@ -94,6 +140,7 @@ public:
                   sconsistent_conditions<Cpu> const* pcconditions,
                   float* ppattern_vertex_probability,
                   kind isomorphism_kind,
+                  std::int64_t max_match_count,
                   inner_alloc alloc);
     virtual ~engine_bundle();
     solution<Cpu> run();
@@ -107,11 +154,114 @@ public:
     const sconsistent_conditions<Cpu>* pconsistent_conditions;
     const float* pattern_vertex_probability;
     kind isomorphism_kind;
+    std::int64_t max_match_count;
 
     typedef oneapi::dal::detail::tls_mem<matching_engine<Cpu>, std::allocator<double>> bundle;
     bundle matching_bundle;
 };
 
+template <typename Cpu>
+engine_scheduler<Cpu>::engine_scheduler(std::int64_t engine_count,
+                                        std::int64_t pattern_vertex_count,
+                                        std::int64_t max_match_count,
+                                        inner_alloc alloc)
+        : allocator(alloc),
+          engine_count_(engine_count),
+          busy_engine_count_(0),
+          idle_engine_count_(0),
+          max_match_count_(max_match_count),
+          match_count_(0),
+          stopped_(0) {
+    engine_stacks_ = allocator.allocate<global_stack<Cpu>>(engine_count_);
+    for (std::int64_t i = 0; i < engine_count_; ++i) {
+        new (engine_stacks_ + i) global_stack<Cpu>(pattern_vertex_count, allocator);
+    }
+}
+
+template <typename Cpu>
+engine_scheduler<Cpu>::~engine_scheduler() {
+    for (std::int64_t i = 0; i < engine_count_; ++i) {
+        engine_stacks_[i].~global_stack();
+    }
+    allocator.deallocate(engine_stacks_, engine_count_);
+    engine_stacks_ = nullptr;
+}
+
+/// Splits the search tree of the engine on demand of the idle engines
+template <typename Cpu>
+void engine_scheduler<Cpu>::share(std::int64_t engine_index, dfs_stack<Cpu>& s) {
+    if (dal::detail::atomic_load(idle_engine_count_) > 0 &&
+        engine_stacks_[engine_index].state_count() == 0) {
+        engine_stacks_[engine_index].push(s);
+    }
+}
+
+/// Takes back the latest state shared by the engine or steals the earliest one
+/// from the other engines
+template <typename Cpu>
+bool engine_scheduler<Cpu>::take(std::int64_t engine_index, dfs_stack<Cpu>& s) {
+    engine_stacks_[engine_index].pop(s);
+    for (std::int64_t i = 1; i < engine_count_ && s.empty(); ++i) {
+        engine_stacks_[(engine_index + i) % engine_count_].steal(s);
+    }
+    return !s.empty();
+}
+
+/// Counts the engine as busy once its task actually runs, so the engines which tasks
+/// the threader has not started yet do not keep the running ones waiting for them
+template <typename Cpu>
+void engine_scheduler<Cpu>::start() {
+    dal::detail::atomic_increment(busy_engine_count_);
+}
+
+/// Removes the finished engine from the counters, so the remaining engines stop
+/// splitting their search trees for it
+template <typename Cpu>
+void engine_scheduler<Cpu>::finish(bool is_busy_engine) {
+    if (is_busy_engine) {
+        dal::detail::atomic_decrement(busy_engine_count_);
+    }
+    else {
+        dal::detail::atomic_decrement(idle_engine_count_);
+    }
+}
+
+template <typename Cpu>
+void engine_scheduler<Cpu>::set_busy() {
+    dal::detail::atomic_increment(busy_engine_count_);
+    dal::detail::atomic_decrement(idle_engine_count_);
+}
+
+template <typename Cpu>
+void engine_scheduler<Cpu>::set_idle() {
+    dal::detail::atomic_increment(idle_engine_count_);
+    dal::detail::atomic_decrement(busy_engine_count_);
+}
+
+template <typename Cpu>
+bool engine_scheduler<Cpu>::has_busy_engines() {
+    return dal::detail::atomic_load(busy_engine_count_) > 0;
+}
+
+/// Reserves the place for one more match, returns false if the limit is reached
+template <typename Cpu>
+bool engine_scheduler<Cpu>::add_match() {
+    if (max_match_count_ == 0) {
+        return true;
+    }
+    const std::int64_t previous_count =
+        dal::detail::atomic_fetch_add(match_count_, std::int64_t(1));
+    if (previous_count + 1 >= max_match_count_) {
+        dal::detail::atomic_store_relaxed(stopped_, std::int64_t(1));
+    }
+    return previous_count < max_match_count_;
+}
+
+template <typename Cpu>
+bool engine_scheduler<Cpu>::is_stopped() const {
+    return dal::detail::atomic_load_relaxed(stopped_) != 0;
+}
+
 template <typename Cpu>
 matching_engine<Cpu>::~matching_engine() {
     pattern = nullptr;
@@ -120,6 +270,7 @@ matching_engine<Cpu>::~matching_engine() {
     predecessor = nullptr;
     direction = nullptr;
     pconsistent_conditions = nullptr;
+    scheduler = nullptr;
 
     allocator.deallocate(temporary_list, temporary_list_size);
     temporary_list = nullptr;
@@ -136,7 +287,10 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
                                       kind isomor_kind,
                                       inner_alloc alloc)
         : allocator(alloc),
-          vertex_candidates(bit_vector<Cpu>::bit_vector_size(ptarget->get_vertex_count()), alloc),
+          vertex_candidates(ptarget->bit_representation
+                                ? bit_vector<Cpu>::bit_vector_size(ptarget->get_vertex_count())
+                                : 1,
+                            alloc),
           local_stack(alloc),
           hlocal_stack(alloc),
           engine_solutions(ppattern->get_vertex_count(), alloc),
@@ -147,6 +301,7 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
     predecessor = ppredecessor;
     direction = pdirection;
     pconsistent_conditions = pcconditions;
+    scheduler = nullptr;
 
     solution_length = pattern->get_vertex_count();
 
@@ -160,13 +315,15 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
         max_neighbours_size = max_degree;
     }
 
-    hlocal_stack.init(solution_length - 1, target_vertex_count);
-
     if (target->bit_representation) {
+        hlocal_stack.init(solution_length - 1, target_vertex_count);
+        temporary_list_size = 0;
         temporary_list = nullptr;
     }
     else {
-        temporary_list_size = max_neighbours_size;
+        /* the candidates are the neighbors of a matched vertex, the stack grows if needed */
+        hlocal_stack.init(solution_length - 1, max_neighbours_size + 1);
+        temporary_list_size = max_neighbours_size + 1;
         temporary_list = allocator.allocate<std::int64_t>(temporary_list_size);
     }
 }
@@ -255,6 +412,9 @@ bool matching_engine<Cpu>::check_vertex_candidate(bool check_solution, std::int6
     std::uint64_t solution_length_unsigned = solution_length;
     if (match_vertex(sorted_pattern_vertex[hlocal_stack.get_current_level()], candidate)) {
         if (check_solution && hlocal_stack.get_current_level() + 1 == solution_length_unsigned) {
+            if (scheduler != nullptr && !scheduler->add_match()) {
+                return false;
+            }
             std::int64_t* solution_core = allocator.allocate<std::int64_t>(solution_length);
             if (solution_core != nullptr) {
                 hlocal_stack.fill_solution(solution_core, candidate);
@@ -269,41 +429,85 @@ bool matching_engine<Cpu>::check_vertex_candidate(bool check_solution, std::int6
     return false;
 }
 
+template <typename Cpu>
+bool matching_engine<Cpu>::is_matched_vertex(const std::int64_t vertex) const {
+    for (std::uint64_t i = 0; i <= hlocal_stack.get_current_level_index(); i++) {
+        if (hlocal_stack.top(i) == static_cast<std::uint64_t>(vertex)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Sparse graph case: the candidates are taken from the adjacency list of the matched
+/// neighbor of the least degree and filtered by the edges with the other matched vertices,
+/// so the cost of the state does not depend on the target vertex count
 template <typename Cpu>
 std::int64_t matching_engine<Cpu>::state_exploration_list(bool check_solution) {
     std::uint64_t current_level_index = hlocal_stack.get_current_level_index();
-    std::int64_t divider = pconsistent_conditions[current_level_index].divider;
+    const sconsistent_conditions<Cpu>& conditions = pconsistent_conditions[current_level_index];
+    const std::int64_t divider = conditions.divider;
+    const std::int64_t last_condition = current_level_index;
+    std::int64_t feasible_result_count = 0;
 
-    if (isomorphism_kind != kind::non_induced) {
-        ONEDAL_IVDEP
-        for (std::int64_t j = 0; j < divider; j++) {
-            or_equal<Cpu>(vertex_candidates.get_vector_pointer(),
-                          target->p_edges_list[hlocal_stack.top(
-                              pconsistent_conditions[current_level_index].array[j])],
-                          target->p_degree[hlocal_stack.top(
-                              pconsistent_conditions[current_level_index].array[j])]);
+    if (divider > last_condition) {
+        /* no matched neighbors, possible for the disconnected patterns only */
+        for (std::int64_t candidate = 0; candidate < target->get_vertex_count(); candidate++) {
+            bool is_candidate = !is_matched_vertex(candidate);
+            for (std::int64_t j = 0; is_candidate && j < divider; j++) {
+                is_candidate = (isomorphism_kind == kind::non_induced) ||
+                               target->check_edge(hlocal_stack.top(conditions.array[j]),
+                                                  candidate) == none;
+            }
+            if (is_candidate) {
+                feasible_result_count += check_vertex_candidate(check_solution, candidate);
+            }
         }
+        hlocal_stack.update();
+        return feasible_result_count;
     }
 
-    ~vertex_candidates;
+    std::int64_t anchor_vertex = hlocal_stack.top(conditions.array[divider]);
+    for (std::int64_t j = divider + 1; j <= last_condition; j++) {
+        const std::int64_t vertex = hlocal_stack.top(conditions.array[j]);
+        if (target->get_vertex_degree(vertex) < target->get_vertex_degree(anchor_vertex)) {
+            anchor_vertex = vertex;
+        }
+    }
 
+    std::int64_t candidate_count = target->get_vertex_degree(anchor_vertex);
+    const std::int64_t* anchor_neighbors = target->p_edges_list[anchor_vertex];
+    ONEDAL_ASSERT(candidate_count <= temporary_list_size);
     ONEDAL_IVDEP
-    for (std::int64_t j = current_level_index; j >= divider; j--) { //j > divider - 1
-        and_equal<Cpu>(
-            vertex_candidates.get_vector_pointer(),
-            target->p_edges_list[hlocal_stack.top(
-                pconsistent_conditions[current_level_index].array[j])],
-            vertex_candidates.size(),
-            target
-                ->p_degree[hlocal_stack.top(pconsistent_conditions[current_level_index].array[j])],
-            temporary_list);
+    for (std::int64_t i = 0; i < candidate_count; i++) {
+        temporary_list[i] = anchor_neighbors[i];
     }
 
-    for (std::uint64_t i = 0; i <= current_level_index; i++) {
-        vertex_candidates.get_vector_pointer()[bit_vector<Cpu>::byte(hlocal_stack.top(i))] &=
-            ~bit_vector<Cpu>::bit(hlocal_stack.top(i));
+    for (std::int64_t j = divider; j <= last_condition && candidate_count > 0; j++) {
+        const std::int64_t vertex = hlocal_stack.top(conditions.array[j]);
+        if (vertex != anchor_vertex) {
+            candidate_count =
+                target->filter_candidates(vertex, both, temporary_list, candidate_count);
+        }
     }
-    return extract_candidates(check_solution);
+
+    if (isomorphism_kind != kind::non_induced) {
+        for (std::int64_t j = 0; j < divider && candidate_count > 0; j++) {
+            candidate_count = target->filter_candidates(hlocal_stack.top(conditions.array[j]),
+                                                        none,
+                                                        temporary_list,
+                                                        candidate_count);
+        }
+    }
+
+    for (std::int64_t i = 0; i < candidate_count; i++) {
+        if (!is_matched_vertex(temporary_list[i])) {
+            feasible_result_count += check_vertex_candidate(check_solution, temporary_list[i]);
+        }
+    }
+
+    hlocal_stack.update();
+    return feasible_result_count;
 }
 
 template <typename Cpu>
@@ -343,64 +547,46 @@ solution<Cpu> matching_engine<Cpu>::get_solution() {
 }
 
 template <typename Cpu>
-void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
-                                        std::int64_t& busy_engine_count,
+void matching_engine<Cpu>::run_and_wait(engine_scheduler<Cpu>& engine_scheduler,
+                                        std::int64_t engine_index,
                                         bool main_engine) {
+    scheduler = &engine_scheduler;
     if (main_engine) {
         first_states_generator(hlocal_stack);
     }
+    scheduler->start();
     bool is_busy_engine = true;
     ONEDAL_ASSERT(pattern != nullptr);
-    if (target->bit_representation) { /* dense graph case */
-        for (;;) {
-            if (hlocal_stack.states_in_stack() > 0) {
-                while ((hlocal_stack.states_in_stack() > 5) && gstack.push(hlocal_stack))
-                    ;
-                ONEDAL_ASSERT(hlocal_stack.states_in_stack() > 0);
+    while (!scheduler->is_stopped()) {
+        if (hlocal_stack.states_in_stack() > 0) {
+            scheduler->share(engine_index, hlocal_stack);
+            ONEDAL_ASSERT(hlocal_stack.states_in_stack() > 0);
+            if (target->bit_representation) { /* dense graph case */
                 state_exploration_bit();
             }
-            else {
-                gstack.pop(hlocal_stack);
-                if (hlocal_stack.empty()) {
-                    if (is_busy_engine) {
-                        is_busy_engine = false;
-                        dal::detail::atomic_decrement(busy_engine_count);
-                    }
-                    if (dal::detail::atomic_load(busy_engine_count) == 0)
-                        break;
-                }
-                else if (!is_busy_engine) {
-                    is_busy_engine = true;
-                    dal::detail::atomic_increment(busy_engine_count);
-                }
+            else { /* sparse graph case */
+                state_exploration_list();
             }
         }
-    }
-    else { /* sparse graph case */
-        for (;;) {
-            if (hlocal_stack.states_in_stack() > 0) {
-                while ((hlocal_stack.states_in_stack() > 5) && gstack.push(hlocal_stack))
-                    ;
-                ONEDAL_ASSERT(hlocal_stack.states_in_stack() > 0);
-                state_exploration_list();
+        else if (scheduler->take(engine_index, hlocal_stack)) {
+            if (!is_busy_engine) {
+                is_busy_engine = true;
+                scheduler->set_busy();
             }
-            else {
-                gstack.pop(hlocal_stack);
-                if (hlocal_stack.empty()) {
-                    if (is_busy_engine) {
-                        is_busy_engine = false;
-                        dal::detail::atomic_decrement(busy_engine_count);
-                    }
-                    if (dal::detail::atomic_load(busy_engine_count) == 0)
-                        break;
-                }
-                else if (!is_busy_engine) {
-                    is_busy_engine = true;
-                    dal::detail::atomic_increment(busy_engine_count);
-                }
+        }
+        else {
+            if (is_busy_engine) {
+                is_busy_engine = false;
+                scheduler->set_idle();
             }
+            if (!scheduler->has_busy_engines())
+                break;
+            /* give the core back until the busy engines share some states */
+            std::this_thread::yield();
         }
     }
+    scheduler->finish(is_busy_engine);
+    scheduler = nullptr;
     return;
 }
 
@@ -413,6 +599,7 @@ engine_bundle<Cpu>::engine_bundle(const graph<Cpu>* ppattern,
                                   sconsistent_conditions<Cpu> const* pcconditions,
                                   float* ppattern_vertex_probability,
                                   kind isomor_kind,
+                                  std::int64_t max_match_count,
                                   inner_alloc alloc)
         : exploration_stack(alloc),
           allocator(alloc),
@@ -423,7 +610,8 @@ engine_bundle<Cpu>::engine_bundle(const graph<Cpu>* ppattern,
           direction(pdirection),
           pconsistent_conditions(pcconditions),
           pattern_vertex_probability(ppattern_vertex_probability),
-          isomorphism_kind(isomor_kind) {}
+          isomorphism_kind(isomor_kind),
+          max_match_count(max_match_count) {}
 
 template <typename Cpu>
 engine_bundle<Cpu>::~engine_bundle() {
@@ -451,12 +639,8 @@ solution<Cpu> engine_bundle<Cpu>::run() {
             static_cast<bool>(first_states_count % max_threads_count);
     }
 
-    const std::uint64_t array_size =
-        (max_threads_count >= 64)
-            ? max_threads_count * 2 / 10
-            : (max_threads_count >= 24)
-                  ? max_threads_count * 4 / 10
-                  : (max_threads_count >= 8) ? 4 : (max_threads_count >= 4) ? 2 : 1;
+    /* one engine per thread, the load is balanced by the work stealing */
+    const std::uint64_t array_size = max_threads_count;
     auto engine_array_ptr = allocator.make_shared_memory<matching_engine<Cpu>>(array_size);
     matching_engine<Cpu>* engine_array = engine_array_ptr.get();
 
@@ -487,10 +671,12 @@ solution<Cpu> engine_bundle<Cpu>::run() {
         }
     }
 
-    global_stack<Cpu> gstack(pattern->get_vertex_count(), allocator);
-    std::int64_t busy_engine_count(array_size);
+    engine_scheduler<Cpu> scheduler(array_size,
+                                    pattern->get_vertex_count(),
+                                    max_match_count,
+                                    allocator);
     dal::detail::threader_for(array_size, array_size, [&](const int index) {
-        engine_array[index].run_and_wait(gstack, busy_engine_count, false);
+        engine_array[index].run_and_wait(scheduler, index, false);
     });
 
     solution<Cpu> aggregated_solution(pattern->get_vertex_count(), allocator);
@@ -31,6 +31,7 @@ template <typename Cpu>
 oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
                               const graph<Cpu>& target,
                               kind isomorphism_kind,
+                              std::int64_t max_match_count,
                               detail::byte_alloc_iface* alloc_ptr) {
     inner_alloc local_allocator(alloc_ptr);
 
@@ -71,6 +72,7 @@ oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
                                cconditions.get(),
                                pattern_vertex_probability.get(),
                                isomorphism_kind,
+                               max_match_count,
                                local_allocator);
     const solution<Cpu> results = harness.run();
 
@@ -85,6 +87,7 @@ oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
 template <typename Cpu>
 subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel(
     const kind& si_kind,
+    std::int64_t max_match_count,
     detail::byte_alloc_iface* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
@@ -100,7 +103,7 @@ subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel(
         pattern.set_vertex_attribute(p_data._vertex_count, vv_p);
     }
 
-    const oneapi::dal::homogen_table results = si<Cpu>(pattern, target, si_kind, alloc_ptr);
+    const oneapi::dal::homogen_table results = si<Cpu>(pattern, target, si_kind, max_match_count, alloc_ptr);
 
     return graph_matching_result<task::compute>().set_vertex_match(results).set_match_count(
         results.get_row_count());
@@ -83,6 +83,9 @@ private:
 template <typename Cpu>
 class dfs_stack;
 
+/// The stack of the partial search states shared between the matching engines. The owner
+/// takes back the latest states, the other engines steal the earliest ones, which root
+/// the largest search subtrees
 template <typename Cpu>
 class global_stack {
 public:
@@ -102,9 +105,12 @@ public:
 
     bool push(dfs_stack<Cpu>& s);
     void pop(dfs_stack<Cpu>& s);
+    void steal(dfs_stack<Cpu>& s);
+    std::int64_t state_count();
 
 private:
     void internal_push(dfs_stack<Cpu>& s, std::uint64_t level);
+    void restore(dfs_stack<Cpu>& s, const std::uint64_t* v);
     void clear();
     void grow();
 
@@ -113,7 +119,7 @@ private:
     }
 
     std::int64_t size() const {
-        return (bottom_ != nullptr && vertex_count_ != 0) ? (top_ - bottom_) / vertex_count_ : 0;
+        return (bottom_ != nullptr && vertex_count_ != 0) ? (top_ - front_) / vertex_count_ : 0;
     }
 
     bool empty() const {
@@ -124,8 +130,10 @@ private:
     inner_alloc allocator;
     std::int64_t vertex_count_;
     std::uint64_t* bottom_{ nullptr };
+    std::uint64_t* front_{ nullptr };
     std::uint64_t* top_{ nullptr };
     std::int64_t capacity_{ 0 };
+    std::int64_t state_count_{ 0 };
 };
 
 template <typename Cpu>
@@ -397,42 +405,67 @@ void vertex_stack<Cpu>::increase_stack_size() {
     ONEDAL_ASSERT(ptop <= stack_data + stack_size);
 }
 
+/// Splits the search tree of the engine at the shallowest level with the pending states
 template <typename Cpu>
 bool global_stack<Cpu>::push(dfs_stack<Cpu>& s) {
-    for (auto level = s.get_current_level_index(); level > 0; --level) {
+    for (std::uint64_t level = 0; level <= s.get_current_level_index(); ++level) {
         if (s.data_by_levels[level].size() > 1) {
             internal_push(s, level);
             return true;
         }
     }
 
-    if (s.data_by_levels[0].size() > 1) {
-        internal_push(s, 0);
-        return true;
-    }
-
     return false;
 }
 
+template <typename Cpu>
+void global_stack<Cpu>::restore(dfs_stack<Cpu>& s, const std::uint64_t* v) {
+    for (std::int64_t i = 0; i < vertex_count_ && v[i] != null_vertex(); ++i) {
+        ONEDAL_ASSERT(i <= dal::detail::integral_cast<std::int64_t>(s.max_level_size));
+        s.push_into_current_level(v[i]);
+        if (i != vertex_count_ - 1 && v[i + 1] != null_vertex()) {
+            s.increase_core_level();
+        }
+    }
+}
+
 template <typename Cpu>
 void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
     ONEDAL_ASSERT(s.empty());
     const dal::detail::scoped_lock lock(mutex_);
     if (!empty()) {
-        // const auto& v = data_.top();
         const auto v = top_ - vertex_count_;
-        ONEDAL_ASSERT(v >= bottom_);
-        for (std::int64_t i = 0; i < vertex_count_ && v[i] != null_vertex(); ++i) {
-            ONEDAL_ASSERT(i <= dal::detail::integral_cast<std::int64_t>(s.max_level_size));
-            s.push_into_current_level(v[i]);
-            if (i != vertex_count_ - 1 && v[i + 1] != null_vertex()) {
-                s.increase_core_level();
-            }
-        }
+        ONEDAL_ASSERT(v >= front_);
+        restore(s, v);
         top_ = v;
+        dal::detail::atomic_decrement(state_count_);
+        if (top_ == front_) {
+            top_ = front_ = bottom_;
+        }
     }
 }
 
+template <typename Cpu>
+void global_stack<Cpu>::steal(dfs_stack<Cpu>& s) {
+    ONEDAL_ASSERT(s.empty());
+    const dal::detail::scoped_lock lock(mutex_);
+    if (!empty()) {
+        restore(s, front_);
+        front_ += vertex_count_;
+        dal::detail::atomic_decrement(state_count_);
+        if (top_ == front_) {
+            top_ = front_ = bottom_;
+        }
+    }
+}
+
+/// Returns the number of the states without locking the stack, so the engines can
+/// poll it on every step of the search
+template <typename Cpu>
+std::int64_t global_stack<Cpu>::state_count() {
+    return dal::detail::atomic_load_relaxed(state_count_);
+}
+
 template <typename Cpu>
 void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
     ONEDAL_ASSERT(vertex_count_ >= 0);
@@ -460,7 +493,7 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
         v[level] = *(s.data_by_levels[level].bottom_);
 
         const dal::detail::scoped_lock lock(mutex_);
-        if (size() >= capacity_) {
+        if (top_ == bottom_ + capacity_ * vertex_count_) {
             grow();
         }
 
@@ -472,6 +505,7 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
         for (; j < static_cast<std::uint64_t>(vertex_count_); ++j) {
             *(top_++) = null_vertex();
         }
+        dal::detail::atomic_increment(state_count_);
 
         allocator.deallocate(v, level + 1);
     }
@@ -487,26 +521,31 @@ void global_stack<Cpu>::clear() {
         allocator.deallocate(bottom_,
                              (capacity_ * vertex_count_ > 0) ? capacity_ * vertex_count_ : 1);
         bottom_ = nullptr;
+        front_ = nullptr;
         top_ = nullptr;
         capacity_ = 0;
     }
 }
 
+/// Moves the states to the beginning of the new storage, which is twice as large
+/// unless the stolen states have freed at least a half of the current one
 template <typename Cpu>
 void global_stack<Cpu>::grow() {
-    const std::int64_t new_capacity = (capacity_ > 0) ? capacity_ * 2 : 1;
+    const std::int64_t new_capacity =
+        (capacity_ > 0) ? ((size() * 2 > capacity_) ? capacity_ * 2 : capacity_) : 1;
     const auto new_bottom = allocator.allocate<uint64_t>(
         (new_capacity * vertex_count_ > 0) ? new_capacity * vertex_count_ : 1);
     const auto new_top = new_bottom + size() * vertex_count_;
 
     ONEDAL_IVDEP
-    for (auto dest = new_bottom, src = bottom_; dest != new_top;) {
+    for (auto dest = new_bottom, src = front_; dest != new_top;) {
         *(dest++) = *(src++);
     }
 
     clear();
 
     bottom_ = new_bottom;
+    front_ = new_bottom;
     top_ = new_top;
     capacity_ = new_capacity;
 }
@@ -186,13 +186,12 @@ SUBGRAPH_ISOMORPHISM_BADARG_TEST("Throws if match count is negative") {
         invalid_argument);
 }
 
-SUBGRAPH_ISOMORPHISM_BADARG_TEST("Throws if match count is positive") {
-    REQUIRE_THROWS_AS(
-        (this->check_subgraph_isomorphism<double_triangle_target_type, double_triangle_target_type>(
+SUBGRAPH_ISOMORPHISM_BADARG_TEST("Positive match count") {
+    REQUIRE_NOTHROW(
+        this->check_subgraph_isomorphism<double_triangle_target_type, double_triangle_target_type>(
             false,
             isomorphism_kind::induced,
-            1)),
-        unimplemented);
+            1));
 }
 
 // SUBGRAPH_ISOMORPHISM_BADARG_TEST("Throws if semantic match is true") {
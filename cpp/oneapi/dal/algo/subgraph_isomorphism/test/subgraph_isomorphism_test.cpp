@@ -15,11 +15,13 @@
 *******************************************************************************/
 
 #include <initializer_list>
+#include <vector>
 
 #include "oneapi/dal/algo/subgraph_isomorphism/graph_matching.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/graph/service_functions.hpp"
@@ -1862,8 +1864,8 @@ public:
                 dal::preview::subgraph_isomorphism::task::by_default,
                 AllocatorType>(alloc)
                 .set_kind(kind)
-                .set_semantic_match(semantic_match);
-        // .set_max_match_count(max_match_count);
+                .set_semantic_match(semantic_match)
+                .set_max_match_count(max_match_count);
 
         const auto result =
             dal::preview::graph_matching(subgraph_isomorphism_desc, target_graph, pattern_graph);
@@ -1873,6 +1875,34 @@ public:
             kind == isomorphism_kind::induced,
             is_vertex_labeled));
     }
+
+    /// Runs the matching from the tasks of a parallel loop with more iterations than
+    /// threads, so the threader starts the tasks of the matching engines while the
+    /// threads are busy with the other calls and only some engines run at a time
+    template <typename TargetGraphType, typename PatternGraphType>
+    void check_nested_subgraph_isomorphism(isomorphism_kind kind,
+                                           std::int64_t expected_match_count) {
+        const auto target_graph = create_graph<TargetGraphType>();
+        const auto pattern_graph = create_graph<PatternGraphType>();
+
+        const auto subgraph_isomorphism_desc =
+            dal::preview::subgraph_isomorphism::descriptor<>(std::allocator<char>())
+                .set_kind(kind);
+
+        const std::int32_t call_count = 2 * dal::detail::threader_get_max_threads();
+        std::vector<std::int64_t> match_counts(call_count, -1);
+        dal::detail::threader_for(call_count, call_count, [&](std::int32_t i) {
+            const auto result = dal::preview::graph_matching(subgraph_isomorphism_desc,
+                                                             target_graph,
+                                                             pattern_graph);
+            match_counts[i] = result.get_match_count();
+        });
+
+        for (std::int32_t i = 0; i < call_count; ++i) {
+            CAPTURE(i);
+            REQUIRE(match_counts[i] == expected_match_count);
+        }
+    }
 };
 
 #define SUBGRAPH_ISOMORPHISM_INDUCED_TEST(name) \
@@ -1884,6 +1914,9 @@ public:
 #define SUBGRAPH_ISOMORPHISM_ALLOCATOR_TEST(name) \
     TEST_M(subgraph_isomorphism_test, name, "[subgraph_isomorphism][allocator]")
 
+#define SUBGRAPH_ISOMORPHISM_NESTED_TEST(name) \
+    TEST_M(subgraph_isomorphism_test, name, "[subgraph_isomorphism][nested]")
+
 SUBGRAPH_ISOMORPHISM_INDUCED_TEST("Induced: Bit target representation, all matches check") {
     this->check_subgraph_isomorphism<double_triangle_target_type, double_triangle_pattern_type>(
         false,
@@ -1925,18 +1958,18 @@ SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
                                                                    20);
 }
 
-// SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
-//        "Induced: Bit target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<difficult_graph_type, triangles_edge_link_type>(
-//         false,
-//         isomorphism_kind::induced,
-//         50,
-//         50);
-//     this->check_subgraph_isomorphism<wheel_5_type, triangle_type>(false,
-//                                                                   isomorphism_kind::induced,
-//                                                                   10,
-//                                                                   10);
-// }
+SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
+    "Induced: Bit target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<difficult_graph_type, triangles_edge_link_type>(
+        false,
+        isomorphism_kind::induced,
+        50,
+        50);
+    this->check_subgraph_isomorphism<wheel_5_type, triangle_type>(false,
+                                                                  isomorphism_kind::induced,
+                                                                  10,
+                                                                  10);
+}
 
 SUBGRAPH_ISOMORPHISM_INDUCED_TEST("Induced: Bit target representation, single match") {
     this->check_subgraph_isomorphism<paths_1_2_3_single_target_type, paths_1_2_3_type>(
@@ -1981,18 +2014,18 @@ SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
                                                                     1200);
 }
 
-// SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
-//        "Induced: List target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<path_100_type, path_5_type>(false,
-//                                                                  isomorphism_kind::induced,
-//                                                                  100,
-//                                                                  100);
-//     this->check_subgraph_isomorphism<lolipop_5_100_type, k_5_labeled_type>(
-//         false,
-//         isomorphism_kind::induced,
-//         10,
-//         10);
-// }
+SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
+    "Induced: List target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<path_100_type, path_5_type>(false,
+                                                                 isomorphism_kind::induced,
+                                                                 100,
+                                                                 100);
+    this->check_subgraph_isomorphism<lolipop_5_100_type, k_5_labeled_type>(
+        false,
+        isomorphism_kind::induced,
+        10,
+        10);
+}
 
 SUBGRAPH_ISOMORPHISM_INDUCED_TEST("Induced: List target representation, single match") {
     this->check_subgraph_isomorphism<paths_1_2_100_type, paths_1_2_3_type>(
@@ -2055,19 +2088,19 @@ SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
         true);
 }
 
-// SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
-//     "Induced + Labeled vertexes: Bit target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<wheel_5_type, triangle_type>(false,
-//                                                                   isomorphism_kind::induced,
-//                                                                   3,
-//                                                                   3,
-//                                                                   true);
-//     this->check_subgraph_isomorphism<lolipop_10_15_type, path_16_type>(false,
-//                                                                        isomorphism_kind::induced,
-//                                                                        1,
-//                                                                        1,
-//                                                                        true);
-// }
+SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
+    "Induced + Labeled vertexes: Bit target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<wheel_5_type, triangle_type>(false,
+                                                                  isomorphism_kind::induced,
+                                                                  3,
+                                                                  3,
+                                                                  true);
+    this->check_subgraph_isomorphism<lolipop_10_15_type, path_16_type>(false,
+                                                                       isomorphism_kind::induced,
+                                                                       1,
+                                                                       1,
+                                                                       true);
+}
 
 SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
     "Induced + Labeled vertexes: Bit target representation, single match") {
@@ -2140,23 +2173,23 @@ SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
                                                                  true);
 }
 
-// SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
-//     "Induced + Labeled vertexes: List target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<star_99_type, star_3_type>(false,
-//                                                                 isomorphism_kind::induced,
-//                                                                 128,
-//                                                                 128,
-//                                                                 true);
-// }
+SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
+    "Induced + Labeled vertexes: List target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<star_99_type, star_3_type>(false,
+                                                                isomorphism_kind::induced,
+                                                                128,
+                                                                128,
+                                                                true);
+}
 
-// SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
-//        "Induced + Labeled vertexes: List target representation, single match") {
-//     this->check_subgraph_isomorphism<wheel_201_type, triangle_type>(false,
-//                                                                     isomorphism_kind::induced,
-//                                                                     1,
-//                                                                     1,
-//                                                                     true);
-// }
+SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
+    "Induced + Labeled vertexes: List target representation, single match") {
+    this->check_subgraph_isomorphism<wheel_201_type, triangle_type>(false,
+                                                                    isomorphism_kind::induced,
+                                                                    1,
+                                                                    1,
+                                                                    true);
+}
 
 SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
     "Induced + Labeled vertexes: List target representation, no matches") {
@@ -2223,15 +2256,15 @@ SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
         false);
 }
 
-// SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
-//        "Non-induced: Bit target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<k_6_labeled_type, k_5_without_edge_labeled_type>(
-//         false,
-//         isomorphism_kind::non_induced,
-//         50,
-//         50,
-//         false);
-// }
+SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
+    "Non-induced: Bit target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<k_6_labeled_type, k_5_without_edge_labeled_type>(
+        false,
+        isomorphism_kind::non_induced,
+        50,
+        50,
+        false);
+}
 
 SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST("Non-induced: Bit target representation, single match") {
     this->check_subgraph_isomorphism<triangle_path_target_type, triangle_path_pattern_type>(
@@ -2285,14 +2318,14 @@ SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
         false);
 }
 
-// SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
-//        "Non-induced: List target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<wheel_201_type, star_3_type>(false,
-//                                                                   isomorphism_kind::non_induced,
-//                                                                   100,
-//                                                                   100,
-//                                                                   false);
-// }
+SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
+    "Non-induced: List target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<wheel_201_type, star_3_type>(false,
+                                                                  isomorphism_kind::non_induced,
+                                                                  100,
+                                                                  100,
+                                                                  false);
+}
 
 SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST("Non-induced: List target representation, no matches") {
     this->check_subgraph_isomorphism<wheel_201_type, tree_pattern_type>(
@@ -2360,21 +2393,21 @@ SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
                                                                       true);
 }
 
-// SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
-//     "Non-induced + labels on vertexes: Bit target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<wheel_11_labeled_type, cycle_4_type>(
-//         false,
-//         isomorphism_kind::non_induced,
-//         19,
-//         19,
-//         true);
-//     this->check_subgraph_isomorphism<k_6_labeled_type, k_5_without_edge_labeled_type>(
-//         false,
-//         isomorphism_kind::non_induced,
-//         30,
-//         30,
-//         true);
-// }
+SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
+    "Non-induced + labels on vertexes: Bit target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<wheel_11_labeled_type, cycle_4_type>(
+        false,
+        isomorphism_kind::non_induced,
+        19,
+        19,
+        true);
+    this->check_subgraph_isomorphism<k_6_labeled_type, k_5_without_edge_labeled_type>(
+        false,
+        isomorphism_kind::non_induced,
+        30,
+        30,
+        true);
+}
 
 SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
     "Non-induced + labels on vertexes: Bit target representation, no matches") {
@@ -2430,14 +2463,14 @@ SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
         true);
 }
 
-// SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
-//     "Non-induced + labels on vertexes: List target representation, max_match_count <= total number of SI") {
-//     this->check_subgraph_isomorphism<wheel_201_type, k_4_type>(false,
-//                                                                isomorphism_kind::non_induced,
-//                                                                1,
-//                                                                1,
-//                                                                true);
-// }
+SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
+    "Non-induced + labels on vertexes: List target representation, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism<wheel_201_type, k_4_type>(false,
+                                                               isomorphism_kind::non_induced,
+                                                               1,
+                                                               1,
+                                                               true);
+}
 
 SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
     "Non-induced + labels on vertexes: LList target representation, no matches") {
@@ -2469,4 +2502,16 @@ SUBGRAPH_ISOMORPHISM_ALLOCATOR_TEST("Custom allocator with limit") {
                       std::bad_alloc);
 }
 
+SUBGRAPH_ISOMORPHISM_NESTED_TEST("Nested calls: Bit target representation, all matches check") {
+    this->check_nested_subgraph_isomorphism<lolipop_10_15_type, path_16_type>(
+        isomorphism_kind::induced,
+        20);
+}
+
+SUBGRAPH_ISOMORPHISM_NESTED_TEST("Nested calls: List target representation, all matches check") {
+    this->check_nested_subgraph_isomorphism<wheel_201_type, triangle_type>(
+        isomorphism_kind::induced,
+        1200);
+}
+
 } // namespace oneapi::dal::algo::subgraph_isomorphism::test
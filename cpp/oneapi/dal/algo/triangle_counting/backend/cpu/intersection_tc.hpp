@@ -20,18 +20,21 @@
 
 #include <daal/src/services/service_defines.h>
 
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+
 namespace oneapi::dal::preview::triangle_counting::backend {
 
 template <typename Cpu>
 struct intersection_local_tc {
-    ONEDAL_FORCEINLINE std::int64_t operator()(const std::int32_t* neigh_u,
-                                               const std::int32_t* neigh_v,
-                                               std::int32_t n_u,
-                                               std::int32_t n_v,
+    template <typename Index>
+    ONEDAL_FORCEINLINE std::int64_t operator()(const Index* neigh_u,
+                                               const Index* neigh_v,
+                                               Index n_u,
+                                               Index n_v,
                                                std::int64_t* tc,
                                                std::int64_t tc_size) {
         std::int64_t total = 0;
-        std::int32_t i_u = 0, i_v = 0;
+        Index i_u = 0, i_v = 0;
         while (i_u < n_u && i_v < n_v) {
             if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
                 return total;
@@ -54,6 +57,12 @@ ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t& x) {
     return _popcnt32(x);
 }
 #define GRAPH_STACK_ALING(x) __declspec(align(x))
+#elif defined(__POPCNT__)
+ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t& x) {
+    return _mm_popcnt_u32(static_cast<std::uint32_t>(x));
+}
+#define GRAPH_STACK_ALING(x) \
+    {}
 #else
 ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t& x) {
     std::int32_t count = 0;
@@ -70,6 +79,21 @@ ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t& x) {
 
 template <>
 struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
+    /// The vector kernel handles 32-bit vertex indices only
+    ONEDAL_FORCEINLINE std::int64_t operator()(const std::int64_t* neigh_u,
+                                               const std::int64_t* neigh_v,
+                                               std::int64_t n_u,
+                                               std::int64_t n_v,
+                                               std::int64_t* tc,
+                                               std::int64_t tc_size) {
+        return intersection_local_tc<dal::backend::cpu_dispatch_sse2>{}(neigh_u,
+                                                                       neigh_v,
+                                                                       n_u,
+                                                                       n_v,
+                                                                       tc,
+                                                                       tc_size);
+    }
+
     ONEDAL_FORCEINLINE std::int64_t operator()(const std::int32_t* neigh_u,
                                                const std::int32_t* neigh_v,
                                                std::int32_t n_u,
@@ -78,7 +102,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
                                                std::int64_t tc_size) {
         std::int64_t total = 0;
         std::int32_t i_u = 0, i_v = 0;
-#if defined(__INTEL_COMPILER)
+#if defined(ONEDAL_INTERSECTION_AVX512)
         while (i_u < (n_u / 16) * 16 && i_v < (n_v / 16) * 16) { // not in last n%16 elements
             // assumes neighbor list is ordered
             std::int32_t min_neigh_u = neigh_u[i_u];
@@ -202,7 +226,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
 
         while (i_u < (n_u / 16) * 16 && i_v < n_v) {
             __m512i v_u = _mm512_loadu_si512((void*)(neigh_u + i_u));
-            while (neigh_v[i_v] <= neigh_u[i_u + 15] && i_v < n_v) {
+            while (i_v < n_v && neigh_v[i_v] <= neigh_u[i_u + 15]) {
                 __m512i tmp_v_v = _mm512_set1_epi32(neigh_v[i_v]);
                 __mmask16 match = _mm512_cmpeq_epi32_mask(v_u, tmp_v_v);
                 if (_mm512_mask2int(match)) {
@@ -215,7 +239,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
         }
         while (i_v < (n_v / 16) * 16 && i_u < n_u) {
             __m512i v_v = _mm512_loadu_si512((void*)(neigh_v + i_v));
-            while (neigh_u[i_u] <= neigh_v[i_v + 15] && i_u < n_u) {
+            while (i_u < n_u && neigh_u[i_u] <= neigh_v[i_v + 15]) {
                 __m512i tmp_v_u = _mm512_set1_epi32(neigh_u[i_u]);
                 __mmask16 match = _mm512_cmpeq_epi32_mask(v_v, tmp_v_u);
                 if (_mm512_mask2int(match)) {
@@ -299,7 +323,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
         }
         if (i_u <= (n_u - 8) && i_v < n_v) {
             __m256i v_u = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(neigh_u + i_u));
-            while (neigh_v[i_v] <= neigh_u[i_u + 7] && i_v < n_v) {
+            while (i_v < n_v && neigh_v[i_v] <= neigh_u[i_u + 7]) {
                 __m256i tmp_v_v = _mm256_set1_epi32(neigh_v[i_v]);
                 __mmask8 match = _mm256_cmpeq_epi32_mask(v_u, tmp_v_v);
                 if (_cvtmask8_u32(match)) {
@@ -312,7 +336,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
         }
         if (i_v <= (n_v - 8) && i_u < n_u) {
             __m256i v_v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(neigh_v + i_v));
-            while (neigh_u[i_u] <= neigh_v[i_v + 7] && i_u < n_u) {
+            while (i_u < n_u && neigh_u[i_u] <= neigh_v[i_v + 7]) {
                 __m256i tmp_v_u = _mm256_set1_epi32(neigh_u[i_u]);
                 __mmask8 match = _mm256_cmpeq_epi32_mask(v_v, tmp_v_u);
                 if (_cvtmask8_u32(match)) {
@@ -378,7 +402,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
         }
         if (i_u <= (n_u - 4) && i_v < n_v) {
             __m128i v_u = _mm_loadu_si128(reinterpret_cast<const __m128i*>(neigh_u + i_u));
-            while (neigh_v[i_v] <= neigh_u[i_u + 3] && i_v < n_v) {
+            while (i_v < n_v && neigh_v[i_v] <= neigh_u[i_u + 3]) {
                 __m128i tmp_v_v = _mm_set1_epi32(neigh_v[i_v]);
                 __mmask8 match = _mm_cmpeq_epi32_mask(v_u, tmp_v_v);
                 if (_cvtmask8_u32(match)) {
@@ -391,7 +415,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
         }
         if (i_v <= (n_v - 4) && i_u < n_u) {
             __m128i v_v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(neigh_v + i_v));
-            while (neigh_u[i_u] <= neigh_v[i_v + 3] && i_u < n_u) {
+            while (i_u < n_u && neigh_u[i_u] <= neigh_v[i_v + 3]) {
                 __m128i tmp_v_u = _mm_set1_epi32(neigh_u[i_u]);
                 __mmask8 match = _mm_cmpeq_epi32_mask(v_v, tmp_v_u);
                 if (_cvtmask8_u32(match)) {
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "oneapi/dal/algo/triangle_counting/common.hpp"
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
 #include "oneapi/dal/backend/common.hpp"
@@ -25,35 +27,34 @@
 #include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/algo/triangle_counting/backend/cpu/intersection_tc.hpp"
 #include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+#include "oneapi/dal/graph/backend/cpu/compressed_topology_kernel.hpp"
 
 namespace oneapi::dal::preview::triangle_counting::backend {
 
-template <typename Cpu>
-array<std::int64_t> triangle_counting_local(const dal::preview::detail::topology<std::int32_t>& t,
+template <typename Cpu, typename IndexType>
+array<std::int64_t> triangle_counting_local(const dal::preview::detail::topology<IndexType>& t,
                                             int64_t* triangles_local) {
     const auto vertex_count = t.get_vertex_count();
     std::int32_t average_degree = t.get_edge_count() / vertex_count;
     int thread_cnt = dal::detail::threader_get_max_threads();
 
-    dal::detail::threader_for(thread_cnt * vertex_count,
-                              thread_cnt * vertex_count,
-                              [&](std::int64_t u) {
-                                  triangles_local[u] = 0;
-                              });
+    dal::detail::threader_for_int64(thread_cnt * vertex_count, [&](std::int64_t u) {
+        triangles_local[u] = 0;
+    });
 
     const std::int32_t average_degree_sparsity_boundary = 4;
     if (average_degree < average_degree_sparsity_boundary) {
-        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
             for (auto v_ = t.get_vertex_neighbors_begin(u); v_ != t.get_vertex_neighbors_end(u);
                  ++v_) {
-                std::int32_t v = *v_;
+                IndexType v = *v_;
                 if (v > u) {
                     break;
                 }
                 auto u_neighbors_ptr = t.get_vertex_neighbors_begin(u);
-                for (auto w_ = t.get_vertex_neighbors_begin(v); v_ != t.get_vertex_neighbors_end(v);
+                for (auto w_ = t.get_vertex_neighbors_begin(v); w_ != t.get_vertex_neighbors_end(v);
                      ++w_) {
-                    std::int32_t w = *w_;
+                    IndexType w = *w_;
                     if (w > v) {
                         break;
                     }
@@ -72,50 +73,67 @@ array<std::int64_t> triangle_counting_local(const dal::preview::detail::topology
         });
     }
     else { //average_degree >= average_degree_sparsity_boundary
-        dal::detail::threader_for_simple(vertex_count, vertex_count, [&](std::int32_t u) {
-            if (t.get_vertex_degree(u) >= 2)
-                dal::detail::threader_for_int32ptr(
-                    t.get_vertex_neighbors_begin(u),
-                    t.get_vertex_neighbors_end(u),
-                    [&](const std::int32_t* v_) {
-                        std::int32_t v = *v_;
-                        if (v <= u) {
-                            const std::int32_t u_degree = t.get_vertex_degree(u);
-                            const std::int32_t* v_neighbors_begin = t.get_vertex_neighbors_begin(v);
-                            const std::int32_t v_degree = t.get_vertex_degree(v);
-                            std::int32_t new_v_degree;
-
-                            for (new_v_degree = 0; (new_v_degree < v_degree) &&
-                                                   (v_neighbors_begin[new_v_degree] <= v);
-                                 new_v_degree++)
-                                ;
-
-                            int thread_id = dal::detail::threader_get_current_thread_index();
-                            int64_t indx = (int64_t)thread_id * (int64_t)vertex_count;
-
-                            auto tc = intersection_local_tc<Cpu>{}(t.get_vertex_neighbors_begin(u),
-                                                                   t.get_vertex_neighbors_begin(v),
-                                                                   u_degree,
-                                                                   new_v_degree,
-                                                                   triangles_local + indx,
-                                                                   vertex_count);
-
-                            triangles_local[indx + u] += tc;
-                            triangles_local[indx + v] += tc;
-                        }
-                    });
-        });
+        const auto count_local = [&](std::int64_t u, IndexType v) {
+            if (v <= u) {
+                const IndexType u_degree = t.get_vertex_degree(u);
+                const IndexType* v_neighbors_begin = t.get_vertex_neighbors_begin(v);
+                const IndexType v_degree = t.get_vertex_degree(v);
+                IndexType new_v_degree;
+
+                for (new_v_degree = 0;
+                     (new_v_degree < v_degree) && (v_neighbors_begin[new_v_degree] <= v);
+                     new_v_degree++)
+                    ;
+
+                int thread_id = dal::detail::threader_get_current_thread_index();
+                int64_t indx = (int64_t)thread_id * (int64_t)vertex_count;
+
+                auto tc = intersection_local_tc<Cpu>{}(t.get_vertex_neighbors_begin(u),
+                                                       v_neighbors_begin,
+                                                       u_degree,
+                                                       new_v_degree,
+                                                       triangles_local + indx,
+                                                       vertex_count);
+
+                triangles_local[indx + u] += tc;
+                triangles_local[indx + v] += tc;
+            }
+        };
+
+        if constexpr (std::is_same_v<IndexType, std::int32_t>) {
+            dal::detail::threader_for_simple(vertex_count, vertex_count, [&](std::int32_t u) {
+                if (t.get_vertex_degree(u) >= 2)
+                    dal::detail::threader_for_int32ptr(t.get_vertex_neighbors_begin(u),
+                                                       t.get_vertex_neighbors_end(u),
+                                                       [&](const std::int32_t* v_) {
+                                                           count_local(u, *v_);
+                                                       });
+            });
+        }
+        else {
+            // The neighbors are not split between the threads, as the nested loop over
+            // the pointers is available for 32-bit vertex indices only
+            dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+                if (t.get_vertex_degree(u) >= 2) {
+                    for (auto v_ = t.get_vertex_neighbors_begin(u);
+                         v_ != t.get_vertex_neighbors_end(u);
+                         ++v_) {
+                        count_local(u, *v_);
+                    }
+                }
+            });
+        }
     }
 
     auto arr_triangles = array<std::int64_t>::empty(vertex_count);
 
     int64_t* triangles_ptr = arr_triangles.get_mutable_data();
 
-    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t u) {
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
         triangles_ptr[u] = 0;
     });
 
-    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t u) {
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
         for (int j = 0; j < thread_cnt; j++) {
             int64_t idx_glob = (int64_t)j * (int64_t)vertex_count;
             triangles_ptr[u] += triangles_local[idx_glob + u];
@@ -124,25 +142,25 @@ array<std::int64_t> triangle_counting_local(const dal::preview::detail::topology
     return arr_triangles;
 }
 
-template <typename Cpu>
+template <typename Cpu, typename IndexType>
 std::int64_t triangle_counting_global_scalar(
-    const dal::preview::detail::topology<std::int32_t>& t) {
-    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t(
+    const dal::preview::detail::topology<IndexType>& t) {
+    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int64_int64_t(
         t.get_vertex_count(),
         (std::int64_t)0,
         [&](std::int64_t begin_u, std::int64_t end_u, std::int64_t tc_u) -> std::int64_t {
             for (auto u = begin_u; u != end_u; ++u) {
                 for (auto v_ = t.get_vertex_neighbors_begin(u); v_ != t.get_vertex_neighbors_end(u);
                      ++v_) {
-                    std::int32_t v = *v_;
+                    IndexType v = *v_;
                     if (v > u) {
                         break;
                     }
                     auto u_neighbors_ptr = t.get_vertex_neighbors_begin(u);
                     for (auto w_ = t.get_vertex_neighbors_begin(v);
-                         v_ != t.get_vertex_neighbors_end(u);
+                         w_ != t.get_vertex_neighbors_end(v);
                          ++w_) {
-                        std::int32_t w = *w_;
+                        IndexType w = *w_;
                         if (w > v) {
                             break;
                         }
@@ -163,10 +181,10 @@ std::int64_t triangle_counting_global_scalar(
     return total_s;
 }
 
-template <typename Cpu>
+template <typename Cpu, typename IndexType>
 std::int64_t triangle_counting_global_vector(
-    const dal::preview::detail::topology<std::int32_t>& t) {
-    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t_simple(
+    const dal::preview::detail::topology<IndexType>& t) {
+    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int64_int64_t_simple(
         t.get_vertex_count(),
         (std::int64_t)0,
         [&](std::int64_t begin_u, std::int64_t end_u, std::int64_t tc_u) -> std::int64_t {
@@ -175,41 +193,50 @@ std::int64_t triangle_counting_global_vector(
                     continue;
                 }
                 const auto u_neighbors_begin = t.get_vertex_neighbors_begin(u);
-                const std::int32_t u_degree = t.get_vertex_degree(u);
+                const IndexType u_degree = t.get_vertex_degree(u);
+
+                const auto count_global = [&](const IndexType* begin_v,
+                                              const IndexType* end_v,
+                                              std::int64_t total) -> std::int64_t {
+                    for (auto v_ = begin_v; v_ != end_v; ++v_) {
+                        IndexType v = *v_;
 
-                tc_u += oneapi::dal::detail::parallel_reduce_int32ptr_int64_t_simple(
-                    t.get_vertex_neighbors_begin(u),
-                    t.get_vertex_neighbors_end(u),
-                    (std::int64_t)0,
-                    [&](const std::int32_t* begin_v,
-                        const std::int32_t* end_v,
-                        std::int64_t total) -> std::int64_t {
-                        for (auto v_ = begin_v; v_ != end_v; ++v_) {
-                            std::int32_t v = *v_;
-
-                            if (v > u) {
-                                break;
-                            }
-
-                            const auto v_neighbors_begin = t.get_vertex_neighbors_begin(v);
-                            const std::int32_t v_degree = t.get_vertex_degree(v);
-
-                            std::int32_t new_v_degree = 0;
-                            for (new_v_degree = 0; (new_v_degree < v_degree) &&
-                                                   (v_neighbors_begin[new_v_degree] <= v);
-                                 new_v_degree++)
-                                ;
-
-                            total += preview::backend::intersection<Cpu>(u_neighbors_begin,
-                                                                         v_neighbors_begin,
-                                                                         u_degree,
-                                                                         new_v_degree);
+                        if (v > u) {
+                            break;
                         }
-                        return total;
-                    },
-                    [&](std::int64_t x, std::int64_t y) -> std::int64_t {
-                        return x + y;
-                    });
+
+                        const auto v_neighbors_begin = t.get_vertex_neighbors_begin(v);
+                        const IndexType v_degree = t.get_vertex_degree(v);
+
+                        IndexType new_v_degree = 0;
+                        for (new_v_degree = 0; (new_v_degree < v_degree) &&
+                                               (v_neighbors_begin[new_v_degree] <= v);
+                             new_v_degree++)
+                            ;
+
+                        total += preview::backend::intersection<Cpu>(u_neighbors_begin,
+                                                                     v_neighbors_begin,
+                                                                     u_degree,
+                                                                     new_v_degree);
+                    }
+                    return total;
+                };
+
+                if constexpr (std::is_same_v<IndexType, std::int32_t>) {
+                    tc_u += oneapi::dal::detail::parallel_reduce_int32ptr_int64_t_simple(
+                        t.get_vertex_neighbors_begin(u),
+                        t.get_vertex_neighbors_end(u),
+                        (std::int64_t)0,
+                        count_global,
+                        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+                            return x + y;
+                        });
+                }
+                else {
+                    tc_u = count_global(t.get_vertex_neighbors_begin(u),
+                                        t.get_vertex_neighbors_end(u),
+                                        tc_u);
+                }
             }
             return tc_u;
         },
@@ -268,6 +295,49 @@ std::int64_t triangle_counting_global_vector_relabel(const std::int32_t* vertex_
     return total_s;
 }
 
+/// Counts the triangles of the graph with the compressed neighbor lists. The list of
+/// each vertex is decoded once to the buffer of the thread, and the lists of its
+/// smaller neighbors are intersected with it block by block without full decoding
+template <typename Cpu>
+std::int64_t triangle_counting_global_compressed(
+    const dal::preview::detail::compressed_topology<std::int32_t>& t) {
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t max_degree = t.get_max_degree();
+    const std::int64_t buffer_size = max_degree + dal::preview::detail::compressed_block_size;
+    auto buffers = array<std::int32_t>::empty(thread_count * buffer_size);
+    std::int32_t* buffers_ptr = buffers.get_mutable_data();
+
+    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t_simple(
+        t.get_vertex_count(),
+        (std::int64_t)0,
+        [&](std::int64_t begin_u, std::int64_t end_u, std::int64_t tc_u) -> std::int64_t {
+            std::int32_t* u_neighbors =
+                buffers_ptr + dal::detail::threader_get_current_thread_index() * buffer_size;
+            std::int32_t* v_block = u_neighbors + max_degree;
+            for (auto u = begin_u; u != end_u; ++u) {
+                const std::int32_t u_degree = t.get_vertex_degree(u);
+                if (u_degree < 2) {
+                    continue;
+                }
+                preview::backend::decode_neighbors<Cpu>(t, u, u_neighbors);
+
+                // The common neighbors w < v of u and v are counted for each v < u
+                for (std::int32_t i = 0; i < u_degree && u_neighbors[i] < u; ++i) {
+                    tc_u += preview::backend::intersection_compressed<Cpu>(u_neighbors,
+                                                                           i,
+                                                                           t,
+                                                                           u_neighbors[i],
+                                                                           v_block);
+                }
+            }
+            return tc_u;
+        },
+        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+            return x + y;
+        });
+    return total_s;
+}
+
 template <typename Cpu>
 std::int64_t compute_global_triangles(const array<std::int64_t>& local_triangles,
                                       std::int64_t vertex_count) {
@@ -18,15 +18,21 @@
 
 namespace oneapi::dal::preview::triangle_counting::backend {
 
-template array<std::int64_t> triangle_counting_local<__CPU_TAG__>(
-    const dal::preview::detail::topology<std::int32_t>& t,
-    int64_t* triangles_local);
-
-template std::int64_t triangle_counting_global_scalar<__CPU_TAG__>(
-    const dal::preview::detail::topology<std::int32_t>& t);
-
-template std::int64_t triangle_counting_global_vector<__CPU_TAG__>(
-    const dal::preview::detail::topology<std::int32_t>& t);
+#define INSTANTIATE(IndexType)                                                     \
+    template array<std::int64_t> triangle_counting_local<__CPU_TAG__, IndexType>(  \
+        const dal::preview::detail::topology<IndexType>& t,                        \
+        int64_t* triangles_local);                                                 \
+                                                                                   \
+    template std::int64_t triangle_counting_global_scalar<__CPU_TAG__, IndexType>( \
+        const dal::preview::detail::topology<IndexType>& t);                       \
+                                                                                   \
+    template std::int64_t triangle_counting_global_vector<__CPU_TAG__, IndexType>( \
+        const dal::preview::detail::topology<IndexType>& t);
+
+INSTANTIATE(std::int32_t)
+INSTANTIATE(std::int64_t)
+
+#undef INSTANTIATE
 
 template std::int64_t triangle_counting_global_vector_relabel<__CPU_TAG__>(
     const std::int32_t* vertex_neighbors,
@@ -35,6 +41,9 @@ template std::int64_t triangle_counting_global_vector_relabel<__CPU_TAG__>(
     std::int64_t vertex_count,
     std::int64_t edge_count);
 
+template std::int64_t triangle_counting_global_compressed<__CPU_TAG__>(
+    const dal::preview::detail::compressed_topology<std::int32_t>& t);
+
 template std::int64_t compute_global_triangles<__CPU_TAG__>(
     const array<std::int64_t>& local_triangles,
     std::int64_t vertex_count);
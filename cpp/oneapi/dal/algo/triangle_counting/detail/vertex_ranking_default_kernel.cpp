@@ -20,32 +20,32 @@
 
 namespace oneapi::dal::preview::triangle_counting::detail {
 
-template <typename Float>
+template <typename Float, typename IndexType>
 array<std::int64_t>
-triangle_counting<Float, task::local, dal::preview::detail::topology<std::int32_t>, automatic>::
+triangle_counting<Float, task::local, dal::preview::detail::topology<IndexType>, automatic>::
 operator()(const dal::detail::host_policy& policy,
-           const dal::preview::detail::topology<std::int32_t>& t,
+           const dal::preview::detail::topology<IndexType>& t,
            std::int64_t* triangles_local) const {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
         return backend::triangle_counting_local<decltype(cpu)>(t, triangles_local);
     });
 }
 
-template <typename Float>
+template <typename Float, typename IndexType>
 std::int64_t
-triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, scalar>::
+triangle_counting<Float, task::global, dal::preview::detail::topology<IndexType>, scalar>::
 operator()(const dal::detail::host_policy& policy,
-           const dal::preview::detail::topology<std::int32_t>& t) const {
+           const dal::preview::detail::topology<IndexType>& t) const {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
         return backend::triangle_counting_global_scalar<decltype(cpu)>(t);
     });
 }
 
-template <typename Float>
+template <typename Float, typename IndexType>
 std::int64_t
-triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, vector>::
+triangle_counting<Float, task::global, dal::preview::detail::topology<IndexType>, vector>::
 operator()(const dal::detail::host_policy& policy,
-           const dal::preview::detail::topology<std::int32_t>& t) const {
+           const dal::preview::detail::topology<IndexType>& t) const {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
         return backend::triangle_counting_global_vector<decltype(cpu)>(t);
     });
@@ -71,6 +71,18 @@ std::int64_t triangle_counting<Float,
     });
 }
 
+template <typename Float>
+std::int64_t triangle_counting<Float,
+                               task::global,
+                               dal::preview::detail::compressed_topology<std::int32_t>,
+                               vector>::
+operator()(const dal::detail::host_policy& policy,
+           const dal::preview::detail::compressed_topology<std::int32_t>& t) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::triangle_counting_global_compressed<decltype(cpu)>(t);
+    });
+}
+
 std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
                                       const array<std::int64_t>& local_triangles,
                                       std::int64_t vertex_count) {
@@ -82,16 +94,31 @@ std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
 template struct ONEDAL_EXPORT
     triangle_counting<float, task::local, dal::preview::detail::topology<std::int32_t>, automatic>;
 
+template struct ONEDAL_EXPORT
+    triangle_counting<float, task::local, dal::preview::detail::topology<std::int64_t>, automatic>;
+
 template struct ONEDAL_EXPORT
     triangle_counting<float, task::global, dal::preview::detail::topology<std::int32_t>, scalar>;
 
+template struct ONEDAL_EXPORT
+    triangle_counting<float, task::global, dal::preview::detail::topology<std::int64_t>, scalar>;
+
 template struct ONEDAL_EXPORT
     triangle_counting<float, task::global, dal::preview::detail::topology<std::int32_t>, vector>;
 
+template struct ONEDAL_EXPORT
+    triangle_counting<float, task::global, dal::preview::detail::topology<std::int64_t>, vector>;
+
 template struct ONEDAL_EXPORT triangle_counting<float,
                                                 task::global,
                                                 dal::preview::detail::topology<std::int32_t>,
                                                 vector,
                                                 relabeled>;
 
+template struct ONEDAL_EXPORT
+    triangle_counting<float,
+                      task::global,
+                      dal::preview::detail::compressed_topology<std::int32_t>,
+                      vector>;
+
 } // namespace oneapi::dal::preview::triangle_counting::detail
@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "oneapi/dal/algo/triangle_counting/common.hpp"
 #include "oneapi/dal/algo/triangle_counting/detail/relabel_kernel.hpp"
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
 
@@ -47,32 +50,26 @@ struct triangle_counting {
                                            const Topology& t) const;
 };
 
-template <typename Float>
+template <typename Float, typename IndexType>
 struct triangle_counting<Float,
                          task::local,
-                         dal::preview::detail::topology<std::int32_t>,
+                         dal::preview::detail::topology<IndexType>,
                          automatic> {
     array<std::int64_t> operator()(const dal::detail::host_policy& ctx,
-                                   const dal::preview::detail::topology<std::int32_t>& t,
+                                   const dal::preview::detail::topology<IndexType>& t,
                                    std::int64_t* triangles_local) const;
 };
 
-template <typename Float>
-struct triangle_counting<Float,
-                         task::global,
-                         dal::preview::detail::topology<std::int32_t>,
-                         scalar> {
+template <typename Float, typename IndexType>
+struct triangle_counting<Float, task::global, dal::preview::detail::topology<IndexType>, scalar> {
     std::int64_t operator()(const dal::detail::host_policy& ctx,
-                            const dal::preview::detail::topology<std::int32_t>& t) const;
+                            const dal::preview::detail::topology<IndexType>& t) const;
 };
 
-template <typename Float>
-struct triangle_counting<Float,
-                         task::global,
-                         dal::preview::detail::topology<std::int32_t>,
-                         vector> {
+template <typename Float, typename IndexType>
+struct triangle_counting<Float, task::global, dal::preview::detail::topology<IndexType>, vector> {
     std::int64_t operator()(const dal::detail::host_policy& ctx,
-                            const dal::preview::detail::topology<std::int32_t>& t) const;
+                            const dal::preview::detail::topology<IndexType>& t) const;
 };
 
 template <typename Float>
@@ -89,6 +86,16 @@ struct triangle_counting<Float,
                             std::int64_t edge_count) const;
 };
 
+template <typename Float>
+struct triangle_counting<Float,
+                         task::global,
+                         dal::preview::detail::compressed_topology<std::int32_t>,
+                         vector> {
+    std::int64_t operator()(
+        const dal::detail::host_policy& ctx,
+        const dal::preview::detail::compressed_topology<std::int32_t>& t) const;
+};
+
 ONEDAL_EXPORT std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
                                                     const array<std::int64_t>& local_triangles,
                                                     std::int64_t vertex_count);
@@ -122,6 +129,68 @@ struct triangle_counting_local {
     }
 };
 
+/// Counts the triangles of the graph with the vertices relabeled by non-increasing
+/// degree. The relabeling is implemented for 32-bit vertex indices only, the graphs
+/// with 64-bit indices are processed as is
+template <typename Allocator, typename Topology>
+struct triangle_counting_relabeled {
+    inline std::int64_t operator()(const dal::detail::host_policy& ctx,
+                                   const Allocator& alloc,
+                                   const Topology& t) {
+        if constexpr (!std::is_same_v<typename Topology::vertex_type, std::int32_t>) {
+            return triangle_counting<float, task::global, Topology, vector>()(ctx, t);
+        }
+        else {
+            const auto vertex_count = t.get_vertex_count();
+            const auto edge_count = t.get_edge_count();
+
+            using int32_allocator_type =
+                typename std::allocator_traits<Allocator>::template rebind_alloc<std::int32_t>;
+
+            using int64_allocator_type =
+                typename std::allocator_traits<Allocator>::template rebind_alloc<std::int64_t>;
+
+            int64_allocator_type int64_allocator(alloc);
+            int32_allocator_type int32_allocator(alloc);
+
+            std::int32_t* g_vertex_neighbors_relabel =
+                oneapi::dal::preview::detail::allocate(int32_allocator, edge_count * 2);
+            std::int32_t* g_degrees_relabel =
+                oneapi::dal::preview::detail::allocate(int32_allocator, vertex_count);
+            std::int64_t* g_edge_offsets_relabel =
+                oneapi::dal::preview::detail::allocate(int64_allocator, vertex_count + 1);
+
+            relabel_by_greater_degree<Allocator>{}(ctx,
+                                                   t,
+                                                   g_vertex_neighbors_relabel,
+                                                   g_edge_offsets_relabel,
+                                                   g_degrees_relabel,
+                                                   alloc);
+
+            const std::int64_t triangles =
+                triangle_counting<float, task::global, Topology, vector, relabeled>()(
+                    ctx,
+                    g_vertex_neighbors_relabel,
+                    g_edge_offsets_relabel,
+                    g_degrees_relabel,
+                    vertex_count,
+                    edge_count);
+
+            oneapi::dal::preview::detail::deallocate(int32_allocator,
+                                                     g_vertex_neighbors_relabel,
+                                                     edge_count * 2);
+            oneapi::dal::preview::detail::deallocate(int32_allocator,
+                                                     g_degrees_relabel,
+                                                     vertex_count);
+
+            oneapi::dal::preview::detail::deallocate(int64_allocator,
+                                                     g_edge_offsets_relabel,
+                                                     vertex_count + 1);
+            return triangles;
+        }
+    }
+};
+
 template <typename Allocator, typename Topology>
 struct vertex_ranking_kernel_cpu<method::ordered_count, task::global, Allocator, Topology> {
     inline vertex_ranking_result<task::global> operator()(
@@ -135,70 +204,17 @@ struct vertex_ranking_kernel_cpu<method::ordered_count, task::global, Allocator,
         }
         const auto edge_count = t.get_edge_count();
         const auto relabel = desc.get_relabel();
+        const std::int32_t average_degree = edge_count / vertex_count;
+        const std::int32_t average_degree_sparsity_boundary = 4;
         std::int64_t triangles = 0;
-        if (relabel == relabel::yes) {
-            const std::int32_t average_degree = edge_count / vertex_count;
-            const std::int32_t average_degree_sparsity_boundary = 4;
-            if (average_degree < average_degree_sparsity_boundary) {
-                triangles = triangle_counting<float, task::global, Topology, scalar>()(ctx, t);
-            }
-            else {
-                std::int32_t* g_vertex_neighbors_relabel = nullptr;
-                std::int64_t* g_edge_offsets_relabel = nullptr;
-                std::int32_t* g_degrees_relabel = nullptr;
-
-                using int32_allocator_type =
-                    typename std::allocator_traits<Allocator>::template rebind_alloc<std::int32_t>;
-
-                using int64_allocator_type =
-                    typename std::allocator_traits<Allocator>::template rebind_alloc<std::int64_t>;
-
-                int64_allocator_type int64_allocator(alloc);
-                int32_allocator_type int32_allocator(alloc);
-
-                g_vertex_neighbors_relabel =
-                    oneapi::dal::preview::detail::allocate(int32_allocator, edge_count * 2);
-                g_degrees_relabel =
-                    oneapi::dal::preview::detail::allocate(int32_allocator, vertex_count);
-                g_edge_offsets_relabel =
-                    oneapi::dal::preview::detail::allocate(int64_allocator, vertex_count + 1);
-
-                relabel_by_greater_degree<Allocator>{}(ctx,
-                                                       t,
-                                                       g_vertex_neighbors_relabel,
-                                                       g_edge_offsets_relabel,
-                                                       g_degrees_relabel,
-                                                       alloc);
-
-                triangles = triangle_counting<float, task::global, Topology, vector, relabeled>()(
-                    ctx,
-                    g_vertex_neighbors_relabel,
-                    g_edge_offsets_relabel,
-                    g_degrees_relabel,
-                    vertex_count,
-                    edge_count);
-
-                oneapi::dal::preview::detail::deallocate(int32_allocator,
-                                                         g_vertex_neighbors_relabel,
-                                                         edge_count * 2);
-                oneapi::dal::preview::detail::deallocate(int32_allocator,
-                                                         g_degrees_relabel,
-                                                         vertex_count);
-
-                oneapi::dal::preview::detail::deallocate(int64_allocator,
-                                                         g_edge_offsets_relabel,
-                                                         vertex_count + 1);
-            }
+        if (average_degree < average_degree_sparsity_boundary) {
+            triangles = triangle_counting<float, task::global, Topology, scalar>()(ctx, t);
+        }
+        else if (relabel == relabel::yes) {
+            triangles = triangle_counting_relabeled<Allocator, Topology>()(ctx, alloc, t);
         }
         else {
-            const std::int32_t average_degree = edge_count / vertex_count;
-            const std::int32_t average_degree_sparsity_boundary = 4;
-            if (average_degree < average_degree_sparsity_boundary) {
-                triangles = triangle_counting<float, task::global, Topology, scalar>()(ctx, t);
-            }
-            else {
-                triangles = triangle_counting<float, task::global, Topology, vector>()(ctx, t);
-            }
+            triangles = triangle_counting<float, task::global, Topology, vector>()(ctx, t);
         }
 
         vertex_ranking_result<task::global> res;
@@ -17,11 +17,22 @@
 #include <array>
 
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking.hpp"
+#include "oneapi/dal/algo/triangle_counting/detail/vertex_ranking_default_kernel.hpp"
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
 
 #include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/loader.hpp"
 
 namespace oneapi::dal::algo::triangle_counting::test {
 
+namespace te = dal::test::engine;
+
+template <typename IndexType>
+using graph_t = dal::preview::undirected_adjacency_vector_graph<dal::preview::empty_value,
+                                                                dal::preview::empty_value,
+                                                                dal::preview::empty_value,
+                                                                IndexType>;
+
 class graph_base_data {
 public:
     graph_base_data() = default;
@@ -348,6 +359,86 @@ public:
         const auto result_vertex_ranking = dal::preview::vertex_ranking(tc_desc, g);
         REQUIRE(result_vertex_ranking.get_global_rank() == global_triangle_count);
     }
+
+    /// Counts the global triangles of the graph with the compressed neighbor lists
+    template <typename Graph>
+    std::int64_t count_compressed_triangles(const Graph &g) {
+        const auto policy = dal::detail::host_policy::get_default();
+        const auto &t = oneapi::dal::detail::get_impl(g).get_topology();
+        const auto compressed = dal::preview::detail::compress_topology(policy, t);
+        return dal::preview::triangle_counting::detail::triangle_counting<
+            float,
+            dal::preview::triangle_counting::task::global,
+            dal::preview::detail::compressed_topology<std::int32_t>,
+            dal::preview::triangle_counting::detail::vector>{}(policy, compressed);
+    }
+
+    template <typename GraphType>
+    void check_global_task_compressed() {
+        GraphType graph_data;
+        const auto g = create_graph<GraphType>();
+        REQUIRE(count_compressed_triangles(g) == graph_data.get_global_triangle_count());
+    }
+
+    /// Checks that the triangles of the random graph with the compressed neighbor
+    /// lists are counted the same way as with the CSR topology
+    void check_compressed_random_graph(std::int64_t vertex_count, std::int64_t edge_count) {
+        const te::edge_list_file file{ "triangle_counting_test.csv",
+                                       te::generate_edges(vertex_count, edge_count) };
+        const auto g = file.load<graph_t<std::int32_t>>();
+
+        std::allocator<char> alloc;
+        const auto global_desc = dal::preview::triangle_counting::descriptor<
+                                     float,
+                                     dal::preview::triangle_counting::method::ordered_count,
+                                     dal::preview::triangle_counting::task::global,
+                                     std::allocator<char>>(alloc)
+                                     .set_relabel(dal::preview::triangle_counting::relabel::no);
+        REQUIRE(count_compressed_triangles(g) ==
+                dal::preview::vertex_ranking(global_desc, g).get_global_rank());
+    }
+
+    /// Loads the random graph with the 32-bit and the 64-bit vertex indices and
+    /// checks that the triangles of both graphs are counted the same way
+    void check_64_bit_indices(std::int64_t vertex_count, std::int64_t edge_count) {
+        const te::edge_list_file file{ "triangle_counting_test.csv",
+                                       te::generate_edges(vertex_count, edge_count) };
+        const auto g = file.load<graph_t<std::int32_t>>();
+        const auto g_64 = file.load<graph_t<std::int64_t>>();
+
+        std::allocator<char> alloc;
+        const auto local_desc = dal::preview::triangle_counting::descriptor<
+            float,
+            dal::preview::triangle_counting::method::ordered_count,
+            dal::preview::triangle_counting::task::local_and_global,
+            std::allocator<char>>(alloc);
+        const auto result = dal::preview::vertex_ranking(local_desc, g);
+        const auto result_64 = dal::preview::vertex_ranking(local_desc, g_64);
+        REQUIRE(result_64.get_global_rank() == result.get_global_rank());
+
+        const auto ranks_table = result.get_ranks();
+        const auto ranks_64_table = result_64.get_ranks();
+        REQUIRE(ranks_64_table.get_row_count() == ranks_table.get_row_count());
+        const auto ranks =
+            static_cast<const dal::homogen_table &>(ranks_table).get_data<std::int64_t>();
+        const auto ranks_64 =
+            static_cast<const dal::homogen_table &>(ranks_64_table).get_data<std::int64_t>();
+        for (std::int64_t i = 0; i < ranks_table.get_row_count(); i++) {
+            REQUIRE(ranks_64[i] == ranks[i]);
+        }
+
+        for (const auto relabel : { dal::preview::triangle_counting::relabel::yes,
+                                    dal::preview::triangle_counting::relabel::no }) {
+            const auto global_desc = dal::preview::triangle_counting::descriptor<
+                                         float,
+                                         dal::preview::triangle_counting::method::ordered_count,
+                                         dal::preview::triangle_counting::task::global,
+                                         std::allocator<char>>(alloc)
+                                         .set_relabel(relabel);
+            REQUIRE(dal::preview::vertex_ranking(global_desc, g_64).get_global_rank() ==
+                    result.get_global_rank());
+        }
+    }
 };
 
 TEST_M(triangle_counting_test, "Local task: graph with average_degree < 4") {
@@ -400,6 +491,31 @@ TEST_M(triangle_counting_test, "Global task: not relabeled graph with average_de
     this->check_global_task_not_relabeled<graph_with_isolated_vertex_11_type>();
 }
 
+TEST_M(triangle_counting_test, "Global task: compressed topology") {
+    this->check_global_task_compressed<complete_graph_5_type>();
+    this->check_global_task_compressed<complete_graph_9_type>();
+    this->check_global_task_compressed<acyclic_graph_8_type>();
+    this->check_global_task_compressed<two_vertices_graph_type>();
+    this->check_global_task_compressed<cycle_graph_9_type>();
+    this->check_global_task_compressed<triangle_graph_type>();
+    this->check_global_task_compressed<wheel_graph_6_type>();
+    this->check_global_task_compressed<graph_with_isolated_vertices_10_type>();
+    this->check_global_task_compressed<graph_with_isolated_vertex_11_type>();
+}
+
+TEST_M(triangle_counting_test, "Global task: compressed topology of random graphs") {
+    // The degrees above the block size give the lists of several blocks
+    this->check_compressed_random_graph(1000, 1000);
+    this->check_compressed_random_graph(1000, 16000);
+    this->check_compressed_random_graph(2000, 200000);
+}
+
+TEST_M(triangle_counting_test, "Graph with 64-bit vertex indices loaded from the edge list") {
+    // The graphs with the average degree below and above 4 are processed differently
+    this->check_64_bit_indices(1000, 1000);
+    this->check_64_bit_indices(1000, 16000);
+}
+
 TEST_M(triangle_counting_test, "Local task: null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     std::allocator<char> alloc;
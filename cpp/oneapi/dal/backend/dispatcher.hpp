@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <optional>
+#include <type_traits>
+
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/backend/common.hpp"
 #include "oneapi/dal/backend/dispatcher_cpu.hpp"
 
@@ -60,11 +64,39 @@ private:
     detail::cpu_extension cpu_extensions_;
 };
 
+/// Calls the operation within the task arena limited by the thread settings
+/// of the policy. The operation is called directly if the policy has no limits.
+template <typename Op>
+inline auto execute_in_policy_arena(const detail::host_policy& ctx, Op&& op) {
+    const std::int64_t max_thread_count = ctx.get_max_thread_count();
+    const std::int32_t numa_node_id = ctx.get_numa_node_id();
+    if (max_thread_count == 0 && numa_node_id < 0) {
+        return op();
+    }
+
+    const auto max_concurrency = detail::integral_cast<std::int32_t>(max_thread_count);
+    using result_t = std::invoke_result_t<Op>;
+    if constexpr (std::is_void_v<result_t>) {
+        detail::threader_execute_in_arena(max_concurrency, numa_node_id, [&]() {
+            op();
+        });
+    }
+    else {
+        std::optional<result_t> result;
+        detail::threader_execute_in_arena(max_concurrency, numa_node_id, [&]() {
+            result.emplace(op());
+        });
+        return std::move(*result);
+    }
+}
+
 template <typename CpuKernel>
 struct kernel_dispatcher<CpuKernel> {
     template <typename... Args>
     auto operator()(const detail::host_policy& ctx, Args&&... args) const {
-        return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
+        return execute_in_policy_arena(ctx, [&]() {
+            return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
+        });
     }
 };
 
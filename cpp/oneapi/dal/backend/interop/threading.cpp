@@ -25,6 +25,16 @@ ONEDAL_EXPORT int _onedal_threader_get_current_thread_index() {
     return _daal_threader_get_current_thread_index();
 }
 
+ONEDAL_EXPORT void _onedal_threader_execute_in_arena(std::int32_t max_concurrency,
+                                                     std::int32_t numa_node_id,
+                                                     const void *a,
+                                                     oneapi::dal::preview::functype_arena func) {
+    _daal_threader_execute_in_arena(max_concurrency,
+                                    numa_node_id,
+                                    a,
+                                    static_cast<daal::functype_arena>(func));
+}
+
 ONEDAL_EXPORT void _onedal_threader_for(std::int32_t n,
                                         std::int32_t threads_request,
                                         const void *a,
@@ -32,6 +42,26 @@ ONEDAL_EXPORT void _onedal_threader_for(std::int32_t n,
     _daal_threader_for(n, threads_request, a, static_cast<daal::functype>(func));
 }
 
+ONEDAL_EXPORT void _onedal_threader_for_grain(std::int32_t n,
+                                              std::int32_t threads_request,
+                                              std::int32_t grain_size,
+                                              const void *a,
+                                              oneapi::dal::preview::functype func) {
+    _daal_threader_for_grain(n, threads_request, grain_size, a, static_cast<daal::functype>(func));
+}
+
+ONEDAL_EXPORT void _onedal_threader_for_blocked(std::int32_t n,
+                                                std::int32_t threads_request,
+                                                std::int32_t grain_size,
+                                                const void *a,
+                                                oneapi::dal::preview::functype_blocked func) {
+    _daal_threader_for_blocked_grain(n,
+                                     threads_request,
+                                     grain_size,
+                                     a,
+                                     static_cast<daal::functype2>(func));
+}
+
 ONEDAL_EXPORT void _onedal_threader_for_int64(std::int64_t n,
                                               const void *a,
                                               oneapi::dal::preview::functype_int64 func) {
@@ -15,39 +15,37 @@
 *******************************************************************************/
 
 #pragma once
+#include <algorithm>
 
 #include <immintrin.h>
 
 #include <daal/src/services/service_defines.h>
 
-namespace oneapi::dal::preview::backend {
+#include "oneapi/dal/backend/dispatcher.hpp"
 
-template <typename Cpu>
-ONEDAL_FORCEINLINE std::int64_t intersection(const std::int32_t *neigh_u,
-                                             const std::int32_t *neigh_v,
-                                             std::int32_t n_u,
-                                             std::int32_t n_v) {
-    std::int64_t total = 0;
-    std::int32_t i_u = 0, i_v = 0;
-    while (i_u < n_u && i_v < n_v) {
-        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
-            return total;
-        }
-        if (neigh_u[i_u] == neigh_v[i_v])
-            total++, i_u++, i_v++;
-        else if (neigh_u[i_u] < neigh_v[i_v])
-            i_u++;
-        else if (neigh_u[i_u] > neigh_v[i_v])
-            i_v++;
-    }
-    return total;
-}
+// The vector paths are selected by the instruction set the translation unit is built for,
+// so every compiler gets them in the kernels dispatched to the matching CPUs
+#if defined(__AVX512F__) && defined(__AVX512VL__) && defined(__AVX512DQ__)
+#define ONEDAL_INTERSECTION_AVX512
+#endif
+
+#if defined(__AVX2__)
+#define ONEDAL_INTERSECTION_AVX2
+#endif
+
+namespace oneapi::dal::preview::backend {
 
 #if defined(__INTEL_COMPILER)
 ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t &x) {
     return _popcnt32(x);
 }
 #define GRAPH_STACK_ALING(x) __declspec(align(x))
+#elif defined(__POPCNT__)
+ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t &x) {
+    return _mm_popcnt_u32(static_cast<std::uint32_t>(x));
+}
+#define GRAPH_STACK_ALING(x) \
+    {}
 #else
 ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t &x) {
     std::int32_t count = 0;
@@ -62,15 +60,100 @@ ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t &x) {
     {}
 #endif
 
+/// The ratio of the neighbor list lengths starting from which the intersection
+/// is computed by galloping over the longer list instead of merging the lists.
+/// The vector merge stays faster up to a larger skew than the scalar one
+template <typename Cpu>
+inline constexpr std::int64_t galloping_intersection_ratio = 8;
+
+#if defined(ONEDAL_INTERSECTION_AVX2)
 template <>
-ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
-    const std::int32_t *neigh_u,
-    const std::int32_t *neigh_v,
-    std::int32_t n_u,
-    std::int32_t n_v) {
+inline constexpr std::int64_t galloping_intersection_ratio<dal::backend::cpu_dispatch_avx2> = 64;
+
+template <>
+inline constexpr std::int64_t galloping_intersection_ratio<dal::backend::cpu_dispatch_avx512> = 64;
+#endif
+
+template <typename Cpu>
+ONEDAL_FORCEINLINE bool is_galloping_intersection_preferable(std::int64_t n_u,
+                                                             std::int64_t n_v) {
+    const std::int64_t n_min = std::min(n_u, n_v);
+    const std::int64_t n_max = std::max(n_u, n_v);
+    return n_min > 0 && n_min * galloping_intersection_ratio<Cpu> <= n_max;
+}
+
+/// Merges the sorted lists starting from the positions i_u and i_v
+/// and returns the number of common elements found
+template <typename Index>
+ONEDAL_FORCEINLINE std::int64_t intersection_merge(const Index *neigh_u,
+                                                   const Index *neigh_v,
+                                                   Index n_u,
+                                                   Index n_v,
+                                                   Index &i_u,
+                                                   Index &i_v) {
+    std::int64_t total = 0;
+    while (i_u < n_u && i_v < n_v) {
+        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
+            return total;
+        }
+        if (neigh_u[i_u] == neigh_v[i_v])
+            total++, i_u++, i_v++;
+        else if (neigh_u[i_u] < neigh_v[i_v])
+            i_u++;
+        else if (neigh_u[i_u] > neigh_v[i_v])
+            i_v++;
+    }
+    return total;
+}
+
+/// Looks up every element of the shorter sorted list in the longer one by the exponential
+/// search started from the position of the previous match, so the cost is
+/// O(n_short * log(n_long / n_short)) instead of O(n_short + n_long) of the merge
+template <typename Index>
+ONEDAL_FORCEINLINE std::int64_t intersection_galloping(const Index *neigh_u,
+                                                       const Index *neigh_v,
+                                                       Index n_u,
+                                                       Index n_v) {
+    const Index *short_list = (n_u <= n_v) ? neigh_u : neigh_v;
+    const Index *long_list = (n_u <= n_v) ? neigh_v : neigh_u;
+    const std::int64_t n_short = std::min(n_u, n_v);
+    const std::int64_t n_long = std::max(n_u, n_v);
+    if (n_short == 0 || short_list[0] > long_list[n_long - 1]) {
+        return 0;
+    }
+
+    std::int64_t total = 0;
+    std::int64_t low = 0;
+    for (std::int64_t i = 0; i < n_short && low < n_long; ++i) {
+        const Index value = short_list[i];
+        if (long_list[low] < value) {
+            std::int64_t bound = 1;
+            while (low + bound < n_long && long_list[low + bound] < value) {
+                bound *= 2;
+            }
+            // long_list[low + bound / 2] < value, so the match is after it
+            const Index *first = long_list + low + bound / 2 + 1;
+            const Index *last = long_list + std::min(low + bound + 1, n_long);
+            low = std::lower_bound(first, last, value) - long_list;
+        }
+        if (low < n_long && long_list[low] == value) {
+            ++total;
+            ++low;
+        }
+    }
+    return total;
+}
+
+#if defined(ONEDAL_INTERSECTION_AVX512)
+/// Intersects the sorted lists by blocks of 16, 8 and 4 elements while both lists
+/// have enough elements left. Advances i_u and i_v, the rest is left to the merge
+ONEDAL_FORCEINLINE std::int64_t intersection_blocks_avx512(const std::int32_t *neigh_u,
+                                                           const std::int32_t *neigh_v,
+                                                           std::int32_t n_u,
+                                                           std::int32_t n_v,
+                                                           std::int32_t &i_u,
+                                                           std::int32_t &i_v) {
     std::int64_t total = 0;
-    std::int32_t i_u = 0, i_v = 0;
-#if defined(__INTEL_COMPILER)
     while (i_u < (n_u / 16) * 16 && i_v < (n_v / 16) * 16) { // not in last n%16 elements
         // assumes neighbor list is ordered
         std::int32_t min_neigh_u = neigh_u[i_u];
@@ -163,7 +246,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
 
     while (i_u < (n_u / 16) * 16 && i_v < n_v) {
         __m512i v_u = _mm512_loadu_si512((void *)(neigh_u + i_u));
-        while (neigh_v[i_v] <= neigh_u[i_u + 15] && i_v < n_v) {
+        while (i_v < n_v && neigh_v[i_v] <= neigh_u[i_u + 15]) {
             __m512i tmp_v_v = _mm512_set1_epi32(neigh_v[i_v]);
             __mmask16 match = _mm512_cmpeq_epi32_mask(v_u, tmp_v_v);
             if (_mm512_mask2int(match))
@@ -174,7 +257,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
     }
     while (i_v < (n_v / 16) * 16 && i_u < n_u) {
         __m512i v_v = _mm512_loadu_si512((void *)(neigh_v + i_v));
-        while (neigh_u[i_u] <= neigh_v[i_v + 15] && i_u < n_u) {
+        while (i_u < n_u && neigh_u[i_u] <= neigh_v[i_v + 15]) {
             __m512i tmp_v_u = _mm512_set1_epi32(neigh_u[i_u]);
             __mmask16 match = _mm512_cmpeq_epi32_mask(v_v, tmp_v_u);
             if (_mm512_mask2int(match))
@@ -250,7 +333,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
     }
     if (i_u <= (n_u - 8) && i_v < n_v) {
         __m256i v_u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(neigh_u + i_u));
-        while (neigh_v[i_v] <= neigh_u[i_u + 7] && i_v < n_v) {
+        while (i_v < n_v && neigh_v[i_v] <= neigh_u[i_u + 7]) {
             __m256i tmp_v_v = _mm256_set1_epi32(neigh_v[i_v]);
             __mmask8 match = _mm256_cmpeq_epi32_mask(v_u, tmp_v_v);
             if (_cvtmask8_u32(match))
@@ -261,7 +344,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
     }
     if (i_v <= (n_v - 8) && i_u < n_u) {
         __m256i v_v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(neigh_v + i_v));
-        while (neigh_u[i_u] <= neigh_v[i_v + 7] && i_u < n_u) {
+        while (i_u < n_u && neigh_u[i_u] <= neigh_v[i_v + 7]) {
             __m256i tmp_v_u = _mm256_set1_epi32(neigh_u[i_u]);
             __mmask8 match = _mm256_cmpeq_epi32_mask(v_v, tmp_v_u);
             if (_cvtmask8_u32(match))
@@ -319,7 +402,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
     }
     if (i_u <= (n_u - 4) && i_v < n_v) {
         __m128i v_u = _mm_loadu_si128(reinterpret_cast<const __m128i *>(neigh_u + i_u));
-        while (neigh_v[i_v] <= neigh_u[i_u + 3] && i_v < n_v) {
+        while (i_v < n_v && neigh_v[i_v] <= neigh_u[i_u + 3]) {
             __m128i tmp_v_v = _mm_set1_epi32(neigh_v[i_v]);
             __mmask8 match = _mm_cmpeq_epi32_mask(v_u, tmp_v_v);
             if (_cvtmask8_u32(match))
@@ -330,7 +413,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
     }
     if (i_v <= (n_v - 4) && i_u < n_u) {
         __m128i v_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(neigh_v + i_v));
-        while (neigh_u[i_u] <= neigh_v[i_v + 3] && i_u < n_u) {
+        while (i_u < n_u && neigh_u[i_u] <= neigh_v[i_v + 3]) {
             __m128i tmp_v_u = _mm_set1_epi32(neigh_u[i_u]);
             __mmask8 match = _mm_cmpeq_epi32_mask(v_v, tmp_v_u);
             if (_cvtmask8_u32(match))
@@ -339,30 +422,20 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
         }
         i_v += 4;
     }
-#endif
-    while (i_u < n_u && i_v < n_v) {
-        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
-            return total;
-        }
-        if (neigh_u[i_u] == neigh_v[i_v])
-            total++, i_u++, i_v++;
-        else if (neigh_u[i_u] < neigh_v[i_v])
-            i_u++;
-        else if (neigh_u[i_u] > neigh_v[i_v])
-            i_v++;
-    }
     return total;
 }
+#endif
 
-template <>
-ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
-    const std::int32_t *neigh_u,
-    const std::int32_t *neigh_v,
-    std::int32_t n_u,
-    std::int32_t n_v) {
+#if defined(ONEDAL_INTERSECTION_AVX2)
+/// Intersects the sorted lists by blocks of 8 and 4 elements while both lists
+/// have enough elements left. Advances i_u and i_v, the rest is left to the merge
+ONEDAL_FORCEINLINE std::int64_t intersection_blocks_avx2(const std::int32_t *neigh_u,
+                                                         const std::int32_t *neigh_v,
+                                                         std::int32_t n_u,
+                                                         std::int32_t n_v,
+                                                         std::int32_t &i_u,
+                                                         std::int32_t &i_v) {
     std::int64_t total = 0;
-    std::int32_t i_u = 0, i_v = 0;
-#if defined(__INTEL_COMPILER)
     const std::int32_t n_u_8_end = n_u - 8;
     const std::int32_t n_v_8_end = n_v - 8;
     while (i_u <= n_u_8_end && i_v <= n_v_8_end) {
@@ -453,7 +526,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
         __m256i v_u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(neigh_u + i_u));
 
         const std::int32_t neighu_iu = neigh_u[i_u + 7];
-        for (; neigh_v[i_v] <= neighu_iu && i_v < n_v; i_v++) {
+        for (; i_v < n_v && neigh_v[i_v] <= neighu_iu; i_v++) {
             __m256i tmp_v_v = _mm256_set1_epi32(neigh_v[i_v]);
 
             __m256i match = _mm256_cmpeq_epi32(v_u, tmp_v_v);
@@ -465,7 +538,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
         __m256i v_v = _mm256_loadu_si256(
             reinterpret_cast<const __m256i *>(neigh_v + i_v)); // load 8 neighbors of v
         const std::int32_t neighv_iv = neigh_v[i_v + 7];
-        for (; neigh_u[i_u] <= neighv_iv && i_u < n_u; i_u++) {
+        for (; i_u < n_u && neigh_u[i_u] <= neighv_iv; i_u++) {
             __m256i tmp_v_u = _mm256_set1_epi32(neigh_u[i_u]);
             __m256i match = _mm256_cmpeq_epi32(v_v, tmp_v_u);
             unsigned int scalar_match = _mm256_movemask_ps(_mm256_castsi256_ps(match));
@@ -535,7 +608,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
         __m128i v_u = _mm_loadu_si128(
             reinterpret_cast<const __m128i *>(neigh_u + i_u)); // load 8 neighbors of u
         const std::int32_t neighu_iu = neigh_u[i_u + 3];
-        for (; neigh_v[i_v] <= neighu_iu && i_v < n_v; i_v++) {
+        for (; i_v < n_v && neigh_v[i_v] <= neighu_iu; i_v++) {
             __m128i tmp_v_v = _mm_set1_epi32(neigh_v[i_v]);
             __m128i match = _mm_cmpeq_epi32(v_u, tmp_v_v);
             unsigned int scalar_match = _mm_movemask_ps(_mm_castsi128_ps(match));
@@ -547,7 +620,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
         __m128i v_v = _mm_loadu_si128(
             reinterpret_cast<const __m128i *>(neigh_v + i_v)); // load 8 neighbors of v
         const std::int32_t neighv_iv = neigh_v[i_v + 3];
-        for (; neigh_u[i_u] <= neighv_iv && i_u < n_u; i_u++) {
+        for (; i_u < n_u && neigh_u[i_u] <= neighv_iv; i_u++) {
             __m128i tmp_v_u = _mm_set1_epi32(neigh_u[i_u]);
             __m128i match = _mm_cmpeq_epi32(v_v, tmp_v_u);
             unsigned int scalar_match = _mm_movemask_ps(_mm_castsi128_ps(match));
@@ -555,19 +628,73 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
         }
         i_v += 4;
     }
+    return total;
+}
 #endif
-    while (i_u < n_u && i_v < n_v) {
-        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
-            return total;
-        }
-        if (neigh_u[i_u] == neigh_v[i_v])
-            total++, i_u++, i_v++;
-        else if (neigh_u[i_u] < neigh_v[i_v])
-            i_u++;
-        else if (neigh_u[i_u] > neigh_v[i_v])
-            i_v++;
+
+template <typename Cpu>
+ONEDAL_FORCEINLINE std::int64_t intersection(const std::int32_t *neigh_u,
+                                             const std::int32_t *neigh_v,
+                                             std::int32_t n_u,
+                                             std::int32_t n_v) {
+    if (is_galloping_intersection_preferable<Cpu>(n_u, n_v)) {
+        return intersection_galloping(neigh_u, neigh_v, n_u, n_v);
     }
-    return total;
+    std::int32_t i_u = 0, i_v = 0;
+    return intersection_merge(neigh_u, neigh_v, n_u, n_v, i_u, i_v);
+}
+
+/// Counts the common elements of the sorted lists of 64-bit vertex identifiers.
+/// The vector kernels handle 32-bit identifiers only, so the lists are merged or
+/// galloped over with the scalar code on all CPUs
+template <typename Cpu>
+ONEDAL_FORCEINLINE std::int64_t intersection(const std::int64_t *neigh_u,
+                                             const std::int64_t *neigh_v,
+                                             std::int64_t n_u,
+                                             std::int64_t n_v) {
+    if (is_galloping_intersection_preferable<dal::backend::cpu_dispatch_sse2>(n_u, n_v)) {
+        return intersection_galloping(neigh_u, neigh_v, n_u, n_v);
+    }
+    std::int64_t i_u = 0, i_v = 0;
+    return intersection_merge(neigh_u, neigh_v, n_u, n_v, i_u, i_v);
+}
+
+template <>
+ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
+    const std::int32_t *neigh_u,
+    const std::int32_t *neigh_v,
+    std::int32_t n_u,
+    std::int32_t n_v) {
+    using cpu_t = dal::backend::cpu_dispatch_avx512;
+    if (is_galloping_intersection_preferable<cpu_t>(n_u, n_v)) {
+        return intersection_galloping(neigh_u, neigh_v, n_u, n_v);
+    }
+    std::int64_t total = 0;
+    std::int32_t i_u = 0, i_v = 0;
+#if defined(ONEDAL_INTERSECTION_AVX512)
+    total += intersection_blocks_avx512(neigh_u, neigh_v, n_u, n_v, i_u, i_v);
+#elif defined(ONEDAL_INTERSECTION_AVX2)
+    total += intersection_blocks_avx2(neigh_u, neigh_v, n_u, n_v, i_u, i_v);
+#endif
+    return total + intersection_merge(neigh_u, neigh_v, n_u, n_v, i_u, i_v);
+}
+
+template <>
+ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
+    const std::int32_t *neigh_u,
+    const std::int32_t *neigh_v,
+    std::int32_t n_u,
+    std::int32_t n_v) {
+    using cpu_t = dal::backend::cpu_dispatch_avx2;
+    if (is_galloping_intersection_preferable<cpu_t>(n_u, n_v)) {
+        return intersection_galloping(neigh_u, neigh_v, n_u, n_v);
+    }
+    std::int64_t total = 0;
+    std::int32_t i_u = 0, i_v = 0;
+#if defined(ONEDAL_INTERSECTION_AVX2)
+    total += intersection_blocks_avx2(neigh_u, neigh_v, n_u, n_v, i_u, i_v);
+#endif
+    return total + intersection_merge(neigh_u, neigh_v, n_u, n_v, i_u, i_v);
 }
 
 } // namespace oneapi::dal::preview::backend
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::backend::test {
+
+namespace bk = dal::backend;
+
+using cpu_types = std::tuple<bk::cpu_dispatch_sse2,
+                             bk::cpu_dispatch_avx2,
+                             bk::cpu_dispatch_avx512>;
+
+template <typename Cpu>
+class intersection_test {
+public:
+    /// Generates a sorted list of count distinct values from [0, max_value)
+    std::vector<std::int32_t> generate_list(std::int32_t count, std::int32_t max_value) {
+        std::uniform_int_distribution<std::int32_t> distribution(0, max_value - 1);
+        std::vector<std::int32_t> list;
+        while (std::int32_t(list.size()) < count) {
+            list.push_back(distribution(engine_));
+            if (std::int32_t(list.size()) == count) {
+                std::sort(list.begin(), list.end());
+                list.erase(std::unique(list.begin(), list.end()), list.end());
+            }
+        }
+        return list;
+    }
+
+    std::int64_t reference(const std::vector<std::int32_t>& u,
+                           const std::vector<std::int32_t>& v) {
+        std::vector<std::int32_t> common;
+        std::set_intersection(u.begin(), u.end(), v.begin(), v.end(), std::back_inserter(common));
+        return common.size();
+    }
+
+    void check(const std::vector<std::int32_t>& u, const std::vector<std::int32_t>& v) {
+        const std::int64_t expected = reference(u, v);
+        const std::int32_t n_u = u.size();
+        const std::int32_t n_v = v.size();
+        CAPTURE(n_u, n_v);
+        REQUIRE(intersection<Cpu>(u.data(), v.data(), n_u, n_v) == expected);
+        REQUIRE(intersection<Cpu>(v.data(), u.data(), n_v, n_u) == expected);
+        REQUIRE(intersection_galloping(u.data(), v.data(), n_u, n_v) == expected);
+
+        const std::vector<std::int64_t> u64(u.begin(), u.end());
+        const std::vector<std::int64_t> v64(v.begin(), v.end());
+        REQUIRE(intersection<Cpu>(u64.data(), v64.data(), std::int64_t(n_u), std::int64_t(n_v)) ==
+                expected);
+    }
+
+private:
+    std::mt19937 engine_{ 7777 };
+};
+
+TEMPLATE_LIST_TEST_M(intersection_test,
+                     "intersection of random lists",
+                     "[intersection]",
+                     cpu_types) {
+    const std::int32_t n_u = GENERATE(1, 3, 4, 7, 8, 15, 16, 17, 31, 64, 100, 1000);
+    const std::int32_t n_v = GENERATE(1, 5, 8, 16, 33, 128, 1000, 5000, 40000);
+    const std::int32_t max_value = GENERATE(2, 10, 2000, 200000);
+
+    const auto u = this->generate_list(std::min(n_u, max_value), max_value);
+    const auto v = this->generate_list(std::min(n_v, max_value), max_value);
+    this->check(u, v);
+}
+
+TEMPLATE_LIST_TEST_M(intersection_test,
+                     "intersection of special lists",
+                     "[intersection]",
+                     cpu_types) {
+    std::vector<std::int32_t> empty;
+    std::vector<std::int32_t> low(100), high(100), all(200), even(1000), odd(1000);
+    for (std::int32_t i = 0; i < 100; ++i) {
+        low[i] = i;
+        high[i] = 100 + i;
+    }
+    for (std::int32_t i = 0; i < 200; ++i) {
+        all[i] = i;
+    }
+    for (std::int32_t i = 0; i < 1000; ++i) {
+        even[i] = 2 * i;
+        odd[i] = 2 * i + 1;
+    }
+
+    SECTION("empty lists") {
+        this->check(empty, empty);
+        this->check(empty, all);
+    }
+    SECTION("disjoint ranges") {
+        this->check(low, high);
+    }
+    SECTION("nested ranges") {
+        this->check(low, all);
+        this->check(high, all);
+        this->check(all, all);
+    }
+    SECTION("interleaved lists") {
+        this->check(even, odd);
+        this->check(even, all);
+        this->check(odd, std::vector<std::int32_t>{ 1, 1999 });
+    }
+}
+
+} // namespace oneapi::dal::preview::backend::test
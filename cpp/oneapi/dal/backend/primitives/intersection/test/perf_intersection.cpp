@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::backend::test {
+
+namespace bk = dal::backend;
+
+using cpu_types = std::tuple<bk::cpu_dispatch_sse2, bk::cpu_dispatch_avx2, bk::cpu_dispatch_avx512>;
+
+template <typename Cpu>
+class intersection_perf_test {
+public:
+    using list_t = std::vector<std::int32_t>;
+
+    /// Generates pair_count pairs of sorted lists of distinct values from [0, max_value)
+    /// with the lengths drawn from the power-law distribution with the given exponent
+    void generate_pairs(std::int64_t pair_count,
+                        std::int32_t min_degree,
+                        std::int32_t max_degree,
+                        double exponent,
+                        std::int32_t max_value) {
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        const double a = std::pow(double(min_degree), 1.0 - exponent);
+        const double b = std::pow(double(max_degree), 1.0 - exponent);
+        lists_u_.clear();
+        lists_v_.clear();
+        const auto draw_degree = [&]() {
+            return std::int32_t(std::pow(a + (b - a) * uniform(engine_), 1.0 / (1.0 - exponent)));
+        };
+        for (std::int64_t i = 0; i < pair_count; ++i) {
+            const std::int32_t n_u = draw_degree();
+            const std::int32_t n_v = draw_degree();
+            lists_u_.push_back(generate_list(n_u, max_value));
+            lists_v_.push_back(generate_list(n_v, max_value));
+        }
+    }
+
+    void generate_pairs(std::int64_t pair_count,
+                        std::int32_t n_u,
+                        std::int32_t n_v,
+                        std::int32_t max_value) {
+        lists_u_.clear();
+        lists_v_.clear();
+        for (std::int64_t i = 0; i < pair_count; ++i) {
+            lists_u_.push_back(generate_list(n_u, max_value));
+            lists_v_.push_back(generate_list(n_v, max_value));
+        }
+    }
+
+    void run(const std::string& distribution) {
+        const std::int64_t pair_count = lists_u_.size();
+        std::int64_t expected = 0;
+        for (std::int64_t i = 0; i < pair_count; ++i) {
+            std::int32_t i_u = 0, i_v = 0;
+            expected += intersection_merge(lists_u_[i].data(),
+                                           lists_v_[i].data(),
+                                           std::int32_t(lists_u_[i].size()),
+                                           std::int32_t(lists_v_[i].size()),
+                                           i_u,
+                                           i_v);
+        }
+        REQUIRE(intersect_all() == expected);
+
+        const auto name = fmt::format("Intersection: cpu {}, {}, pair_count {}",
+                                      cpu_name(),
+                                      distribution,
+                                      pair_count);
+        BENCHMARK(name.c_str()) {
+            return intersect_all();
+        };
+    }
+
+private:
+    list_t generate_list(std::int32_t count, std::int32_t max_value) {
+        count = std::min(count, max_value);
+        std::uniform_int_distribution<std::int32_t> distribution(0, max_value - 1);
+        list_t list;
+        while (std::int32_t(list.size()) < count) {
+            list.push_back(distribution(engine_));
+            if (std::int32_t(list.size()) == count) {
+                std::sort(list.begin(), list.end());
+                list.erase(std::unique(list.begin(), list.end()), list.end());
+            }
+        }
+        return list;
+    }
+
+    std::int64_t intersect_all() const {
+        std::int64_t total = 0;
+        for (std::size_t i = 0; i < lists_u_.size(); ++i) {
+            total += intersection<Cpu>(lists_u_[i].data(),
+                                       lists_v_[i].data(),
+                                       std::int32_t(lists_u_[i].size()),
+                                       std::int32_t(lists_v_[i].size()));
+        }
+        return total;
+    }
+
+    static const char* cpu_name() {
+        if constexpr (std::is_same_v<Cpu, bk::cpu_dispatch_avx512>) {
+            return "avx512";
+        }
+        else if constexpr (std::is_same_v<Cpu, bk::cpu_dispatch_avx2>) {
+            return "avx2";
+        }
+        return "sse2";
+    }
+
+    std::mt19937 engine_{ 7777 };
+    std::vector<list_t> lists_u_;
+    std::vector<list_t> lists_v_;
+};
+
+TEMPLATE_LIST_TEST_M(intersection_perf_test,
+                     "benchmark for intersection of lists of equal length",
+                     "[intersection][perf]",
+                     cpu_types) {
+    const std::int32_t degree = GENERATE(16, 64, 256, 1024);
+    this->generate_pairs(4096, degree, degree, 1 << 16);
+    this->run(fmt::format("degrees {} x {}", degree, degree));
+}
+
+TEMPLATE_LIST_TEST_M(intersection_perf_test,
+                     "benchmark for intersection of lists of skewed length",
+                     "[intersection][perf]",
+                     cpu_types) {
+    const std::int32_t ratio = GENERATE(4, 16, 32, 64, 256);
+    this->generate_pairs(1024, 32, 32 * ratio, 1 << 20);
+    this->run(fmt::format("degrees {} x {}", 32, 32 * ratio));
+}
+
+TEMPLATE_LIST_TEST_M(intersection_perf_test,
+                     "benchmark for intersection of lists with power-law lengths",
+                     "[intersection][perf]",
+                     cpu_types) {
+    const double exponent = GENERATE(2.0, 2.5);
+    this->generate_pairs(8192, 4, 1 << 14, exponent, 1 << 20);
+    this->run(fmt::format("power-law degrees with exponent {}", exponent));
+}
+
+} // namespace oneapi::dal::preview::backend::test
@@ -187,6 +187,9 @@ inline constexpr std::int64_t get_data_type_size(data_type t) {
     else if (t == data_type::float64) {
         return sizeof(double);
     }
+    else if (t == data_type::bfloat16) {
+        return sizeof(std::uint16_t);
+    }
     else {
         throw unimplemented{ dal::detail::error_messages::unsupported_data_type() };
     }
@@ -40,6 +40,7 @@ MSG(unsupported_data_type, "Requested data type is not supported")
 MSG(unsupported_device_type, "Requested device type is not supported")
 MSG(small_data_block, "Data block size is smaller than expected")
 MSG(invalid_data_block_size, "Invalid data block size")
+MSG(max_thread_count_lt_zero, "Max thread count is lower than zero")
 MSG(method_not_implemented, "Method is not implemented")
 MSG(unsupported_feature_type, "Feature type is not supported")
 MSG(unknown_memcpy_error, "Unknown error during memory copying")
@@ -105,7 +106,18 @@ MSG(negative_vertex_id, "Negative vertex ID")
 MSG(unimplemented_sorting_procedure, "Unimplemented sorting procedure")
 
 /* IO */
+MSG(chunk_row_count_leq_zero, "Chunk row count is lower than or equal to zero")
+MSG(csv_stream_contains_non_numeric_values,
+    "Streaming read supports only CSV files with numeric values")
+MSG(file_mapping_failed, "Failed to map file into memory")
 MSG(file_not_found, "File not found")
+MSG(file_write_failed, "Failed to write file")
+MSG(graph_snapshot_is_corrupted, "Graph snapshot is corrupted")
+MSG(graph_snapshot_type_does_not_match_graph_type,
+    "Vertex, edge or edge value types of the graph snapshot do not match the graph type")
+MSG(graph_snapshot_version_is_not_supported, "Graph snapshot version is not supported")
+MSG(prefetch_count_leq_zero, "Prefetch count is lower than or equal to zero")
+MSG(row_cc_neq_first_row_cc, "Number of columns in the row does not match the first row of the file")
 
 /* Serialization */
 MSG(object_is_not_serializable, "Object is not serializable")
@@ -133,6 +145,12 @@ MSG(iteration_count_lt_zero, "Iteration count is lower than zero")
 MSG(max_iteration_count_leq_zero, "Max iteration count lower than or equal to zero")
 MSG(max_iteration_count_lt_zero, "Max iteration count lower than zero")
 
+/* Breadth First Search */
+MSG(empty_source_list, "Source vertex list is empty")
+MSG(levels_are_uninitialized, "Levels are not set as an optional result")
+MSG(parents_are_uninitialized, "Parents are not set as an optional result")
+MSG(source_count_gt_max_source_count, "Number of source vertices is greater than 64")
+
 /* K-Means */
 MSG(cluster_count_leq_zero, "Cluster count is lower than or equal to zero")
 MSG(cluster_count_exceeds_data_row_count, "Cluster count exceeds data row count")
@@ -148,6 +166,8 @@ MSG(input_model_centroids_cc_neq_input_data_cc,
     "Input model centroids column count is not equal to input data column count")
 MSG(input_model_centroids_rc_neq_desc_cluster_count,
     "Input model centroids row count is not equal to descriptor cluster count")
+MSG(kmeans_elkan_dense_method_is_not_implemented_for_gpu,
+    "K-Means Elkan dense method is not implemented for GPU")
 MSG(kmeans_init_parallel_plus_dense_method_is_not_implemented_for_gpu,
     "K-Means init++ parallel dense method is not implemented for GPU")
 MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu,
@@ -157,11 +177,38 @@ MSG(objective_function_value_lt_zero, "Objective function value is lower than ze
 /* k-NN */
 MSG(knn_kd_tree_method_is_not_implemented_for_gpu,
     "k-NN k-d tree method is not implemented for GPU")
+MSG(knn_hnsw_method_is_not_implemented_for_gpu, "k-NN HNSW method is not implemented for GPU")
 MSG(knn_search_task_is_not_implemented_for_gpu, "k-NN search task is not implemented for GPU")
+MSG(knn_radius_search_task_is_not_implemented_for_gpu,
+    "k-NN radius search task is not implemented for GPU")
 MSG(neighbor_count_lt_one, "Neighbor count lower than one")
+MSG(max_degree_leq_one, "Max degree is lower than or equal to one")
+MSG(construction_breadth_lt_one, "Construction breadth is lower than one")
+MSG(search_breadth_lt_one, "Search breadth is lower than one")
+MSG(radius_lt_zero, "Radius is lower than zero")
+MSG(rerank_factor_lt_one, "Rerank factor is lower than one")
+MSG(max_delta_row_count_lt_zero, "Max delta row count is lower than zero")
 MSG(unknown_distance_type,
     "Custom distances for k-NN is not supported, use one of the predefined distances instead.")
 MSG(distance_is_not_supported_for_gpu, "Only Euclidean distances for k-NN is supported for GPU")
+MSG(distance_is_not_supported_for_hnsw,
+    "Only Euclidean distance for k-NN is supported by the HNSW method")
+MSG(distance_is_not_supported_for_radius_search,
+    "Only Euclidean distance for k-NN is supported by the radius search task")
+MSG(distance_is_not_supported_for_compression,
+    "Only Euclidean distance for k-NN is supported with the compressed training data")
+MSG(distance_is_not_supported_for_incremental_training,
+    "Only Euclidean distance for k-NN is supported when the training data is appended "
+    "to the model")
+MSG(knn_incremental_training_is_not_supported_by_method,
+    "Appending the training data to the k-NN model is supported by the brute-force and "
+    "k-d tree methods without compression only")
+MSG(knn_incremental_training_is_not_implemented_for_gpu,
+    "Appending the training data to the k-NN model is not implemented for GPU")
+MSG(input_model_does_not_match_method,
+    "Input model is trained with another method than the one of the descriptor")
+MSG(input_data_cc_neq_input_model_data_cc,
+    "Input data column count is not equal to the column count of the model data")
 
 /* Minkowski distance */
 MSG(invalid_minkowski_degree, "Minkowski degree should be greater than zero")
@@ -173,6 +220,8 @@ MSG(interval_gt_vertex_count, "Interval is greater than vertex count")
 MSG(negative_interval, "Negative interval")
 MSG(row_begin_gt_row_end, "Row begin is greater than row end")
 MSG(range_idx_gt_max_int32, "Range indexes are greater than max of int32")
+MSG(top_k_lt_zero, "Top-k parameter is lower than zero")
+MSG(top_k_is_not_supported_by_method, "Top-k parameter is supported by the two_hop method only")
 
 /* Subgraph Isomorphism */
 MSG(max_match_count_lt_zero, "Maximum number of match count less that zero")
@@ -180,7 +229,6 @@ MSG(empty_target_graph, "Empty target graph")
 MSG(empty_pattern_graph, "Empty pattern graph")
 MSG(subgraph_isomorphism_is_not_implemented_for_labeled_edges,
     "Subgraph isomorphism is not implemented for labeled edges")
-MSG(non_zero_max_match_count_is_not_supported, "Non-zero max_match_count is not supported")
 MSG(incorrect_index_is_returned, "Internal error: incorrect index is returned")
 MSG(invalid_vertex_edge_attributes, "Internal error: invalid vertex/edge attributes")
 
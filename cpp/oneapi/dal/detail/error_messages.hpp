@@ -66,6 +66,7 @@ public:
     MSG(feature_index_is_out_of_range);
     MSG(incompatible_array_reinterpret_cast_types);
     MSG(invalid_data_block_size);
+    MSG(max_thread_count_lt_zero);
     MSG(method_not_implemented);
     MSG(only_homogen_table_is_supported);
     MSG(overflow_found_in_multiplication_of_two_values);
@@ -129,7 +130,16 @@ public:
     MSG(unimplemented_sorting_procedure);
 
     /* I/O */
+    MSG(chunk_row_count_leq_zero);
+    MSG(csv_stream_contains_non_numeric_values);
+    MSG(file_mapping_failed);
     MSG(file_not_found);
+    MSG(file_write_failed);
+    MSG(graph_snapshot_is_corrupted);
+    MSG(graph_snapshot_type_does_not_match_graph_type);
+    MSG(graph_snapshot_version_is_not_supported);
+    MSG(prefetch_count_leq_zero);
+    MSG(row_cc_neq_first_row_cc);
 
     /* Serialization */
     MSG(object_is_not_serializable);
@@ -150,6 +160,12 @@ public:
     MSG(max_iteration_count_leq_zero);
     MSG(max_iteration_count_lt_zero);
 
+    /* Breadth First Search */
+    MSG(empty_source_list);
+    MSG(levels_are_uninitialized);
+    MSG(parents_are_uninitialized);
+    MSG(source_count_gt_max_source_count);
+
     /* Decision Forest */
     MSG(bootstrap_is_incompatible_with_error_metric);
     MSG(bootstrap_is_incompatible_with_variable_importance_mode);
@@ -167,6 +183,8 @@ public:
     MSG(negative_interval);
     MSG(row_begin_gt_row_end);
     MSG(range_idx_gt_max_int32);
+    MSG(top_k_lt_zero);
+    MSG(top_k_is_not_supported_by_method);
 
     /* Subgraph Isomorphism */
     MSG(unsupported_kind);
@@ -174,7 +192,6 @@ public:
     MSG(empty_target_graph);
     MSG(empty_pattern_graph);
     MSG(subgraph_isomorphism_is_not_implemented_for_labeled_edges);
-    MSG(non_zero_max_match_count_is_not_supported);
     MSG(incorrect_index_is_returned);
     MSG(invalid_vertex_edge_attributes);
 
@@ -189,16 +206,33 @@ public:
     MSG(input_model_centroids_are_empty);
     MSG(input_model_centroids_cc_neq_input_data_cc);
     MSG(input_model_centroids_rc_neq_desc_cluster_count);
+    MSG(kmeans_elkan_dense_method_is_not_implemented_for_gpu);
     MSG(kmeans_init_parallel_plus_dense_method_is_not_implemented_for_gpu);
     MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu);
     MSG(objective_function_value_lt_zero);
 
     /* k-NN */
     MSG(knn_kd_tree_method_is_not_implemented_for_gpu);
+    MSG(knn_hnsw_method_is_not_implemented_for_gpu);
     MSG(knn_search_task_is_not_implemented_for_gpu);
+    MSG(knn_radius_search_task_is_not_implemented_for_gpu);
     MSG(neighbor_count_lt_one);
+    MSG(max_degree_leq_one);
+    MSG(construction_breadth_lt_one);
+    MSG(search_breadth_lt_one);
+    MSG(radius_lt_zero);
+    MSG(rerank_factor_lt_one);
+    MSG(max_delta_row_count_lt_zero);
     MSG(unknown_distance_type);
     MSG(distance_is_not_supported_for_gpu);
+    MSG(distance_is_not_supported_for_hnsw);
+    MSG(distance_is_not_supported_for_radius_search);
+    MSG(distance_is_not_supported_for_compression);
+    MSG(distance_is_not_supported_for_incremental_training);
+    MSG(knn_incremental_training_is_not_supported_by_method);
+    MSG(knn_incremental_training_is_not_implemented_for_gpu);
+    MSG(input_model_does_not_match_method);
+    MSG(input_data_cc_neq_input_model_data_cc);
 
     /* Linear and RBF Kernels */
     MSG(input_x_cc_neq_y_cc);
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+class mapped_file_impl {
+public:
+    explicit mapped_file_impl(const std::string& name) {
+#if defined(_WIN32) || defined(_WIN64)
+        file_ = CreateFileA(name.c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                            nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            throw invalid_argument(error_messages::file_not_found());
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size)) {
+            release();
+            throw invalid_argument(error_messages::file_not_found());
+        }
+        size_ = static_cast<std::int64_t>(size.QuadPart);
+        if (size_ == 0) {
+            return;
+        }
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr) {
+            release();
+            throw internal_error(error_messages::file_mapping_failed());
+        }
+        data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr) {
+            release();
+            throw internal_error(error_messages::file_mapping_failed());
+        }
+#else
+        file_ = open(name.c_str(), O_RDONLY);
+        if (file_ < 0) {
+            throw invalid_argument(error_messages::file_not_found());
+        }
+        struct stat file_stat;
+        if (fstat(file_, &file_stat) != 0) {
+            release();
+            throw invalid_argument(error_messages::file_not_found());
+        }
+        size_ = static_cast<std::int64_t>(file_stat.st_size);
+        if (size_ == 0) {
+            return;
+        }
+        void* data = mmap(nullptr, static_cast<size_t>(size_), PROT_READ, MAP_PRIVATE, file_, 0);
+        if (data == MAP_FAILED) {
+            release();
+            throw internal_error(error_messages::file_mapping_failed());
+        }
+        data_ = static_cast<const char*>(data);
+        // The file is consumed front to back by several threads at once,
+        // let the kernel read ahead aggressively
+        madvise(data, static_cast<size_t>(size_), MADV_SEQUENTIAL);
+#endif
+    }
+
+    mapped_file_impl(const mapped_file_impl&) = delete;
+    mapped_file_impl& operator=(const mapped_file_impl&) = delete;
+
+    ~mapped_file_impl() {
+        release();
+    }
+
+    const char* get_data() const {
+        return data_;
+    }
+
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+private:
+    void release() {
+#if defined(_WIN32) || defined(_WIN64)
+        if (data_ != nullptr) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if (data_ != nullptr) {
+            munmap(const_cast<char*>(data_), static_cast<size_t>(size_));
+        }
+        if (file_ >= 0) {
+            close(file_);
+        }
+        file_ = -1;
+#endif
+        data_ = nullptr;
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int file_ = -1;
+#endif
+    const char* data_ = nullptr;
+    std::int64_t size_ = 0;
+};
+
+mapped_file::mapped_file(const std::string& name) : impl_(new mapped_file_impl(name)) {}
+
+const char* mapped_file::get_data() const {
+    return impl_->get_data();
+}
+
+std::int64_t mapped_file::get_size() const {
+    return impl_->get_size();
+}
+
+} // namespace v1
+} // namespace oneapi::dal::detail
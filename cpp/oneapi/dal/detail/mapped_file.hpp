@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/common.hpp"
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+class mapped_file_impl;
+
+/// Read-only memory mapping of the whole file. The mapping is released when
+/// the last copy of the object is destroyed.
+class ONEDAL_EXPORT mapped_file : public base {
+public:
+    explicit mapped_file(const std::string& name);
+
+    const char* get_data() const;
+
+    std::int64_t get_size() const;
+
+private:
+    pimpl<mapped_file_impl> impl_;
+};
+
+} // namespace v1
+
+using v1::mapped_file;
+
+} // namespace oneapi::dal::detail
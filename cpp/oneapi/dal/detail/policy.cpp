@@ -16,6 +16,7 @@
 
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
 
 namespace oneapi::dal::detail {
 namespace v1 {
@@ -23,6 +24,8 @@ namespace v1 {
 class host_policy_impl : public base {
 public:
     cpu_extension cpu_extensions_mask = backend::detect_top_cpu_extension();
+    std::int64_t max_thread_count = 0;
+    std::int32_t numa_node_id = -1;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -35,6 +38,25 @@ cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+void host_policy::set_max_thread_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw invalid_argument(error_messages::max_thread_count_lt_zero());
+    }
+    impl_->max_thread_count = value;
+}
+
+std::int64_t host_policy::get_max_thread_count() const noexcept {
+    return impl_->max_thread_count;
+}
+
+void host_policy::set_numa_node_id_impl(std::int32_t value) noexcept {
+    impl_->numa_node_id = value;
+}
+
+std::int32_t host_policy::get_numa_node_id() const noexcept {
+    return impl_->numa_node_id;
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
     this->impl_ = nullptr; // reserved for future use
@@ -57,8 +57,31 @@ public:
         return *this;
     }
 
+    /// The maximal number of threads used by the computations called with
+    /// the policy. The computations run in a dedicated task arena, so concurrent
+    /// calls with different policies do not oversubscribe each other.
+    /// @remark default = 0, which means all the threads available to the caller
+    std::int64_t get_max_thread_count() const noexcept;
+
+    auto& set_max_thread_count(std::int64_t value) {
+        set_max_thread_count_impl(value);
+        return *this;
+    }
+
+    /// The NUMA node the threads of the computations are bound to.
+    /// Binding requires the TBB library built with NUMA support.
+    /// @remark default = -1, which means no binding
+    std::int32_t get_numa_node_id() const noexcept;
+
+    auto& set_numa_node_id(std::int32_t value) {
+        set_numa_node_id_impl(value);
+        return *this;
+    }
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_max_thread_count_impl(std::int64_t value);
+    void set_numa_node_id_impl(std::int32_t value) noexcept;
 
     pimpl<host_policy_impl> impl_;
 };
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
@@ -29,6 +31,8 @@ namespace oneapi::dal::preview {
 typedef void (*functype)(std::int32_t i, const void *a);
 typedef void (*functype_int64)(std::int64_t i, const void *a);
 typedef void (*functype_int32ptr)(const std::int32_t *i, const void *a);
+typedef void (*functype_arena)(const void *a);
+typedef void (*functype_blocked)(std::int32_t begin, std::int32_t size, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
 
@@ -54,11 +58,28 @@ ONEDAL_EXPORT int _onedal_threader_get_max_threads();
 
 ONEDAL_EXPORT int _onedal_threader_get_current_thread_index();
 
+ONEDAL_EXPORT void _onedal_threader_execute_in_arena(std::int32_t max_concurrency,
+                                                     std::int32_t numa_node_id,
+                                                     const void *a,
+                                                     oneapi::dal::preview::functype_arena func);
+
 ONEDAL_EXPORT void _onedal_threader_for(std::int32_t n,
                                         std::int32_t threads_request,
                                         const void *a,
                                         oneapi::dal::preview::functype func);
 
+ONEDAL_EXPORT void _onedal_threader_for_grain(std::int32_t n,
+                                              std::int32_t threads_request,
+                                              std::int32_t grain_size,
+                                              const void *a,
+                                              oneapi::dal::preview::functype func);
+
+ONEDAL_EXPORT void _onedal_threader_for_blocked(std::int32_t n,
+                                                std::int32_t threads_request,
+                                                std::int32_t grain_size,
+                                                const void *a,
+                                                oneapi::dal::preview::functype_blocked func);
+
 ONEDAL_EXPORT void _onedal_threader_for_int64(std::int64_t n,
                                               const void *a,
                                               oneapi::dal::preview::functype_int64 func);
@@ -129,6 +150,18 @@ inline void threader_func(std::int32_t i, const void *a) {
     lambda(i);
 }
 
+template <typename F>
+inline void threader_func_blocked(std::int32_t begin, std::int32_t size, const void *a) {
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(begin, begin + size);
+}
+
+template <typename F>
+inline void threader_func_arena(const void *a) {
+    const F &lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
 template <typename F>
 inline void threader_func_int64(std::int64_t i, const void *a) {
     const F &lambda = *static_cast<const F *>(a);
@@ -141,6 +174,9 @@ inline void threader_func_int32ptr(const std::int32_t *i, const void *a) {
     lambda(i);
 }
 
+/// Calls the lambda for each index in [0, n) using at most `threads_request`
+/// threads, non-positive `threads_request` means no limit. The partitioning of
+/// the loop does not depend on `threads_request`.
 template <typename F>
 inline ONEDAL_EXPORT void threader_for(std::int32_t n,
                                        std::int32_t threads_request,
@@ -150,6 +186,45 @@ inline ONEDAL_EXPORT void threader_for(std::int32_t n,
     _onedal_threader_for(n, threads_request, a, threader_func<F>);
 }
 
+/// Calls the lambda for each index in [0, n) using at most `threads_request`
+/// threads, non-positive `threads_request` means no limit. Indices are split into
+/// the blocks of at most `grain_size` iterations or into `threads_request` equal
+/// blocks if there would be more blocks than threads. Loops of at most `grain_size`
+/// iterations run in the calling thread without spawning tasks.
+template <typename F>
+inline ONEDAL_EXPORT void threader_for(std::int32_t n,
+                                       std::int32_t threads_request,
+                                       std::int32_t grain_size,
+                                       const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _onedal_threader_for_grain(n, threads_request, grain_size, a, threader_func<F>);
+}
+
+/// Calls the lambda for the blocks [begin, end) that cover [0, n), with the same
+/// thread and grain size limits as the overload of :expr:`threader_for` above.
+template <typename F>
+inline ONEDAL_EXPORT void threader_for_blocked(std::int32_t n,
+                                               std::int32_t threads_request,
+                                               std::int32_t grain_size,
+                                               const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _onedal_threader_for_blocked(n, threads_request, grain_size, a, threader_func_blocked<F>);
+}
+
+/// Runs the lambda in a dedicated task arena, so all the parallel loops inside
+/// use at most `max_concurrency` threads. Zero `max_concurrency` means no limit,
+/// negative `numa_node_id` means no binding to the NUMA node.
+template <typename F>
+inline ONEDAL_EXPORT void threader_execute_in_arena(std::int32_t max_concurrency,
+                                                    std::int32_t numa_node_id,
+                                                    const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _onedal_threader_execute_in_arena(max_concurrency, numa_node_id, a, threader_func_arena<F>);
+}
+
 template <typename F>
 inline ONEDAL_EXPORT void threader_for_int64(std::int64_t n, const F &lambda) {
     const void *a = static_cast<const void *>(&lambda);
@@ -233,6 +308,65 @@ inline Value parallel_reduce_int32_int64_t_simple(int32_t n,
                                                       parallel_reduce_reduction_int64<Reduction>);
 }
 
+/// Splits the range [0, n) that may not fit std::int32_t into the blocks of the equal
+/// size, so the number of the blocks fits std::int32_t, and reduces over the blocks
+/// with the given 32-bit reduction. The blocks are single indices if n fits std::int32_t
+template <typename Value, typename Func, typename Reduction, typename Reduce32>
+inline Value parallel_reduce_int64_int64_t_blocked(std::int64_t n,
+                                                   Value init,
+                                                   const Func &func,
+                                                   const Reduction &reduction,
+                                                   const Reduce32 &reduce32) {
+    const std::int64_t max_block_count = limits<std::int32_t>::max();
+    const std::int64_t block_size = (n + max_block_count - 1) / max_block_count;
+    if (block_size <= 1) {
+        return reduce32(static_cast<std::int32_t>(n), init, func, reduction);
+    }
+    const std::int64_t block_count = (n + block_size - 1) / block_size;
+    const auto block_func = [&](std::int32_t begin_block,
+                                std::int32_t end_block,
+                                Value value) -> Value {
+        const std::int64_t begin = begin_block * block_size;
+        const std::int64_t end = std::min<std::int64_t>(end_block * block_size, n);
+        return func(begin, end, value);
+    };
+    return reduce32(static_cast<std::int32_t>(block_count), init, block_func, reduction);
+}
+
+/// The counterpart of parallel_reduce_int32_int64_t for the ranges that may not fit
+/// std::int32_t
+template <typename Value, typename Func, typename Reduction>
+inline Value parallel_reduce_int64_int64_t(std::int64_t n,
+                                           Value init,
+                                           const Func &func,
+                                           const Reduction &reduction) {
+    return parallel_reduce_int64_int64_t_blocked(
+        n,
+        init,
+        func,
+        reduction,
+        [](std::int32_t count, Value value, const auto &loop, const auto &reduce) {
+            return parallel_reduce_int32_int64_t(count, value, loop, reduce);
+        });
+}
+
+/// The counterpart of parallel_reduce_int32_int64_t_simple for the ranges that may not
+/// fit std::int32_t
+template <typename Value, typename Func, typename Reduction>
+inline Value parallel_reduce_int64_int64_t_simple(std::int64_t n,
+                                                  Value init,
+                                                  const Func &func,
+                                                  const Reduction &reduction) {
+    return parallel_reduce_int64_int64_t_blocked(
+        n,
+        init,
+        func,
+        reduction,
+        [](std::int32_t count, Value value, const auto &loop, const auto &reduce) {
+            return parallel_reduce_int32_int64_t_simple(count, value, loop, reduce);
+        });
+}
+
 template <typename Value, typename Func, typename Reduction>
 inline Value parallel_reduce_int32ptr_int64_t_simple(const std::int32_t *begin,
                                                      const std::int32_t *end,
@@ -295,6 +429,111 @@ inline std::int64_t atomic_load(std::int64_t &value) {
 #endif
 }
 
+/// Reads the value that can be concurrently modified by atomic operations.
+/// The type shall be 4 or 8 bytes long
+template <typename T>
+inline T atomic_load_relaxed(const T &value) {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported size of atomic type");
+#if defined(_WIN32) || defined(_WIN64)
+    const T result = *static_cast<const volatile T *>(&value);
+    _ReadWriteBarrier();
+    return result;
+#else
+    T result;
+    __atomic_load(&value, &result, __ATOMIC_RELAXED);
+    return result;
+#endif
+}
+
+/// Writes the value that can be concurrently read by atomic operations.
+/// The type shall be 4 or 8 bytes long
+template <typename T>
+inline void atomic_store_relaxed(T &value, T desired) {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported size of atomic type");
+#if defined(_WIN32) || defined(_WIN64)
+    _ReadWriteBarrier();
+    *static_cast<volatile T *>(&value) = desired;
+#else
+    __atomic_store(&value, &desired, __ATOMIC_RELAXED);
+#endif
+}
+
+/// Replaces the value with `desired` if it is bitwise equal to `expected`.
+/// Otherwise, loads the actual value to `expected`. The type shall be 4 or 8 bytes long
+template <typename T>
+inline bool atomic_compare_exchange(T &value, T &expected, T desired) {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported size of atomic type");
+#if defined(_WIN32) || defined(_WIN64)
+    if constexpr (sizeof(T) == 4) {
+        long expected_bits, desired_bits;
+        std::memcpy(&expected_bits, &expected, sizeof(T));
+        std::memcpy(&desired_bits, &desired, sizeof(T));
+        const long previous_bits =
+            _InterlockedCompareExchange(reinterpret_cast<volatile long *>(&value),
+                                        desired_bits,
+                                        expected_bits);
+        if (previous_bits == expected_bits) {
+            return true;
+        }
+        std::memcpy(&expected, &previous_bits, sizeof(T));
+        return false;
+    }
+    else {
+        __int64 expected_bits, desired_bits;
+        std::memcpy(&expected_bits, &expected, sizeof(T));
+        std::memcpy(&desired_bits, &desired, sizeof(T));
+        const __int64 previous_bits =
+            _InterlockedCompareExchange64(reinterpret_cast<volatile __int64 *>(&value),
+                                          desired_bits,
+                                          expected_bits);
+        if (previous_bits == expected_bits) {
+            return true;
+        }
+        std::memcpy(&expected, &previous_bits, sizeof(T));
+        return false;
+    }
+#else
+    return __atomic_compare_exchange(&value,
+                                     &expected,
+                                     &desired,
+                                     false,
+                                     __ATOMIC_SEQ_CST,
+                                     __ATOMIC_SEQ_CST);
+#endif
+}
+
+/// Sets the value to `candidate` if `candidate` is less than the value.
+/// Returns true if the value is updated
+template <typename T>
+inline bool atomic_min(T &value, T candidate) {
+    T current = atomic_load_relaxed(value);
+    while (candidate < current) {
+        if (atomic_compare_exchange(value, current, candidate)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Adds `delta` to the integral value. Returns the value before the addition
+template <typename T>
+inline T atomic_fetch_add(T &value, T delta) {
+    T current = atomic_load_relaxed(value);
+    while (!atomic_compare_exchange(value, current, static_cast<T>(current + delta))) {
+    }
+    return current;
+}
+
+/// Sets the `bits` in the integral value. Returns the value before the update
+template <typename T>
+inline T atomic_fetch_or(T &value, T bits) {
+    T current = atomic_load_relaxed(value);
+    while ((current | bits) != current &&
+           !atomic_compare_exchange(value, current, static_cast<T>(current | bits))) {
+    }
+    return current;
+}
+
 template <typename lambdaType>
 inline void *tls_func(const void *a) {
     const lambdaType &lambda = *static_cast<const lambdaType *>(a);
@@ -0,0 +1,285 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include <immintrin.h>
+
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
+#include "oneapi/dal/graph/detail/csr_topology.hpp"
+
+// The vector decoder is selected by the instruction set the translation unit is built for
+#if defined(__SSSE3__)
+#define ONEDAL_COMPRESSED_TOPOLOGY_SSSE3
+#endif
+
+namespace oneapi::dal::preview::backend {
+
+using dal::preview::detail::compressed_block_size;
+using dal::preview::detail::compressed_data_padding;
+using dal::preview::detail::compressed_skip_entry_size;
+
+/// The tables of the vector Stream VByte decoder indexed by the control byte: the
+/// shuffle that moves the encoded values to the 32-bit lanes and the encoded size
+struct stream_vbyte_tables {
+    std::uint8_t shuffle[256][16] = {};
+    std::uint8_t size[256] = {};
+};
+
+constexpr stream_vbyte_tables make_stream_vbyte_tables() {
+    stream_vbyte_tables tables;
+    for (std::int32_t control = 0; control < 256; ++control) {
+        std::uint8_t offset = 0;
+        for (std::int32_t lane = 0; lane < 4; ++lane) {
+            const std::int32_t size = ((control >> (2 * lane)) & 0x3) + 1;
+            for (std::int32_t byte = 0; byte < 4; ++byte) {
+                tables.shuffle[control][4 * lane + byte] =
+                    byte < size ? static_cast<std::uint8_t>(offset + byte) : 0x80;
+            }
+            offset += size;
+        }
+        tables.size[control] = offset;
+    }
+    return tables;
+}
+
+inline constexpr stream_vbyte_tables stream_vbyte = make_stream_vbyte_tables();
+
+/// Returns the number of the bytes the neighbors are encoded with
+template <typename Cpu>
+std::int64_t get_encoded_list_size(const std::int32_t* neighbors, std::int64_t count) {
+    const std::int64_t block_count = (count + compressed_block_size - 1) / compressed_block_size;
+    std::int64_t size = block_count > 0 ? (block_count - 1) * compressed_skip_entry_size : 0;
+    std::uint32_t previous = 0;
+    for (std::int64_t i = 0; i < count; ++i) {
+        if (i % compressed_block_size == 0) {
+            size += (std::min(compressed_block_size, count - i) + 3) / 4;
+        }
+        const std::uint32_t value = static_cast<std::uint32_t>(neighbors[i]);
+        size += dal::preview::detail::get_encoded_value_size(value - previous);
+        previous = value;
+    }
+    return size;
+}
+
+/// Encodes the sorted neighbors to the list of get_encoded_list_size bytes
+template <typename Cpu>
+void encode_list(const std::int32_t* neighbors, std::int64_t count, std::uint8_t* list) {
+    const std::int64_t block_count = (count + compressed_block_size - 1) / compressed_block_size;
+    std::uint8_t* skip_index = list;
+    std::uint8_t* block = list + std::max<std::int64_t>(block_count - 1, 0) *
+                                     compressed_skip_entry_size;
+    std::uint32_t previous = 0;
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        const std::int64_t first = b * compressed_block_size;
+        const std::int64_t block_length = std::min(compressed_block_size, count - first);
+        if (b > 0) {
+            const std::uint32_t block_offset = static_cast<std::uint32_t>(block - list);
+            std::uint8_t* entry = skip_index + (b - 1) * compressed_skip_entry_size;
+            std::memcpy(entry, &previous, 4);
+            std::memcpy(entry + 4, &block_offset, 4);
+        }
+
+        std::uint8_t* control = block;
+        std::uint8_t* data = block + (block_length + 3) / 4;
+        std::fill(control, data, std::uint8_t(0));
+        for (std::int64_t i = 0; i < block_length; ++i) {
+            const std::uint32_t value = static_cast<std::uint32_t>(neighbors[first + i]);
+            const std::uint32_t delta = value - previous;
+            const std::int32_t size = dal::preview::detail::get_encoded_value_size(delta);
+            control[i / 4] |= static_cast<std::uint8_t>((size - 1) << (2 * (i % 4)));
+            std::memcpy(data, &delta, size);
+            data += size;
+            previous = value;
+        }
+        block = data;
+    }
+}
+
+/// Decodes the block of count neighbors encoded with the differences from base.
+/// The decoding stops after the group of four neighbors or the neighbor that is not
+/// less than max_value. Returns the number of the decoded neighbors
+template <typename Cpu>
+inline std::int64_t decode_block(
+    const std::uint8_t* block,
+    std::int64_t count,
+    std::int32_t base,
+    std::int32_t* neighbors,
+    std::int32_t max_value = dal::detail::limits<std::int32_t>::max()) {
+    const std::uint8_t* control = block;
+    const std::uint8_t* data = block + (count + 3) / 4;
+    std::int64_t i = 0;
+    std::uint32_t value = static_cast<std::uint32_t>(base);
+#if defined(ONEDAL_COMPRESSED_TOPOLOGY_SSSE3)
+    __m128i previous = _mm_set1_epi32(base);
+    for (; i + 4 <= count; i += 4) {
+        const std::uint8_t c = control[i / 4];
+        const __m128i shuffle =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(stream_vbyte.shuffle[c]));
+        __m128i deltas = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        deltas = _mm_shuffle_epi8(deltas, shuffle);
+        data += stream_vbyte.size[c];
+
+        // Prefix sum of the four differences added to the last decoded neighbor
+        deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 4));
+        deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 8));
+        const __m128i values = _mm_add_epi32(deltas, previous);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(neighbors + i), values);
+        previous = _mm_shuffle_epi32(values, 0xFF);
+        if (neighbors[i + 3] >= max_value) {
+            return i + 4;
+        }
+    }
+    if (i > 0) {
+        value = static_cast<std::uint32_t>(neighbors[i - 1]);
+    }
+#endif
+    for (; i < count; ++i) {
+        const std::int32_t size = ((control[i / 4] >> (2 * (i % 4))) & 0x3) + 1;
+        value += dal::preview::detail::load_encoded_value(data, size);
+        data += size;
+        neighbors[i] = static_cast<std::int32_t>(value);
+        if (neighbors[i] >= max_value) {
+            return i + 1;
+        }
+    }
+    return count;
+}
+
+/// Decodes the neighbor list of the vertex to the buffer of its degree size
+template <typename Cpu>
+inline void decode_neighbors(const dal::preview::detail::compressed_topology<std::int32_t>& t,
+                             std::int32_t vertex,
+                             std::int32_t* neighbors) {
+    const std::int64_t block_count = t.get_block_count(vertex);
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        const auto block = t.get_block(vertex, b);
+        decode_block<Cpu>(block.data,
+                          block.count,
+                          block.base,
+                          neighbors + b * compressed_block_size);
+    }
+}
+
+/// Counts the common neighbors of the sorted list and the compressed neighbor list of
+/// the vertex. The skip index is used to decode only the blocks overlapping the range
+/// of the remaining part of the sorted list, and the blocks are decoded up to its last
+/// value. The buffer holds compressed_block_size values
+template <typename Cpu>
+inline std::int64_t intersection_compressed(
+    const std::int32_t* neighbors,
+    std::int64_t count,
+    const dal::preview::detail::compressed_topology<std::int32_t>& t,
+    std::int32_t vertex,
+    std::int32_t* buffer) {
+    std::int64_t total = 0;
+    const std::int32_t* begin = neighbors;
+    const std::int32_t* end = neighbors + count;
+    const std::int64_t block_count = t.get_block_count(vertex);
+    for (std::int64_t b = 0; b < block_count && begin != end; ++b) {
+        const std::int32_t base = t.get_block_base(vertex, b);
+        begin = std::lower_bound(begin, end, base);
+        if (begin == end) {
+            break;
+        }
+        // The last neighbor of the block is the base of the next one
+        if (b + 1 < block_count && *begin > t.get_block_base(vertex, b + 1)) {
+            continue;
+        }
+        const auto block = t.get_block(vertex, b);
+        const std::int64_t decoded_count =
+            decode_block<Cpu>(block.data, block.count, block.base, buffer, end[-1]);
+        total += intersection<Cpu>(begin,
+                                   buffer,
+                                   static_cast<std::int32_t>(end - begin),
+                                   static_cast<std::int32_t>(decoded_count));
+    }
+    return total;
+}
+
+/// Compresses the neighbor lists of the topology. The lists are encoded in parallel
+/// after their sizes are computed and the offsets are found with the prefix sum
+template <typename Cpu>
+dal::preview::detail::compressed_topology<std::int32_t> compress_topology(
+    const dal::preview::detail::topology<std::int32_t>& t) {
+    const std::int64_t vertex_count = t.get_vertex_count();
+    auto offsets = array<std::int64_t>::empty(vertex_count + 1);
+    auto degrees = array<std::int32_t>::empty(std::max<std::int64_t>(vertex_count, 1));
+    std::int64_t* offsets_ptr = offsets.get_mutable_data();
+    std::int32_t* degrees_ptr = degrees.get_mutable_data();
+
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+        const std::int64_t degree = t._rows_ptr[u + 1] - t._rows_ptr[u];
+        degrees_ptr[u] = static_cast<std::int32_t>(degree);
+        offsets_ptr[u + 1] = get_encoded_list_size<Cpu>(t.get_vertex_neighbors_begin(u), degree);
+    });
+
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t block_count =
+        std::max<std::int64_t>(1, std::min<std::int64_t>(vertex_count, 4 * thread_count));
+    const std::int64_t block_size = (vertex_count + block_count - 1) / block_count;
+    auto block_sums = array<std::int64_t>::zeros(block_count + 1);
+    auto block_max_degrees = array<std::int64_t>::zeros(block_count);
+    std::int64_t* block_sums_ptr = block_sums.get_mutable_data();
+    std::int64_t* block_max_degrees_ptr = block_max_degrees.get_mutable_data();
+
+    offsets_ptr[0] = 0;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t end = std::min(vertex_count, (b + 1) * block_size);
+        for (std::int64_t u = b * block_size; u < end; ++u) {
+            block_sums_ptr[b + 1] += offsets_ptr[u + 1];
+            block_max_degrees_ptr[b] =
+                std::max<std::int64_t>(block_max_degrees_ptr[b], degrees_ptr[u]);
+        }
+    });
+    std::int64_t max_degree = 0;
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        block_sums_ptr[b + 1] += block_sums_ptr[b];
+        max_degree = std::max(max_degree, block_max_degrees_ptr[b]);
+    }
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t end = std::min(vertex_count, (b + 1) * block_size);
+        std::int64_t offset = block_sums_ptr[b];
+        for (std::int64_t u = b * block_size; u < end; ++u) {
+            offset += offsets_ptr[u + 1];
+            offsets_ptr[u + 1] = offset;
+        }
+    });
+
+    const std::int64_t data_size = offsets_ptr[vertex_count];
+    auto data = array<std::uint8_t>::zeros(data_size + compressed_data_padding);
+    std::uint8_t* data_ptr = data.get_mutable_data();
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+        encode_list<Cpu>(t.get_vertex_neighbors_begin(u),
+                         degrees_ptr[u],
+                         data_ptr + offsets_ptr[u]);
+    });
+
+    return dal::preview::detail::compressed_topology<std::int32_t>(vertex_count,
+                                                                   t.get_edge_count(),
+                                                                   max_degree,
+                                                                   offsets,
+                                                                   degrees,
+                                                                   data);
+}
+
+} // namespace oneapi::dal::preview::backend
@@ -0,0 +1,24 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/graph/backend/cpu/compressed_topology_kernel.hpp"
+
+namespace oneapi::dal::preview::backend {
+
+template dal::preview::detail::compressed_topology<std::int32_t> compress_topology<__CPU_TAG__>(
+    const dal::preview::detail::topology<std::int32_t>& t);
+
+} // namespace oneapi::dal::preview::backend
@@ -0,0 +1,281 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/graph/detail/csr_topology.hpp"
+
+namespace oneapi::dal::preview::backend {
+
+/// The number of the consecutive vertices summed up by a task of the prefix sum
+constexpr std::int64_t prefix_sum_block_size = 1 << 20;
+
+/// Sorts the vertex identifiers by non-increasing degree
+template <typename Cpu>
+void sort_ids_by_degree(const std::int32_t* degrees,
+                        std::pair<std::int32_t, std::size_t>* degree_id_pairs,
+                        std::int64_t vertex_count) {
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t n) {
+        degree_id_pairs[n] = std::make_pair(degrees[n], (size_t)n);
+    });
+    dal::detail::parallel_sort(degree_id_pairs, degree_id_pairs + vertex_count);
+    dal::detail::threader_for(vertex_count / 2, vertex_count / 2, [&](std::int64_t i) {
+        std::swap(degree_id_pairs[i], degree_id_pairs[vertex_count - i - 1]);
+    });
+}
+
+/// Computes the exclusive prefix sum of the degrees in the blocks of block_size vertices
+template <typename Cpu>
+void parallel_prefix_sum(const std::int32_t* degrees_relabel,
+                         std::int64_t* offsets,
+                         std::int64_t* part_prefix,
+                         std::int64_t* local_sums,
+                         std::int64_t block_size,
+                         std::int64_t num_blocks,
+                         std::int64_t vertex_count) {
+    dal::detail::threader_for(num_blocks, num_blocks, [&](std::int64_t block) {
+        std::int64_t local_sum = 0;
+        std::int64_t block_end = std::min((block + 1) * block_size, vertex_count);
+        PRAGMA_VECTOR_ALWAYS
+        for (std::int64_t i = block * block_size; i < block_end; i++) {
+            local_sum += degrees_relabel[i];
+        }
+        local_sums[block] = local_sum;
+    });
+
+    std::int64_t total = 0;
+    PRAGMA_VECTOR_ALWAYS
+    for (std::int64_t block = 0; block < num_blocks; block++) {
+        part_prefix[block] = total;
+        total += local_sums[block];
+    }
+    part_prefix[num_blocks] = total;
+
+    dal::detail::threader_for(num_blocks, num_blocks, [&](std::int64_t block) {
+        std::int64_t local_total = part_prefix[block];
+        std::int64_t block_end = std::min((block + 1) * block_size, vertex_count);
+        for (std::int64_t i = block * block_size; i < block_end; i++) {
+            offsets[i] = local_total;
+            local_total += degrees_relabel[i];
+        }
+    });
+
+    offsets[vertex_count] = part_prefix[num_blocks];
+}
+
+/// Fills the CSR arrays of the topology with the vertices renamed to new_ids.
+/// The offsets are used as the write positions and are advanced to the row ends
+template <typename Cpu>
+void fill_relabeled_topology(const dal::preview::detail::topology<std::int32_t>& t,
+                             std::int32_t* vertex_neighbors_relabel,
+                             std::int64_t* edge_offsets_relabel,
+                             std::int64_t* offsets,
+                             const std::int32_t* new_ids) {
+    const auto vertex_count = t.get_vertex_count();
+    dal::detail::threader_for(vertex_count + 1, vertex_count + 1, [&](std::int64_t n) {
+        edge_offsets_relabel[n] = offsets[n];
+    });
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t u) {
+        for (const std::int32_t* v = t.get_vertex_neighbors_begin(u);
+             v != t.get_vertex_neighbors_end(u);
+             ++v) {
+            vertex_neighbors_relabel[offsets[new_ids[u]]++] = new_ids[*v];
+        }
+
+        dal::detail::parallel_sort(vertex_neighbors_relabel + edge_offsets_relabel[new_ids[u]],
+                                   vertex_neighbors_relabel + edge_offsets_relabel[new_ids[u] + 1]);
+    });
+}
+
+/// Numbers the vertices by non-increasing degree
+template <typename Cpu>
+void order_by_degree(const dal::preview::detail::topology<std::int32_t>& t,
+                     std::int32_t* new_ids,
+                     detail::byte_alloc_iface* alloc_ptr) {
+    using pair_type = std::pair<std::int32_t, std::size_t>;
+    const std::int64_t vertex_count = t.get_vertex_count();
+    inner_alloc<pair_type> pair_allocator(alloc_ptr);
+    pair_type* degree_id_pairs = detail::allocate(pair_allocator, vertex_count);
+
+    sort_ids_by_degree<Cpu>(t._degrees_ptr, degree_id_pairs, vertex_count);
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t n) {
+        new_ids[degree_id_pairs[n].second] = n;
+    });
+
+    detail::deallocate(pair_allocator, degree_id_pairs, vertex_count);
+}
+
+/// Numbers the vertices in the breadth-first order. Each connected component is
+/// started from its unvisited vertex of the minimal degree and the unvisited neighbors
+/// of each vertex are queued by increasing degree. The numbering is reversed at the end
+template <typename Cpu>
+void order_by_reverse_cuthill_mckee(const dal::preview::detail::topology<std::int32_t>& t,
+                                    std::int32_t* new_ids,
+                                    detail::byte_alloc_iface* alloc_ptr) {
+    using pair_type = std::pair<std::int32_t, std::size_t>;
+    const std::int64_t vertex_count = t.get_vertex_count();
+    const std::int32_t* degrees = t._degrees_ptr;
+    inner_alloc<pair_type> pair_allocator(alloc_ptr);
+    inner_alloc<std::int32_t> vertex_allocator(alloc_ptr);
+    pair_type* degree_id_pairs = detail::allocate(pair_allocator, vertex_count);
+    std::int32_t* queue = detail::allocate(vertex_allocator, vertex_count);
+
+    sort_ids_by_degree<Cpu>(degrees, degree_id_pairs, vertex_count);
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t v) {
+        new_ids[v] = -1;
+    });
+
+    const auto by_degree = [&](std::int32_t u, std::int32_t v) {
+        return degrees[u] < degrees[v] || (degrees[u] == degrees[v] && u < v);
+    };
+
+    std::int64_t tail = 0;
+    for (std::int64_t i = vertex_count - 1; i >= 0; --i) {
+        const auto start = static_cast<std::int32_t>(degree_id_pairs[i].second);
+        if (new_ids[start] != -1) {
+            continue;
+        }
+        new_ids[start] = static_cast<std::int32_t>(tail);
+        queue[tail++] = start;
+        for (std::int64_t head = tail - 1; head < tail; ++head) {
+            const std::int32_t u = queue[head];
+            const std::int64_t level_begin = tail;
+            for (const std::int32_t* v = t.get_vertex_neighbors_begin(u);
+                 v != t.get_vertex_neighbors_end(u);
+                 ++v) {
+                if (new_ids[*v] == -1) {
+                    new_ids[*v] = 0;
+                    queue[tail++] = *v;
+                }
+            }
+            std::sort(queue + level_begin, queue + tail, by_degree);
+            for (std::int64_t j = level_begin; j < tail; ++j) {
+                new_ids[queue[j]] = static_cast<std::int32_t>(j);
+            }
+        }
+    }
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t v) {
+        new_ids[v] = static_cast<std::int32_t>(vertex_count - 1 - new_ids[v]);
+    });
+
+    detail::deallocate(vertex_allocator, queue, vertex_count);
+    detail::deallocate(pair_allocator, degree_id_pairs, vertex_count);
+}
+
+/// Moves the vertices of the degree above the average one to the beginning keeping
+/// the relative order within the hubs and within the rest of the vertices, so the
+/// frequently accessed vertices share the cache lines. The hubs are counted in the
+/// blocks of consecutive vertices and the new identifiers are assigned per block
+template <typename Cpu>
+void order_by_hub_clustering(const dal::preview::detail::topology<std::int32_t>& t,
+                             std::int32_t* new_ids,
+                             detail::byte_alloc_iface* alloc_ptr) {
+    const std::int64_t vertex_count = t.get_vertex_count();
+    const std::int32_t* degrees = t._degrees_ptr;
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t block_count = std::min<std::int64_t>(vertex_count, 4 * thread_count);
+    const std::int64_t block_size = (vertex_count + block_count - 1) / block_count;
+    inner_alloc<std::int64_t> offset_allocator(alloc_ptr);
+    std::int64_t* hub_offsets = detail::allocate(offset_allocator, block_count + 1);
+
+    // The vertex is a hub if degree > rows[V] / V, the comparison avoids the division
+    const std::int64_t degree_sum = t._rows_ptr[vertex_count];
+    const auto is_hub = [&](std::int64_t v) {
+        return degrees[v] * vertex_count > degree_sum;
+    };
+
+    hub_offsets[0] = 0;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t end = std::min(vertex_count, (b + 1) * block_size);
+        std::int64_t hub_count = 0;
+        for (std::int64_t v = b * block_size; v < end; ++v) {
+            hub_count += is_hub(v);
+        }
+        hub_offsets[b + 1] = hub_count;
+    });
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        hub_offsets[b + 1] += hub_offsets[b];
+    }
+    const std::int64_t total_hub_count = hub_offsets[block_count];
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t end = std::min(vertex_count, (b + 1) * block_size);
+        std::int64_t hub_id = hub_offsets[b];
+        std::int64_t other_id = total_hub_count + b * block_size - hub_offsets[b];
+        for (std::int64_t v = b * block_size; v < end; ++v) {
+            new_ids[v] = static_cast<std::int32_t>(is_hub(v) ? hub_id++ : other_id++);
+        }
+    });
+
+    detail::deallocate(offset_allocator, hub_offsets, block_count + 1);
+}
+
+/// Computes the new identifiers of the vertices for the ordering and fills the CSR
+/// arrays of the topology permuted with them. The neighbors of each vertex are sorted
+template <typename Cpu>
+void reorder_topology(const dal::preview::detail::topology<std::int32_t>& t,
+                      vertex_ordering ordering,
+                      std::int32_t* new_ids,
+                      std::int64_t* rows,
+                      std::int32_t* cols,
+                      std::int32_t* degrees,
+                      detail::byte_alloc_iface* alloc_ptr) {
+    const std::int64_t vertex_count = t.get_vertex_count();
+    switch (ordering) {
+        case vertex_ordering::degree: order_by_degree<Cpu>(t, new_ids, alloc_ptr); break;
+        case vertex_ordering::reverse_cuthill_mckee:
+            order_by_reverse_cuthill_mckee<Cpu>(t, new_ids, alloc_ptr);
+            break;
+        case vertex_ordering::hub_clustering:
+            order_by_hub_clustering<Cpu>(t, new_ids, alloc_ptr);
+            break;
+    }
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t v) {
+        degrees[new_ids[v]] = t._degrees_ptr[v];
+    });
+
+    inner_alloc<std::int64_t> offset_allocator(alloc_ptr);
+    const std::int64_t num_blocks =
+        (vertex_count + prefix_sum_block_size - 1) / prefix_sum_block_size;
+    std::int64_t* offsets = detail::allocate(offset_allocator, vertex_count + 1);
+    std::int64_t* local_sums = detail::allocate(offset_allocator, num_blocks);
+    std::int64_t* part_prefix = detail::allocate(offset_allocator, num_blocks + 1);
+
+    parallel_prefix_sum<Cpu>(degrees,
+                             offsets,
+                             part_prefix,
+                             local_sums,
+                             prefix_sum_block_size,
+                             num_blocks,
+                             vertex_count);
+    fill_relabeled_topology<Cpu>(t, cols, rows, offsets, new_ids);
+
+    detail::deallocate(offset_allocator, part_prefix, num_blocks + 1);
+    detail::deallocate(offset_allocator, local_sums, num_blocks);
+    detail::deallocate(offset_allocator, offsets, vertex_count + 1);
+}
+
+} // namespace oneapi::dal::preview::backend
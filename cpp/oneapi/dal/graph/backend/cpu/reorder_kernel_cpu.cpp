@@ -0,0 +1,30 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/graph/backend/cpu/reorder_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::preview::backend {
+
+template void reorder_topology<__CPU_TAG__>(const dal::preview::detail::topology<std::int32_t>& t,
+                                            vertex_ordering ordering,
+                                            std::int32_t* new_ids,
+                                            std::int64_t* rows,
+                                            std::int32_t* cols,
+                                            std::int32_t* degrees,
+                                            detail::byte_alloc_iface* alloc_ptr);
+
+} // namespace oneapi::dal::preview::backend
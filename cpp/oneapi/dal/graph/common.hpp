@@ -146,4 +146,17 @@ using graph_allocator = typename graph_traits<Graph>::allocator_type;
 template <typename Graph>
 constexpr bool is_directed = false;
 
+/// Orderings of the graph vertices computed by reorder_vertices
+enum class vertex_ordering {
+    /// The vertices are sorted by non-increasing degree
+    degree,
+    /// The reverse Cuthill-McKee ordering: the vertices are numbered in the breadth-first
+    /// order from the vertices of the minimal degree, neighbors are visited by increasing
+    /// degree, and the numbering is reversed. It reduces the bandwidth of the adjacency matrix
+    reverse_cuthill_mckee,
+    /// The vertices of the degree above the average degree are moved to the beginning,
+    /// the relative order of the vertices within both groups is preserved
+    hub_clustering
+};
+
 } // namespace oneapi::dal::preview
@@ -0,0 +1,264 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstring>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/common.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/graph/detail/common.hpp"
+#include "oneapi/dal/graph/detail/csr_topology.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+/// The number of the neighbors encoded in a block of a compressed neighbor list
+constexpr std::int64_t compressed_block_size = 64;
+
+/// The size of an entry of the skip index in bytes: the base of the block followed by
+/// the offset of the block from the beginning of the neighbor list
+constexpr std::int64_t compressed_skip_entry_size = 8;
+
+/// The number of the bytes after the encoded lists, so the decoders can load 16 bytes
+/// starting from any encoded value
+constexpr std::int64_t compressed_data_padding = 16;
+
+/// Returns the number of the bytes the value is encoded with
+inline std::int32_t get_encoded_value_size(std::uint32_t value) {
+    return 1 + (value > 0xFFu) + (value > 0xFFFFu) + (value > 0xFFFFFFu);
+}
+
+/// Loads the value encoded with the given number of the bytes. Reads 4 bytes
+inline std::uint32_t load_encoded_value(const std::uint8_t* data, std::int32_t size) {
+    std::uint32_t value;
+    std::memcpy(&value, data, 4);
+    return value & (0xFFFFFFFFu >> (32 - 8 * size));
+}
+
+/// Decodes the block of count neighbors encoded with the differences from base.
+/// Returns the pointer to the end of the block
+inline const std::uint8_t* decode_block_scalar(const std::uint8_t* block,
+                                               std::int64_t count,
+                                               std::int32_t base,
+                                               std::int32_t* neighbors) {
+    const std::uint8_t* control = block;
+    const std::uint8_t* data = block + (count + 3) / 4;
+    std::uint32_t value = static_cast<std::uint32_t>(base);
+    for (std::int64_t i = 0; i < count; ++i) {
+        const std::int32_t size = ((control[i / 4] >> (2 * (i % 4))) & 0x3) + 1;
+        value += load_encoded_value(data, size);
+        data += size;
+        neighbors[i] = static_cast<std::int32_t>(value);
+    }
+    return data;
+}
+
+/// The block of a compressed neighbor list
+struct compressed_block {
+    /// The encoded block
+    const std::uint8_t* data;
+    /// The number of the neighbors in the block
+    std::int64_t count;
+    /// The neighbors are encoded as the differences from the base and each other
+    std::int32_t base;
+};
+
+/// The topology of an undirected graph with the sorted neighbor lists stored compressed.
+/// Each list is split into the blocks of compressed_block_size neighbors. The neighbors
+/// of a block are encoded as the differences from the previous ones with Stream VByte:
+/// the 2-bit sizes of the four consecutive values are packed into a control byte, the
+/// control bytes are followed by the 1 to 4 lower bytes of the values. The list starts
+/// with the skip index that stores the base and the offset of each block after the
+/// first one, the base of a block is the last neighbor of the previous block.
+template <typename IndexType>
+class compressed_topology {
+public:
+    static_assert(is_valid_index_v<IndexType>, "Use int32_t for vertex index type");
+
+    using vertex_type = IndexType;
+
+    class neighbor_iterator;
+    using const_vertex_edge_range = range<neighbor_iterator>;
+
+    compressed_topology() = default;
+
+    compressed_topology(std::int64_t vertex_count,
+                        std::int64_t edge_count,
+                        std::int64_t max_degree,
+                        const array<std::int64_t>& offsets,
+                        const array<vertex_type>& degrees,
+                        const array<std::uint8_t>& data)
+            : _offsets(offsets),
+              _degrees(degrees),
+              _data(data),
+              _vertex_count(vertex_count),
+              _edge_count(edge_count),
+              _max_degree(max_degree) {
+        _offsets_ptr = _offsets.get_data();
+        _degrees_ptr = _degrees.get_data();
+        _data_ptr = _data.get_data();
+    }
+
+    ONEDAL_FORCEINLINE std::int64_t get_vertex_count() const {
+        return _vertex_count;
+    }
+
+    ONEDAL_FORCEINLINE std::int64_t get_edge_count() const {
+        return _edge_count;
+    }
+
+    /// The maximal degree of the vertices, the size of a buffer for a decoded list
+    ONEDAL_FORCEINLINE std::int64_t get_max_degree() const {
+        return _max_degree;
+    }
+
+    /// The number of the bytes used by the topology
+    std::int64_t get_byte_count() const {
+        return _offsets.get_count() * sizeof(std::int64_t) +
+               _degrees.get_count() * sizeof(vertex_type) + _data.get_count();
+    }
+
+    ONEDAL_FORCEINLINE vertex_type get_vertex_degree(vertex_type vertex) const noexcept {
+        return _degrees_ptr[vertex];
+    }
+
+    ONEDAL_FORCEINLINE std::int64_t get_block_count(vertex_type vertex) const noexcept {
+        return (_degrees_ptr[vertex] + compressed_block_size - 1) / compressed_block_size;
+    }
+
+    /// Returns the base of the block. It is not greater than the neighbors in the block
+    /// and not less than the neighbors in the previous blocks
+    ONEDAL_FORCEINLINE vertex_type get_block_base(vertex_type vertex,
+                                                  std::int64_t block) const noexcept {
+        if (block == 0) {
+            return 0;
+        }
+        vertex_type base;
+        std::memcpy(&base, get_skip_entry(vertex, block), sizeof(vertex_type));
+        return base;
+    }
+
+    ONEDAL_FORCEINLINE compressed_block get_block(vertex_type vertex,
+                                                  std::int64_t block) const noexcept {
+        const std::uint8_t* list = _data_ptr + _offsets_ptr[vertex];
+        std::uint32_t offset = (get_block_count(vertex) - 1) * compressed_skip_entry_size;
+        if (block > 0) {
+            std::memcpy(&offset, get_skip_entry(vertex, block) + sizeof(vertex_type), 4);
+        }
+        const std::int64_t count =
+            std::min(compressed_block_size, _degrees_ptr[vertex] - block * compressed_block_size);
+        return { list + offset, count, get_block_base(vertex, block) };
+    }
+
+    /// Decodes the neighbor list of the vertex to the buffer of its degree size
+    void decode_neighbors(vertex_type vertex, vertex_type* neighbors) const noexcept {
+        const std::int64_t block_count = get_block_count(vertex);
+        for (std::int64_t b = 0; b < block_count; ++b) {
+            const auto block = get_block(vertex, b);
+            decode_block_scalar(block.data,
+                                block.count,
+                                block.base,
+                                neighbors + b * compressed_block_size);
+        }
+    }
+
+    const_vertex_edge_range get_vertex_neighbors(vertex_type vertex) const {
+        return std::make_pair(neighbor_iterator(this, vertex), neighbor_iterator());
+    }
+
+    /// Input iterator over the neighbors of a vertex that decodes a block at a time
+    class neighbor_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = vertex_type;
+        using difference_type = std::int64_t;
+        using pointer = const vertex_type*;
+        using reference = const vertex_type&;
+
+        neighbor_iterator() = default;
+
+        neighbor_iterator(const compressed_topology* t, vertex_type vertex)
+                : _topology(t),
+                  _vertex(vertex),
+                  _remaining(t->get_vertex_degree(vertex)) {
+            decode_current_block();
+        }
+
+        reference operator*() const {
+            return _neighbors[_position];
+        }
+
+        neighbor_iterator& operator++() {
+            --_remaining;
+            if (++_position == compressed_block_size && _remaining > 0) {
+                ++_block;
+                decode_current_block();
+            }
+            return *this;
+        }
+
+        bool operator==(const neighbor_iterator& other) const {
+            return _remaining == other._remaining;
+        }
+
+        bool operator!=(const neighbor_iterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        void decode_current_block() {
+            _position = 0;
+            if (_remaining > 0) {
+                const auto block = _topology->get_block(_vertex, _block);
+                decode_block_scalar(block.data, block.count, block.base, _neighbors);
+            }
+        }
+
+        const compressed_topology* _topology = nullptr;
+        vertex_type _vertex = 0;
+        std::int64_t _remaining = 0;
+        std::int64_t _block = 0;
+        std::int64_t _position = 0;
+        vertex_type _neighbors[compressed_block_size];
+    };
+
+private:
+    ONEDAL_FORCEINLINE const std::uint8_t* get_skip_entry(vertex_type vertex,
+                                                          std::int64_t block) const noexcept {
+        return _data_ptr + _offsets_ptr[vertex] + (block - 1) * compressed_skip_entry_size;
+    }
+
+    array<std::int64_t> _offsets;
+    array<vertex_type> _degrees;
+    array<std::uint8_t> _data;
+
+    const std::int64_t* _offsets_ptr = nullptr;
+    const vertex_type* _degrees_ptr = nullptr;
+    const std::uint8_t* _data_ptr = nullptr;
+
+    std::int64_t _vertex_count = 0;
+    std::int64_t _edge_count = 0;
+    std::int64_t _max_degree = 0;
+};
+
+/// Builds the compressed topology from the topology with the sorted neighbor lists
+ONEDAL_EXPORT compressed_topology<std::int32_t> compress_topology(
+    const dal::detail::host_policy& policy,
+    const topology<std::int32_t>& t);
+
+} // namespace oneapi::dal::preview::detail
@@ -18,6 +18,7 @@
 
 namespace oneapi::dal::preview::detail {
 
-template class ONEDAL_EXPORT topology<int32_t>;
+template class ONEDAL_EXPORT topology<std::int32_t>;
+template class ONEDAL_EXPORT topology<std::int64_t>;
 
 } // namespace oneapi::dal::preview::detail
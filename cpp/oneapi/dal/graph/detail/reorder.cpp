@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/graph/detail/reorder.hpp"
+#include "oneapi/dal/graph/backend/cpu/reorder_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+void reorder_topology(const dal::detail::host_policy& policy,
+                      const topology<std::int32_t>& t,
+                      vertex_ordering ordering,
+                      std::int32_t* new_ids,
+                      std::int64_t* rows,
+                      std::int32_t* cols,
+                      std::int32_t* degrees,
+                      byte_alloc_iface* alloc_ptr) {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::reorder_topology<decltype(cpu)>(t,
+                                                        ordering,
+                                                        new_ids,
+                                                        rows,
+                                                        cols,
+                                                        degrees,
+                                                        alloc_ptr);
+    });
+}
+
+} // namespace oneapi::dal::preview::detail
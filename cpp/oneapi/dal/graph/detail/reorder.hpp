@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+ONEDAL_EXPORT void reorder_topology(const dal::detail::host_policy& policy,
+                                    const topology<std::int32_t>& t,
+                                    vertex_ordering ordering,
+                                    std::int32_t* new_ids,
+                                    std::int64_t* rows,
+                                    std::int32_t* cols,
+                                    std::int32_t* degrees,
+                                    byte_alloc_iface* alloc_ptr);
+
+template <typename Graph>
+table reorder_vertices_impl(const Graph& g, vertex_ordering ordering, Graph& reordered) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using allocator_type = typename graph_traits<Graph>::allocator_type;
+
+    const auto& t = dal::detail::get_impl(g).get_topology();
+    const std::int64_t vertex_count = t.get_vertex_count();
+    if (vertex_count == 0) {
+        return table{};
+    }
+    const std::int64_t neighbors_count = t._rows_ptr[vertex_count];
+
+    auto& reordered_impl = dal::detail::get_impl(reordered);
+    auto& vertex_allocator = reordered_impl._vertex_allocator;
+    auto& edge_allocator = reordered_impl._edge_allocator;
+
+    vertex_t* degrees = allocate(vertex_allocator, vertex_count);
+    edge_t* rows = allocate(edge_allocator, vertex_count + 1);
+    vertex_t* cols = allocate(vertex_allocator, neighbors_count);
+    auto new_ids = array<vertex_t>::empty(vertex_count);
+
+    alloc_connector<allocator_type> alloc_con(reordered_impl._allocator);
+    reorder_topology(dal::detail::host_policy::get_default(),
+                     t,
+                     ordering,
+                     new_ids.get_mutable_data(),
+                     rows,
+                     cols,
+                     degrees,
+                     &alloc_con);
+
+    reordered_impl.set_topology(vertex_count,
+                                t.get_edge_count(),
+                                rows,
+                                cols,
+                                neighbors_count,
+                                degrees);
+
+    if (neighbors_count < dal::detail::limits<std::int32_t>::max()) {
+        using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+        using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
+
+        auto& vertex_edge_allocator = reordered_impl._vertex_edge_allocator;
+        vertex_edge_t* rows_vertex = allocate(vertex_edge_allocator, vertex_count + 1);
+        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t u) {
+            rows_vertex[u] = static_cast<vertex_edge_t>(rows[u]);
+        });
+        reordered_impl.get_topology()._rows_vertex =
+            vertex_edge_set::wrap(rows_vertex, vertex_count + 1);
+    }
+
+    return dal::detail::homogen_table_builder{}.reset(new_ids, vertex_count, 1).build();
+}
+
+} // namespace oneapi::dal::preview::detail
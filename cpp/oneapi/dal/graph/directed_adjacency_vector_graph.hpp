@@ -35,7 +35,8 @@ namespace oneapi::dal::preview {
 /// @tparam VertexValue  Type of vertex properties
 /// @tparam EdgeValue    Type of edge properties
 /// @tparam GraphValue   Type of graph properties
-/// @tparam IndexType    Type of vertex indices
+/// @tparam IndexType    Type of vertex indices, std::int32_t or std::int64_t. The 64-bit
+///                      indices are needed for the graphs with 2^31 or more vertices
 /// @tparam Allocator    Type of the custom allocator (currently not supported)
 template <typename VertexValue = empty_value,
           typename EdgeValue = empty_value,
@@ -47,7 +48,8 @@ public:
     using graph_type =
         directed_adjacency_vector_graph<VertexValue, EdgeValue, GraphValue, IndexType, Allocator>;
 
-    static_assert(detail::is_valid_index_v<IndexType>, "Use int32_t for vertex index type");
+    static_assert(detail::is_valid_index_v<IndexType>,
+                  "Use int32_t or int64_t for vertex index type");
     static_assert(detail::is_valid_edge_value_v<EdgeValue>,
                   "Use empty_value, double or int32_t for edge value type");
 
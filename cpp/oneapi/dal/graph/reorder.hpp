@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the reordering of the graph vertices
+
+#pragma once
+
+#include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/graph/detail/reorder.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::preview {
+
+/// Class for the graph with the renumbered vertices and the permutation that maps
+/// the vertices of the original graph to the vertices of this one
+///
+/// @tparam Graph  Type of the graph
+template <typename Graph>
+class reordered_graph {
+public:
+    /// Constructs the reordered graph from the permuted graph and the permutation
+    reordered_graph(Graph&& graph, const table& permutation)
+            : graph_(std::move(graph)),
+              permutation_(permutation) {}
+
+    /// The graph with the renumbered vertices. The neighbors of each vertex are sorted
+    const Graph& get_graph() const {
+        return graph_;
+    }
+
+    /// The table of size [vertex_count x 1] with the identifier of each vertex of the
+    /// original graph in the reordered graph
+    const table& get_permutation() const {
+        return permutation_;
+    }
+
+private:
+    Graph graph_;
+    table permutation_;
+};
+
+/// Renumbers the vertices of the graph to improve the locality of the accesses to
+/// the graph and the per-vertex data of the algorithms run on the result. Only the
+/// topology is permuted, so the graph must have no vertex and edge values
+///
+/// @tparam Graph  Type of the graph
+/// @param [in]   g         Input graph object
+/// @param [in]   ordering  The ordering of the vertices
+///
+/// @return The reordered graph and the permutation of the vertices
+template <typename Graph>
+reordered_graph<Graph> reorder_vertices(const Graph& g, vertex_ordering ordering);
+
+//Functions implementation
+template <typename Graph>
+reordered_graph<Graph> reorder_vertices(const Graph& g, vertex_ordering ordering) {
+    static_assert(!is_directed<Graph>, "reorder_vertices requires graph undirectness");
+    static_assert(std::is_same_v<vertex_type<Graph>, std::int32_t>,
+                  "reorder_vertices requires int32 vertex identifiers");
+    static_assert(std::is_same_v<vertex_user_value_type<Graph>, empty_value> &&
+                      std::is_same_v<edge_user_value_type<Graph>, empty_value>,
+                  "reorder_vertices does not permute the vertex and edge values");
+    Graph reordered;
+    const table permutation = detail::reorder_vertices_impl(g, ordering, reordered);
+    return reordered_graph<Graph>(std::move(reordered), permutation);
+}
+
+} // namespace oneapi::dal::preview
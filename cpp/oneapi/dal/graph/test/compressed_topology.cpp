@@ -0,0 +1,215 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/graph/backend/cpu/compressed_topology_kernel.hpp"
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::graph::test {
+
+namespace bk = dal::backend;
+namespace pr = dal::preview;
+
+using cpu_types = std::tuple<bk::cpu_dispatch_sse2, bk::cpu_dispatch_avx2, bk::cpu_dispatch_avx512>;
+
+template <typename Cpu>
+class compressed_topology_test {
+public:
+    /// Generates the graph with the neighbors of each vertex drawn from the window of
+    /// the given width around it and a few hubs connected to the random vertices
+    void generate_graph(std::int64_t vertex_count,
+                        std::int64_t degree,
+                        std::int64_t window,
+                        std::int64_t hub_count) {
+        std::mt19937 generator(7777);
+        std::vector<std::set<std::int32_t>> neighbors(vertex_count);
+        const auto add_edge = [&](std::int64_t u, std::int64_t v) {
+            if (u != v) {
+                neighbors[u].insert(v);
+                neighbors[v].insert(u);
+            }
+        };
+        std::uniform_int_distribution<std::int64_t> offset(-window, window);
+        std::uniform_int_distribution<std::int64_t> vertex(0, vertex_count - 1);
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            for (std::int64_t i = 0; i < degree / 2; ++i) {
+                add_edge(u, std::clamp<std::int64_t>(u + offset(generator), 0, vertex_count - 1));
+            }
+        }
+        for (std::int64_t h = 0; h < hub_count; ++h) {
+            const std::int64_t hub = vertex(generator);
+            for (std::int64_t i = 0; i < vertex_count / 4; ++i) {
+                add_edge(hub, vertex(generator));
+            }
+        }
+
+        rows_.assign(1, 0);
+        cols_.clear();
+        degrees_.clear();
+        for (const auto& list : neighbors) {
+            cols_.insert(cols_.end(), list.begin(), list.end());
+            rows_.push_back(cols_.size());
+            degrees_.push_back(list.size());
+        }
+        topology_.set_topology(vertex_count,
+                               std::int64_t(cols_.size() / 2),
+                               static_cast<const std::int64_t*>(rows_.data()),
+                               static_cast<const std::int32_t*>(cols_.data()),
+                               std::int64_t(cols_.size()),
+                               static_cast<const std::int32_t*>(degrees_.data()));
+    }
+
+    /// Generates the graph of a single vertex connected to the given vertices
+    void generate_star(const std::vector<std::int32_t>& leaves) {
+        rows_ = { 0, std::int64_t(leaves.size()) };
+        cols_ = leaves;
+        degrees_ = { std::int32_t(leaves.size()) };
+        topology_.set_topology(1,
+                               std::int64_t(leaves.size()),
+                               static_cast<const std::int64_t*>(rows_.data()),
+                               static_cast<const std::int32_t*>(cols_.data()),
+                               std::int64_t(cols_.size()),
+                               static_cast<const std::int32_t*>(degrees_.data()));
+    }
+
+    std::int64_t get_raw_byte_count() const {
+        return rows_.size() * sizeof(std::int64_t) + cols_.size() * sizeof(std::int32_t) +
+               degrees_.size() * sizeof(std::int32_t);
+    }
+
+    std::vector<std::int32_t> get_neighbors(std::int32_t u) const {
+        return std::vector<std::int32_t>(cols_.begin() + rows_[u], cols_.begin() + rows_[u + 1]);
+    }
+
+    void check_round_trip(const pr::detail::compressed_topology<std::int32_t>& c) {
+        const std::int64_t vertex_count = topology_.get_vertex_count();
+        REQUIRE(c.get_vertex_count() == vertex_count);
+        REQUIRE(c.get_edge_count() == topology_.get_edge_count());
+        REQUIRE(c.get_max_degree() == *std::max_element(degrees_.begin(), degrees_.end()));
+
+        std::vector<std::int32_t> decoded(c.get_max_degree());
+        for (std::int32_t u = 0; u < vertex_count; ++u) {
+            const auto expected = get_neighbors(u);
+            REQUIRE(c.get_vertex_degree(u) == std::int32_t(expected.size()));
+
+            pr::backend::decode_neighbors<Cpu>(c, u, decoded.data());
+            REQUIRE(std::equal(expected.begin(), expected.end(), decoded.begin()));
+
+            c.decode_neighbors(u, decoded.data());
+            REQUIRE(std::equal(expected.begin(), expected.end(), decoded.begin()));
+
+            const auto [begin, end] = c.get_vertex_neighbors(u);
+            REQUIRE(std::vector<std::int32_t>(begin, end) == expected);
+        }
+    }
+
+    void check_intersections(const pr::detail::compressed_topology<std::int32_t>& c) {
+        std::mt19937 generator(777);
+        const std::int64_t vertex_count = topology_.get_vertex_count();
+        std::uniform_int_distribution<std::int32_t> vertex(0, vertex_count - 1);
+        std::int32_t block[pr::detail::compressed_block_size];
+        for (std::int64_t i = 0; i < 1000; ++i) {
+            const auto list_u = get_neighbors(vertex(generator));
+            const std::int32_t v = vertex(generator);
+            const auto list_v = get_neighbors(v);
+            std::vector<std::int32_t> common;
+            std::set_intersection(list_u.begin(),
+                                  list_u.end(),
+                                  list_v.begin(),
+                                  list_v.end(),
+                                  std::back_inserter(common));
+            REQUIRE(pr::backend::intersection_compressed<Cpu>(list_u.data(),
+                                                              list_u.size(),
+                                                              c,
+                                                              v,
+                                                              block) ==
+                    std::int64_t(common.size()));
+        }
+    }
+
+    const pr::detail::topology<std::int32_t>& get_topology() const {
+        return topology_;
+    }
+
+private:
+    std::vector<std::int64_t> rows_;
+    std::vector<std::int32_t> cols_;
+    std::vector<std::int32_t> degrees_;
+    pr::detail::topology<std::int32_t> topology_;
+};
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "Compressed topology decodes to the original lists",
+                     "[compressed_topology]",
+                     cpu_types) {
+    const std::int64_t vertex_count = GENERATE(10, 1000, 20000);
+    const std::int64_t degree = GENERATE(2, 16, 100);
+    const std::int64_t window = GENERATE(100, 100000);
+
+    this->generate_graph(vertex_count, degree, window, 4);
+    const auto c = pr::backend::compress_topology<TestType>(this->get_topology());
+    this->check_round_trip(c);
+    this->check_intersections(c);
+}
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "Compressed topology encodes differences of all sizes",
+                     "[compressed_topology]",
+                     cpu_types) {
+    std::vector<std::int32_t> leaves;
+    for (std::int64_t shift = 0; shift < 31; ++shift) {
+        leaves.push_back(std::int32_t((std::int64_t(1) << shift) + shift));
+    }
+    for (std::int32_t i = 1; i < 200; ++i) {
+        leaves.push_back(std::numeric_limits<std::int32_t>::max() - 200 + i);
+    }
+    std::sort(leaves.begin(), leaves.end());
+    leaves.erase(std::unique(leaves.begin(), leaves.end()), leaves.end());
+
+    this->generate_star(leaves);
+    const auto c = pr::backend::compress_topology<TestType>(this->get_topology());
+    std::vector<std::int32_t> decoded(leaves.size());
+    pr::backend::decode_neighbors<TestType>(c, 0, decoded.data());
+    REQUIRE(decoded == leaves);
+}
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "Compressed topology of the local graph is smaller",
+                     "[compressed_topology]",
+                     cpu_types) {
+    this->generate_graph(100000, 32, 1000, 0);
+    const auto c = pr::backend::compress_topology<TestType>(this->get_topology());
+    REQUIRE(c.get_byte_count() * 2 < this->get_raw_byte_count());
+}
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "Compressed topology of the empty graph",
+                     "[compressed_topology]",
+                     cpu_types) {
+    const auto c = pr::backend::compress_topology<TestType>(this->get_topology());
+    REQUIRE(c.get_vertex_count() == 0);
+    REQUIRE(c.get_max_degree() == 0);
+}
+
+} // namespace oneapi::dal::graph::test
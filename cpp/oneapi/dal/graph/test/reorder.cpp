@@ -0,0 +1,186 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/graph/reorder.hpp"
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+
+namespace oneapi::dal::graph::test {
+
+namespace te = dal::test::engine;
+
+using graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+using dal::preview::vertex_ordering;
+
+class reorder_test {
+public:
+    /// Builds the simple graph: the duplicate edges are merged, the neighbors are sorted
+    graph_t create_graph(std::int64_t vertex_count, const te::edge_list_t &edges) {
+        auto neighbors = te::make_adjacency(vertex_count, edges, false);
+        for (auto &list : neighbors) {
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+        }
+        return builder_.build<graph_t>(neighbors);
+    }
+
+    /// Checks that the permutation is a bijection and that the reordered graph has
+    /// exactly the edges of the original graph renamed by it. Returns the permutation
+    std::vector<std::int32_t> check_isomorphic(const graph_t &g,
+                                               const dal::preview::reordered_graph<graph_t> &r) {
+        const auto &reordered = r.get_graph();
+        const std::int64_t vertex_count = dal::preview::get_vertex_count(g);
+        REQUIRE(dal::preview::get_vertex_count(reordered) == vertex_count);
+        REQUIRE(dal::preview::get_edge_count(reordered) == dal::preview::get_edge_count(g));
+        if (vertex_count == 0) {
+            return {};
+        }
+
+        REQUIRE(r.get_permutation().get_row_count() == vertex_count);
+        REQUIRE(r.get_permutation().get_column_count() == 1);
+        const auto permutation_arr = row_accessor<const std::int32_t>(r.get_permutation()).pull();
+        std::vector<std::int32_t> permutation(permutation_arr.get_data(),
+                                              permutation_arr.get_data() + vertex_count);
+        std::vector<bool> is_used(vertex_count, false);
+        for (const std::int32_t new_id : permutation) {
+            REQUIRE(new_id >= 0);
+            REQUIRE(new_id < vertex_count);
+            REQUIRE_FALSE(is_used[new_id]);
+            is_used[new_id] = true;
+        }
+
+        const auto &t = oneapi::dal::detail::get_impl(reordered).get_topology();
+        for (std::int32_t u = 0; u < vertex_count; ++u) {
+            const auto [begin, end] = dal::preview::get_vertex_neighbors(g, u);
+            std::vector<std::int32_t> expected;
+            for (auto v = begin; v != end; ++v) {
+                expected.push_back(permutation[*v]);
+            }
+            std::sort(expected.begin(), expected.end());
+
+            const std::int32_t new_u = permutation[u];
+            const auto [new_begin, new_end] = dal::preview::get_vertex_neighbors(reordered, new_u);
+            REQUIRE(std::vector<std::int32_t>(new_begin, new_end) == expected);
+            REQUIRE(dal::preview::get_vertex_degree(reordered, new_u) == expected.size());
+        }
+        for (std::int64_t u = 0; u <= vertex_count; ++u) {
+            REQUIRE(t._rows_vertex[u] == t._rows_ptr[u]);
+        }
+        return permutation;
+    }
+
+    /// The largest difference between the identifiers of the adjacent vertices
+    std::int64_t get_bandwidth(const graph_t &g) {
+        std::int64_t bandwidth = 0;
+        for (std::int32_t u = 0; u < dal::preview::get_vertex_count(g); ++u) {
+            const auto [begin, end] = dal::preview::get_vertex_neighbors(g, u);
+            for (auto v = begin; v != end; ++v) {
+                bandwidth = std::max<std::int64_t>(bandwidth, std::abs(*v - u));
+            }
+        }
+        return bandwidth;
+    }
+
+private:
+    te::graph_builder builder_;
+};
+
+TEST_M(reorder_test, "Reordered graph is isomorphic to the original one", "[reorder]") {
+    const auto ordering = GENERATE(vertex_ordering::degree,
+                                   vertex_ordering::reverse_cuthill_mckee,
+                                   vertex_ordering::hub_clustering);
+    const std::int64_t vertex_count = GENERATE(1, 10, 1000, 10000);
+    const std::int64_t degree = GENERATE(0, 2, 16);
+
+    const auto g =
+        create_graph(vertex_count, te::generate_edges(vertex_count, vertex_count * degree / 2));
+    check_isomorphic(g, dal::preview::reorder_vertices(g, ordering));
+}
+
+TEST_M(reorder_test, "Degree ordering sorts vertices by degree", "[reorder]") {
+    const std::int64_t vertex_count = 1000;
+    const auto g = create_graph(vertex_count, te::generate_edges(vertex_count, vertex_count * 4));
+    const auto r = dal::preview::reorder_vertices(g, vertex_ordering::degree);
+    check_isomorphic(g, r);
+
+    for (std::int32_t u = 1; u < vertex_count; ++u) {
+        REQUIRE(dal::preview::get_vertex_degree(r.get_graph(), u - 1) >=
+                dal::preview::get_vertex_degree(r.get_graph(), u));
+    }
+}
+
+TEST_M(reorder_test, "Reverse Cuthill-McKee ordering restores banded paths", "[reorder]") {
+    // The paths through the shuffled vertices have the bandwidth 1 after the reordering
+    const std::int64_t vertex_count = 1000;
+    std::vector<std::int32_t> shuffled(vertex_count);
+    std::iota(shuffled.begin(), shuffled.end(), 0);
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(7777));
+
+    te::edge_list_t edges;
+    for (std::int64_t i = 1; i < vertex_count; ++i) {
+        if (i != vertex_count / 2) {
+            edges.emplace_back(shuffled[i - 1], shuffled[i]);
+        }
+    }
+    const auto g = create_graph(vertex_count, edges);
+    REQUIRE(get_bandwidth(g) > 1);
+
+    const auto r = dal::preview::reorder_vertices(g, vertex_ordering::reverse_cuthill_mckee);
+    check_isomorphic(g, r);
+    REQUIRE(get_bandwidth(r.get_graph()) == 1);
+}
+
+TEST_M(reorder_test, "Hub clustering moves hubs to the beginning in order", "[reorder]") {
+    const std::int64_t vertex_count = 10000;
+    const auto g = create_graph(vertex_count, te::generate_edges(vertex_count, vertex_count * 4));
+    const auto r = dal::preview::reorder_vertices(g, vertex_ordering::hub_clustering);
+    const auto permutation = check_isomorphic(g, r);
+
+    const std::int64_t degree_sum = 2 * dal::preview::get_edge_count(g);
+    std::vector<std::int32_t> expected_order;
+    for (const bool is_hub : { true, false }) {
+        for (std::int32_t u = 0; u < vertex_count; ++u) {
+            if ((dal::preview::get_vertex_degree(g, u) * vertex_count > degree_sum) == is_hub) {
+                expected_order.push_back(u);
+            }
+        }
+    }
+    for (std::int64_t i = 0; i < vertex_count; ++i) {
+        REQUIRE(permutation[expected_order[i]] == i);
+    }
+}
+
+TEST_M(reorder_test, "Reordering of the empty graph", "[reorder]") {
+    const auto ordering = GENERATE(vertex_ordering::degree,
+                                   vertex_ordering::reverse_cuthill_mckee,
+                                   vertex_ordering::hub_clustering);
+    const graph_t g;
+    const auto r = dal::preview::reorder_vertices(g, ordering);
+    REQUIRE(dal::preview::get_vertex_count(r.get_graph()) == 0);
+    REQUIRE(r.get_permutation().get_row_count() == 0);
+}
+
+} // namespace oneapi::dal::graph::test
@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/io/common.hpp"
+#include "oneapi/dal/io/detail/load_graph.hpp"
 
 namespace oneapi::dal::preview::load_graph::backend {
 
@@ -40,13 +43,7 @@ template <typename Cpu>
 std::int64_t compute_prefix_sum(const std::int32_t *degrees,
                                 std::int64_t degrees_count,
                                 std::int64_t *edge_offsets) {
-    std::int64_t total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return detail::compute_prefix_sum_impl(degrees, degrees_count, edge_offsets);
 }
 
 template <typename Cpu>
@@ -17,3 +17,4 @@
 #pragma once
 
 #include "oneapi/dal/io/csv/read.hpp"
+#include "oneapi/dal/io/csv/read_stream.hpp"
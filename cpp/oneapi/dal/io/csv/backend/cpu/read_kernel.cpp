@@ -27,17 +27,17 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/io/csv/backend/read_numeric_csv.hpp"
 #include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
 
 namespace oneapi::dal::csv::backend {
 
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
-                                         const detail::data_source_base& ds,
-                                         const read_args<table>& args) const {
+template <typename Float>
+static table read_with_daal(const detail::data_source_base& ds) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -52,8 +52,34 @@ table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
     daal_data_source.loadDataBlock();
     interop::status_to_exception(daal_data_source.status());
 
-    return oneapi::dal::backend::interop::convert_from_daal_homogen_table<DAAL_DATA_TYPE>(
+    return oneapi::dal::backend::interop::convert_from_daal_homogen_table<Float>(
         daal_data_source.getNumericTable());
 }
 
+template <typename Float>
+static table read_impl(const detail::data_source_base& ds) {
+    auto csv = read_numeric_csv<Float>(ds);
+
+    // Files with categorical features require the dictionary built by DAAL
+    if (!csv.is_numeric) {
+        return read_with_daal<Float>(ds);
+    }
+    if (csv.row_count == 0) {
+        return table{};
+    }
+    return dal::detail::homogen_table_builder{}
+        .reset(csv.data, csv.row_count, csv.column_count)
+        .build();
+}
+
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    if (args.get_data_type() == data_type::float64) {
+        return read_impl<double>(ds);
+    }
+    return read_impl<float>(ds);
+}
+
 } // namespace oneapi::dal::csv::backend
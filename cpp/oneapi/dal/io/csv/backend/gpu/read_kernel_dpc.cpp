@@ -28,6 +28,7 @@
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/detail/memory.hpp"
 #include "oneapi/dal/io/csv/backend/gpu/read_kernel.hpp"
+#include "oneapi/dal/io/csv/backend/read_numeric_csv.hpp"
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
 
@@ -36,12 +37,8 @@ namespace oneapi::dal::csv::backend {
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_gpu<table>::operator()(const dal::backend::context_gpu& ctx,
-                                         const detail::data_source_base& ds,
-                                         const read_args<table>& args) const {
-    auto& queue = ctx.get_queue();
-
+template <typename Float>
+static table read_with_daal(sycl::queue& queue, const detail::data_source_base& ds) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -58,23 +55,55 @@ table read_kernel_gpu<table>::operator()(const dal::backend::context_gpu& ctx,
 
     auto nt = daal_data_source.getNumericTable();
 
-    daal_dm::BlockDescriptor<DAAL_DATA_TYPE> block;
+    daal_dm::BlockDescriptor<Float> block;
     const std::int64_t row_count = nt->getNumberOfRows();
     const std::int64_t column_count = nt->getNumberOfColumns();
 
     interop::status_to_exception(nt->getBlockOfRows(0, row_count, daal_dm::readOnly, block));
-    DAAL_DATA_TYPE* data = block.getBlockPtr();
+    Float* data = block.getBlockPtr();
 
-    auto arr =
-        array<DAAL_DATA_TYPE>::empty(queue, row_count * column_count, sycl::usm::alloc::device);
+    auto arr = array<Float>::empty(queue, row_count * column_count, sycl::usm::alloc::device);
     dal::detail::memcpy(queue,
                         arr.get_mutable_data(),
                         data,
-                        sizeof(DAAL_DATA_TYPE) * row_count * column_count);
+                        sizeof(Float) * row_count * column_count);
 
     interop::status_to_exception(nt->releaseBlockOfRows(block));
 
     return dal::detail::homogen_table_builder{}.reset(arr, row_count, column_count).build();
 }
 
+template <typename Float>
+static table read_impl(sycl::queue& queue, const detail::data_source_base& ds) {
+    auto csv = read_numeric_csv<Float>(ds);
+
+    // Files with categorical features require the dictionary built by DAAL
+    if (!csv.is_numeric) {
+        return read_with_daal<Float>(queue, ds);
+    }
+    if (csv.row_count == 0) {
+        return table{};
+    }
+
+    const std::int64_t element_count = csv.row_count * csv.column_count;
+    auto arr = array<Float>::empty(queue, element_count, sycl::usm::alloc::device);
+    dal::detail::memcpy(queue,
+                        arr.get_mutable_data(),
+                        csv.data.get_data(),
+                        sizeof(Float) * element_count);
+
+    return dal::detail::homogen_table_builder{}.reset(arr, csv.row_count, csv.column_count).build();
+}
+
+template <>
+table read_kernel_gpu<table>::operator()(const dal::backend::context_gpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    auto& queue = ctx.get_queue();
+    if (args.get_data_type() == data_type::float64) {
+        return read_impl<double>(queue, ds);
+    }
+    return read_impl<float>(queue, ds);
+}
+
 } // namespace oneapi::dal::csv::backend
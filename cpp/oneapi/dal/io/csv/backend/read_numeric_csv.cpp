@@ -0,0 +1,409 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/csv/backend/read_numeric_csv.hpp"
+#include "oneapi/dal/io/detail/parse_digits.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+/// Minimal number of bytes of the file parsed by one task
+constexpr std::int64_t min_chunk_size = 1 << 20;
+
+/// Number of chunks the file is split into per available thread
+constexpr std::int64_t chunks_per_thread = 4;
+
+/// Minimal number of rows parsed by one task when the file is read by the cursor
+constexpr std::int64_t min_block_row_count = 1024;
+
+/// Maximal number of significant decimal digits that fit the 64-bit mantissa
+constexpr std::int64_t max_mantissa_digits = 19;
+
+/// Powers of ten which are exactly representable in double
+constexpr double exact_powers_of_ten[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                           1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                           1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+constexpr std::int64_t max_exact_power_of_ten = 22;
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline std::uint64_t get_digit(char c) {
+    return static_cast<unsigned char>(c - '0');
+}
+
+/// Accumulates decimal digits into the mantissa, returns the pointer past the last digit
+inline const char* parse_digits(const char* p,
+                                const char* end,
+                                std::uint64_t& mantissa,
+                                std::int64_t& digit_count) {
+    while (end - p >= 8 && digit_count + 8 <= max_mantissa_digits) {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if (!dal::detail::are_eight_digits(word)) {
+            break;
+        }
+        mantissa = mantissa * 100000000ull + dal::detail::parse_eight_digits(word);
+        digit_count += (mantissa != 0) ? 8 : 0;
+        p += 8;
+    }
+    for (; p < end && get_digit(*p) < 10; ++p) {
+        mantissa = mantissa * 10 + get_digit(*p);
+        digit_count += (mantissa != 0);
+    }
+    return p;
+}
+
+/// Slow path for the values the fast parser does not handle exactly:
+/// long mantissas, large exponents, infinities and NaNs
+inline bool parse_float_slow(const char* begin, const char* end, double& value) {
+    const std::string token(begin, end);
+    char* token_end = nullptr;
+    value = std::strtod(token.c_str(), &token_end);
+    return token_end == token.c_str() + token.size();
+}
+
+/// Parses the trimmed field. Decimal numbers with at most 19 significant
+/// digits and small exponents are converted exactly with a single multiplication
+/// or division by the exact power of ten, other values are handled by strtod.
+inline bool parse_float(const char* begin, const char* end, double& value) {
+    if (begin == end) {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return true;
+    }
+
+    const char* p = begin;
+    const bool is_negative = (*p == '-');
+    if (*p == '-' || *p == '+') {
+        ++p;
+    }
+
+    std::uint64_t mantissa = 0;
+    std::int64_t digit_count = 0;
+    std::int64_t exponent = 0;
+
+    const char* integer_begin = p;
+    p = parse_digits(p, end, mantissa, digit_count);
+    bool has_digits = (p != integer_begin);
+
+    if (p < end && *p == '.') {
+        ++p;
+        const char* fraction_begin = p;
+        p = parse_digits(p, end, mantissa, digit_count);
+        exponent -= (p - fraction_begin);
+        has_digits = has_digits || (p != fraction_begin);
+    }
+
+    if (has_digits && p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        const bool is_negative_exponent = (p < end && *p == '-');
+        if (p < end && (*p == '-' || *p == '+')) {
+            ++p;
+        }
+        std::int64_t explicit_exponent = 0;
+        const char* exponent_begin = p;
+        for (; p < end && get_digit(*p) < 10; ++p) {
+            explicit_exponent = std::min<std::int64_t>(explicit_exponent * 10 + get_digit(*p),
+                                                       1 << 20);
+        }
+        if (p == exponent_begin) {
+            return parse_float_slow(begin, end, value);
+        }
+        exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+
+    if (!has_digits || p != end || digit_count > max_mantissa_digits ||
+        mantissa > (std::uint64_t(1) << 53) || exponent < -max_exact_power_of_ten ||
+        exponent > max_exact_power_of_ten) {
+        return parse_float_slow(begin, end, value);
+    }
+
+    const double result = (exponent < 0) ? double(mantissa) / exact_powers_of_ten[-exponent]
+                                         : double(mantissa) * exact_powers_of_ten[exponent];
+    value = is_negative ? -result : result;
+    return true;
+}
+
+inline bool is_blank_line(const char* begin, const char* end) {
+    return std::all_of(begin, end, is_blank);
+}
+
+inline const char* find_line_end(const char* begin, const char* end) {
+    const void* line_end = std::memchr(begin, '\n', end - begin);
+    return line_end ? static_cast<const char*>(line_end) : end;
+}
+
+inline std::int64_t count_rows(const char* begin, const char* end) {
+    std::int64_t row_count = 0;
+    for (const char* line = begin; line < end;) {
+        const char* line_end = find_line_end(line, end);
+        row_count += !is_blank_line(line, line_end);
+        line = line_end + 1;
+    }
+    return row_count;
+}
+
+inline std::int64_t count_columns(const char* begin, const char* end, char delimiter) {
+    return std::count(begin, end, delimiter) + 1;
+}
+
+/// Splits [0, size) into newline-aligned chunks, chunk i is [bounds[i], bounds[i + 1])
+inline std::vector<std::int64_t> get_chunk_bounds(const char* data,
+                                                  std::int64_t begin,
+                                                  std::int64_t size) {
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t max_chunk_count =
+        std::max<std::int64_t>(1, (size - begin) / min_chunk_size);
+    const std::int64_t chunk_count =
+        std::min<std::int64_t>(max_chunk_count, chunks_per_thread * thread_count);
+    const std::int64_t chunk_size = (size - begin) / chunk_count;
+
+    std::vector<std::int64_t> bounds(chunk_count + 1, size);
+    bounds[0] = begin;
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        const std::int64_t approximate_bound = std::max(bounds[i - 1], begin + i * chunk_size);
+        const char* line_end = find_line_end(data + approximate_bound, data + size);
+        bounds[i] = std::min<std::int64_t>(line_end - data + 1, size);
+    }
+    return bounds;
+}
+
+enum class chunk_status : std::int32_t { ok = 0, non_numeric = 1, invalid_column_count = 2 };
+
+template <typename Float>
+chunk_status parse_chunk(const char* begin,
+                         const char* end,
+                         char delimiter,
+                         std::int64_t column_count,
+                         Float* rows) {
+    std::int64_t row = 0;
+    for (const char* line = begin; line < end;) {
+        const char* line_end = find_line_end(line, end);
+        if (is_blank_line(line, line_end)) {
+            line = line_end + 1;
+            continue;
+        }
+
+        Float* values = rows + row * column_count;
+        const char* field = line;
+        for (std::int64_t column = 0; column < column_count; ++column) {
+            if (field > line_end) {
+                return chunk_status::invalid_column_count;
+            }
+            const void* delimiter_ptr = std::memchr(field, delimiter, line_end - field);
+            const char* field_end =
+                delimiter_ptr ? static_cast<const char*>(delimiter_ptr) : line_end;
+
+            const char* token_begin = field;
+            const char* token_end = field_end;
+            while (token_begin < token_end && is_blank(*token_begin)) {
+                ++token_begin;
+            }
+            while (token_end > token_begin && is_blank(*(token_end - 1))) {
+                --token_end;
+            }
+
+            double value;
+            if (!parse_float(token_begin, token_end, value)) {
+                return chunk_status::non_numeric;
+            }
+            values[column] = static_cast<Float>(value);
+            field = field_end + 1;
+        }
+        if (field <= line_end) {
+            return chunk_status::invalid_column_count;
+        }
+
+        ++row;
+        line = line_end + 1;
+    }
+    return chunk_status::ok;
+}
+
+/// Returns the offset of the first data line
+inline std::int64_t get_data_begin(const char* data, std::int64_t size, bool parse_header) {
+    if (!parse_header) {
+        return 0;
+    }
+    return std::min<std::int64_t>(find_line_end(data, data + size) - data + 1, size);
+}
+
+/// Returns the number of fields in the first non-blank line or zero if there are no such lines
+inline std::int64_t find_column_count(const char* begin, const char* end, char delimiter) {
+    for (const char* line = begin; line < end;) {
+        const char* line_end = find_line_end(line, end);
+        if (!is_blank_line(line, line_end)) {
+            return count_columns(line, line_end, delimiter);
+        }
+        line = line_end + 1;
+    }
+    return 0;
+}
+
+/// Throws if any of the chunks has a row of unexpected length,
+/// returns false if any of the chunks has non-numeric values
+inline bool check_statuses(const std::vector<chunk_status>& statuses) {
+    for (const auto status : statuses) {
+        if (status == chunk_status::invalid_column_count) {
+            throw invalid_argument(dal::detail::error_messages::row_cc_neq_first_row_cc());
+        }
+    }
+    return std::none_of(statuses.begin(), statuses.end(), [](chunk_status status) {
+        return status == chunk_status::non_numeric;
+    });
+}
+
+template <typename Float>
+numeric_csv<Float> read_numeric_csv(const detail::data_source_base& ds) {
+    const dal::detail::mapped_file file(ds.get_file_name());
+    const char* data = file.get_data();
+    const std::int64_t size = file.get_size();
+    const char delimiter = ds.get_delimiter();
+
+    const std::int64_t data_begin = get_data_begin(data, size, ds.get_parse_header());
+
+    numeric_csv<Float> result;
+    result.column_count = find_column_count(data + data_begin, data + size, delimiter);
+    if (result.column_count == 0) {
+        return result;
+    }
+
+    const auto bounds = get_chunk_bounds(data, data_begin, size);
+    const std::int64_t chunk_count = static_cast<std::int64_t>(bounds.size()) - 1;
+
+    std::vector<std::int64_t> row_offsets(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        row_offsets[i + 1] = count_rows(data + bounds[i], data + bounds[i + 1]);
+    });
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        row_offsets[i + 1] += row_offsets[i];
+    }
+    result.row_count = row_offsets[chunk_count];
+
+    const std::int64_t element_count =
+        dal::detail::check_mul_overflow(result.row_count, result.column_count);
+    auto values = dal::array<Float>::empty(element_count);
+    Float* values_ptr = values.get_mutable_data();
+
+    std::vector<chunk_status> statuses(chunk_count, chunk_status::ok);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        statuses[i] = parse_chunk(data + bounds[i],
+                                  data + bounds[i + 1],
+                                  delimiter,
+                                  result.column_count,
+                                  values_ptr + row_offsets[i] * result.column_count);
+    });
+
+    result.is_numeric = check_statuses(statuses);
+    if (result.is_numeric) {
+        result.data = values;
+    }
+    return result;
+}
+
+numeric_csv_cursor::numeric_csv_cursor(const detail::data_source_base& ds)
+        : file_(ds.get_file_name()),
+          delimiter_(ds.get_delimiter()) {
+    const char* data = file_.get_data();
+    const std::int64_t size = file_.get_size();
+    position_ = get_data_begin(data, size, ds.get_parse_header());
+    column_count_ = find_column_count(data + position_, data + size, delimiter_);
+    if (column_count_ == 0) {
+        position_ = size;
+    }
+}
+
+template <typename Float>
+numeric_csv<Float> numeric_csv_cursor::read(std::int64_t max_row_count) {
+    ONEDAL_ASSERT(max_row_count > 0);
+
+    const char* data = file_.get_data();
+    const std::int64_t size = file_.get_size();
+
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t block_row_count =
+        std::max(min_block_row_count,
+                 dal::detail::integral_cast<std::int64_t>(
+                     (max_row_count + chunks_per_thread * thread_count - 1) /
+                     (chunks_per_thread * thread_count)));
+
+    // Sequential scan for line boundaries, every block of rows is parsed by a separate task
+    std::vector<std::int64_t> bounds{ position_ };
+    std::int64_t row_count = 0;
+    std::int64_t position = position_;
+    while (position < size && row_count < max_row_count) {
+        const char* line = data + position;
+        const char* line_end = find_line_end(line, data + size);
+        position = std::min<std::int64_t>(line_end - data + 1, size);
+        if (!is_blank_line(line, line_end)) {
+            ++row_count;
+            if (row_count % block_row_count == 0) {
+                bounds.push_back(position);
+            }
+        }
+    }
+    if (bounds.back() != position) {
+        bounds.push_back(position);
+    }
+    position_ = position;
+
+    numeric_csv<Float> result;
+    result.row_count = row_count;
+    result.column_count = column_count_;
+    if (row_count == 0) {
+        return result;
+    }
+
+    auto values = dal::array<Float>::empty(
+        dal::detail::check_mul_overflow(result.row_count, result.column_count));
+    Float* values_ptr = values.get_mutable_data();
+
+    const std::int64_t block_count = static_cast<std::int64_t>(bounds.size()) - 1;
+    std::vector<chunk_status> statuses(block_count, chunk_status::ok);
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t i) {
+        statuses[i] = parse_chunk(data + bounds[i],
+                                  data + bounds[i + 1],
+                                  delimiter_,
+                                  column_count_,
+                                  values_ptr + i * block_row_count * column_count_);
+    });
+
+    result.is_numeric = check_statuses(statuses);
+    if (result.is_numeric) {
+        result.data = values;
+    }
+    return result;
+}
+
+template numeric_csv<float> read_numeric_csv<float>(const detail::data_source_base&);
+template numeric_csv<double> read_numeric_csv<double>(const detail::data_source_base&);
+
+template numeric_csv<float> numeric_csv_cursor::read<float>(std::int64_t);
+template numeric_csv<double> numeric_csv_cursor::read<double>(std::int64_t);
+
+} // namespace oneapi::dal::csv::backend
@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/io/csv/common.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+/// Result of the native CSV parsing: the row-major values of the file
+template <typename Float>
+struct numeric_csv {
+    dal::array<Float> data;
+    std::int64_t row_count = 0;
+    std::int64_t column_count = 0;
+
+    /// False if the file contains values which are not numbers, in this case
+    /// the data is not filled and the file should be read with the generic reader
+    bool is_numeric = true;
+};
+
+/// Parses the CSV file which consists only of numeric values.
+///
+/// The file is memory-mapped and split into newline-aligned chunks. The first
+/// parallel pass counts rows in every chunk, so the result buffer is allocated
+/// once, and the second one parses each chunk straight into its rows.
+/// Blank lines are skipped, empty fields are read as NaN.
+template <typename Float>
+numeric_csv<Float> read_numeric_csv(const detail::data_source_base& ds);
+
+/// Sequential reader of the numeric CSV file that parses at most the given
+/// number of rows per call. Only the rows of the current call are kept in
+/// memory, so files larger than the available memory can be processed.
+class numeric_csv_cursor {
+public:
+    explicit numeric_csv_cursor(const detail::data_source_base& ds);
+
+    std::int64_t get_column_count() const {
+        return column_count_;
+    }
+
+    bool is_end() const {
+        return position_ >= file_.get_size();
+    }
+
+    /// Parses the next `max_row_count` rows or less if the file ends earlier
+    template <typename Float>
+    numeric_csv<Float> read(std::int64_t max_row_count);
+
+private:
+    dal::detail::mapped_file file_;
+    char delimiter_;
+    std::int64_t position_ = 0;
+    std::int64_t column_count_ = 0;
+};
+
+} // namespace oneapi::dal::csv::backend
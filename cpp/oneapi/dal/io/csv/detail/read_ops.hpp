@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/detail/error_messages.hpp"
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/io/csv/read_types.hpp"
 
@@ -37,7 +38,14 @@ struct read_ops<Object, data_source> {
     using args_t = read_args<Object>;
     using result_t = Object;
 
-    void check_preconditions(const data_source_base& ds, const args_t& args) const {}
+    void check_preconditions(const data_source_base& ds, const args_t& args) const {
+        using msg = dal::detail::error_messages;
+
+        const auto dtype = args.get_data_type();
+        if (dtype != data_type::float32 && dtype != data_type::float64) {
+            throw invalid_argument(msg::unsupported_data_type());
+        }
+    }
 
     void check_postconditions(const data_source_base& ds,
                               const args_t& args,
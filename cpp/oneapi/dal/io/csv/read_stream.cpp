@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/csv/backend/read_numeric_csv.hpp"
+#include "oneapi/dal/io/csv/read_stream.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::csv {
+
+class detail::v1::table_stream_impl : public base {
+public:
+    table_stream_impl(const data_source_base& ds,
+                      std::int64_t chunk_row_count,
+                      data_type dtype,
+                      std::int64_t prefetch_count)
+            : cursor(ds),
+              chunk_row_count(chunk_row_count),
+              prefetch_count(prefetch_count) {
+        if (dtype == data_type::float64) {
+            producer = std::thread([this]() {
+                produce<double>();
+            });
+        }
+        else {
+            producer = std::thread([this]() {
+                produce<float>();
+            });
+        }
+    }
+
+    ~table_stream_impl() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            is_stopped = true;
+        }
+        queue_not_full.notify_all();
+        producer.join();
+    }
+
+    bool read_next(table& chunk) {
+        std::unique_lock<std::mutex> lock(mutex);
+        queue_not_empty.wait(lock, [this]() {
+            return !chunks.empty() || is_finished;
+        });
+
+        if (chunks.empty()) {
+            if (error) {
+                std::rethrow_exception(std::exchange(error, nullptr));
+            }
+            return false;
+        }
+
+        chunk = std::move(chunks.front());
+        chunks.pop_front();
+        lock.unlock();
+        queue_not_full.notify_one();
+        return true;
+    }
+
+    backend::numeric_csv_cursor cursor;
+    const std::int64_t chunk_row_count;
+
+private:
+    template <typename Float>
+    void produce() {
+        try {
+            while (!cursor.is_end()) {
+                auto csv = cursor.read<Float>(chunk_row_count);
+                if (!csv.is_numeric) {
+                    throw invalid_argument(
+                        dal::detail::error_messages::csv_stream_contains_non_numeric_values());
+                }
+                if (csv.row_count == 0) {
+                    break;
+                }
+
+                auto chunk = dal::detail::homogen_table_builder{}
+                                 .reset(csv.data, csv.row_count, csv.column_count)
+                                 .build();
+
+                std::unique_lock<std::mutex> lock(mutex);
+                queue_not_full.wait(lock, [this]() {
+                    return std::int64_t(chunks.size()) < prefetch_count || is_stopped;
+                });
+                if (is_stopped) {
+                    return;
+                }
+                chunks.push_back(std::move(chunk));
+                lock.unlock();
+                queue_not_empty.notify_one();
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            is_finished = true;
+        }
+        queue_not_empty.notify_all();
+    }
+
+    const std::int64_t prefetch_count;
+
+    std::mutex mutex;
+    std::condition_variable queue_not_empty;
+    std::condition_variable queue_not_full;
+    std::deque<table> chunks;
+    std::exception_ptr error;
+    bool is_finished = false;
+    bool is_stopped = false;
+
+    std::thread producer;
+};
+
+namespace v1 {
+
+static detail::table_stream_impl* create_table_stream_impl(const detail::data_source_base& ds,
+                                                           std::int64_t chunk_row_count,
+                                                           const read_args<table>& args,
+                                                           std::int64_t prefetch_count) {
+    using msg = dal::detail::error_messages;
+
+    if (chunk_row_count <= 0) {
+        throw invalid_argument(msg::chunk_row_count_leq_zero());
+    }
+    if (prefetch_count <= 0) {
+        throw invalid_argument(msg::prefetch_count_leq_zero());
+    }
+    const auto dtype = args.get_data_type();
+    if (dtype != data_type::float32 && dtype != data_type::float64) {
+        throw invalid_argument(msg::unsupported_data_type());
+    }
+
+    return new detail::table_stream_impl{ ds, chunk_row_count, dtype, prefetch_count };
+}
+
+table_stream::table_stream(const detail::data_source_base& ds,
+                           std::int64_t chunk_row_count,
+                           const read_args<table>& args,
+                           std::int64_t prefetch_count)
+        : impl_(create_table_stream_impl(ds, chunk_row_count, args, prefetch_count)) {}
+
+table_stream::~table_stream() = default;
+
+std::int64_t table_stream::get_chunk_row_count() const {
+    return impl_->chunk_row_count;
+}
+
+std::int64_t table_stream::get_column_count() const {
+    return impl_->cursor.get_column_count();
+}
+
+bool table_stream::read_next(table& chunk) {
+    return impl_->read_next(chunk);
+}
+
+} // namespace v1
+} // namespace oneapi::dal::csv
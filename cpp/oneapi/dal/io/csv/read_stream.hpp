@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/csv/common.hpp"
+#include "oneapi/dal/io/csv/read_types.hpp"
+
+namespace oneapi::dal::csv {
+
+namespace detail {
+namespace v1 {
+class table_stream_impl;
+} // namespace v1
+
+using v1::table_stream_impl;
+
+} // namespace detail
+
+namespace v1 {
+
+/// Reads the numeric CSV file as a sequence of tables with a fixed number of rows.
+///
+/// The chunks are parsed by a background thread into a bounded queue, so parsing
+/// of the next chunks overlaps with the processing of the current one while at most
+/// `prefetch_count` parsed chunks are kept in memory at a time.
+class ONEDAL_EXPORT table_stream : public base {
+public:
+    /// Starts reading of the file described by the data source
+    ///
+    /// @param ds              The CSV data source
+    /// @param chunk_row_count The number of rows in each chunk except, possibly, the last one
+    /// @param args            The reading options, the data type of the chunks is taken from here
+    /// @param prefetch_count  The maximal number of parsed chunks waiting to be taken
+    ///
+    /// @pre :expr:`chunk_row_count > 0`
+    /// @pre :expr:`prefetch_count > 0`
+    table_stream(const detail::data_source_base& ds,
+                 std::int64_t chunk_row_count,
+                 const read_args<table>& args = read_args<table>{},
+                 std::int64_t prefetch_count = 2);
+
+    /// Stops the background parsing and releases the file
+    ~table_stream();
+
+    table_stream(const table_stream&) = delete;
+    table_stream& operator=(const table_stream&) = delete;
+
+    /// The number of rows in each chunk
+    std::int64_t get_chunk_row_count() const;
+
+    /// The number of columns in the file
+    std::int64_t get_column_count() const;
+
+    /// Takes the next chunk of the file, waits if it is not parsed yet.
+    /// Rethrows the exception occurred during parsing of the chunk.
+    ///
+    /// @param chunk The table to assign the next chunk to
+    /// @return False if the file has ended, in this case the chunk is not modified
+    bool read_next(table& chunk);
+
+private:
+    dal::detail::unique<detail::table_stream_impl> impl_;
+};
+
+/// Calls the callback for each chunk of the file in the order of rows.
+/// Chunks are read via :expr:`table_stream` with the same parameters.
+template <typename Callback>
+void read_chunks(const detail::data_source_base& ds,
+                 std::int64_t chunk_row_count,
+                 Callback&& callback,
+                 const read_args<table>& args = read_args<table>{}) {
+    table_stream stream{ ds, chunk_row_count, args };
+    table chunk;
+    while (stream.read_next(chunk)) {
+        callback(chunk);
+    }
+}
+
+} // namespace v1
+
+using v1::table_stream;
+using v1::read_chunks;
+
+} // namespace oneapi::dal::csv
@@ -25,11 +25,21 @@ template <>
 class detail::v1::read_args_impl<table> : public base {
 public:
     read_args_impl() {}
+
+    data_type dtype = data_type::float32;
 };
 
 namespace v1 {
 
 read_args<table>::read_args() : impl_(new detail::read_args_impl<table>()) {}
 
+data_type read_args<table>::get_data_type() const {
+    return impl_->dtype;
+}
+
+void read_args<table>::set_data_type_impl(data_type value) {
+    impl_->dtype = value;
+}
+
 } // namespace v1
 } // namespace oneapi::dal::csv
@@ -40,6 +40,18 @@ class ONEDAL_EXPORT read_args<table> : public base {
 public:
     read_args();
 
+    /// The data type of the table values, either float32 or float64.
+    /// @remark default = data_type::float32
+    data_type get_data_type() const;
+
+    auto& set_data_type(data_type value) {
+        set_data_type_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_data_type_impl(data_type value);
+
 private:
     dal::detail::pimpl<detail::read_args_impl<table>> impl_;
 };
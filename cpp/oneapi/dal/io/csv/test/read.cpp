@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+class csv_read_test {
+public:
+    ~csv_read_test() {
+        std::remove(get_filename().c_str());
+    }
+
+    std::string get_filename() const {
+        return "csv_read_test.csv";
+    }
+
+    void write_file(const std::string &text) const {
+        std::ofstream file(get_filename(), std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+
+    /// Reads the file via the read operation, as the read arguments with the data
+    /// type cannot be passed to dal::read
+    table read_file(data_type dtype) const {
+        csv::read_args<table> args;
+        args.set_data_type(dtype);
+        return csv::detail::read_ops<table, csv::data_source>{}(
+            dal::detail::host_policy::get_default(),
+            csv::data_source{ get_filename() },
+            args);
+    }
+
+    /// The numbers on both sides of the limits of the exact conversion: the number
+    /// of the significant digits, the mantissa of 2^53 and the exponent of 22
+    std::vector<std::string> get_special_numbers() const {
+        return { "0",
+                 "-0",
+                 "+1",
+                 "0.",
+                 ".5",
+                 "-.5",
+                 "5.",
+                 "1E5",
+                 "1e+5",
+                 "1e-5",
+                 "0.1",
+                 "0.30000000000000004",
+                 "9007199254740992",
+                 "9007199254740993",
+                 "-9007199254740993",
+                 "1234567890123456789",
+                 "12345678901234567890",
+                 "123456789.123456789",
+                 "00000000000000000000001.5",
+                 "0.000000000000000000001",
+                 "1e22",
+                 "1e23",
+                 "1e-22",
+                 "1.5e-22",
+                 "4503599627370497.5",
+                 "2.2250738585072014e-308",
+                 "4.9e-324",
+                 "1.7976931348623157e308",
+                 "1e400",
+                 "inf",
+                 "-inf",
+                 "nan" };
+    }
+
+    /// Random numbers of up to 25 digits with the point at a random position and
+    /// the optional exponent, so both the fast and the slow paths are taken
+    std::vector<std::string> generate_numbers(std::int64_t count) const {
+        std::mt19937 generator(7777);
+        std::uniform_int_distribution<std::int32_t> digit_count(1, 25);
+        std::uniform_int_distribution<std::int32_t> digit(0, 9);
+        std::uniform_int_distribution<std::int32_t> exponent(-30, 30);
+        std::uniform_int_distribution<std::int32_t> choice(0, 3);
+
+        std::vector<std::string> numbers;
+        for (std::int64_t i = 0; i < count; ++i) {
+            std::string number = (choice(generator) == 0) ? "-" : "";
+            const std::int32_t length = digit_count(generator);
+            const std::int32_t point = std::uniform_int_distribution<std::int32_t>(0, length)(
+                generator);
+            for (std::int32_t j = 0; j < length; ++j) {
+                if (j == point) {
+                    number += '.';
+                }
+                number += char('0' + digit(generator));
+            }
+            if (choice(generator) == 0) {
+                number += 'e' + std::to_string(exponent(generator));
+            }
+            numbers.push_back(number);
+        }
+        return numbers;
+    }
+
+    /// Writes the numbers into the rows of the given length with the spaces
+    /// around some of the values
+    void write_numbers(const std::vector<std::string> &numbers, std::int64_t column_count) {
+        std::string text;
+        for (std::size_t i = 0; i < numbers.size(); ++i) {
+            text += (i % 5 == 0) ? " " + numbers[i] + " " : numbers[i];
+            text += (std::int64_t(i + 1) % column_count == 0) ? "\n" : ",";
+        }
+        write_file(text);
+    }
+
+    /// Checks that the values are the same as converted by strtod, including
+    /// the sign of zero
+    template <typename Float>
+    void check_numbers(const table &t, const std::vector<std::string> &numbers) {
+        const auto values = row_accessor<const Float>(t).pull();
+        REQUIRE(values.get_count() == std::int64_t(numbers.size()));
+        for (std::int64_t i = 0; i < values.get_count(); ++i) {
+            CAPTURE(numbers[i]);
+            const Float expected = static_cast<Float>(std::strtod(numbers[i].c_str(), nullptr));
+            if (std::isnan(expected)) {
+                REQUIRE(std::isnan(values[i]));
+            }
+            else {
+                REQUIRE(values[i] == expected);
+                REQUIRE(std::signbit(values[i]) == std::signbit(expected));
+            }
+        }
+    }
+};
+
+TEST_M(csv_read_test, "numbers are read the same as by strtod", "[csv][read]") {
+    const std::int64_t column_count = 8;
+    auto numbers = get_special_numbers();
+    const auto random_numbers = generate_numbers(20000);
+    numbers.insert(numbers.end(), random_numbers.begin(), random_numbers.end());
+    numbers.resize(numbers.size() / column_count * column_count);
+    write_numbers(numbers, column_count);
+
+    SECTION("float64") {
+        const auto t = read_file(data_type::float64);
+        REQUIRE(t.get_column_count() == column_count);
+        check_numbers<double>(t, numbers);
+    }
+    SECTION("float32") {
+        const auto t = read_file(data_type::float32);
+        REQUIRE(t.get_column_count() == column_count);
+        check_numbers<float>(t, numbers);
+    }
+}
+
+TEST_M(csv_read_test, "empty fields are NaN and blank lines are skipped", "[csv][read]") {
+    write_file("\n"
+               "1,,3\r\n"
+               " \t\r\n"
+               " 4 ,5, \n"
+               "\n");
+
+    const auto t = read_file(data_type::float64);
+    REQUIRE(t.get_row_count() == 2);
+    REQUIRE(t.get_column_count() == 3);
+    const auto values = row_accessor<const double>(t).pull();
+    REQUIRE(values[0] == 1.0);
+    REQUIRE(std::isnan(values[1]));
+    REQUIRE(values[2] == 3.0);
+    REQUIRE(values[3] == 4.0);
+    REQUIRE(values[4] == 5.0);
+    REQUIRE(std::isnan(values[5]));
+}
+
+TEST_M(csv_read_test, "row with another number of columns is rejected", "[csv][read]") {
+    write_file("1,2,3\n"
+               "4,5\n");
+    REQUIRE_THROWS_AS(read_file(data_type::float64), invalid_argument);
+}
+
+} // namespace oneapi::dal::csv::test
@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+class csv_read_stream_test {
+public:
+    ~csv_read_stream_test() {
+        std::remove(get_filename().c_str());
+    }
+
+    std::string get_filename() const {
+        return "csv_read_stream_test.csv";
+    }
+
+    csv::data_source get_data_source() const {
+        return csv::data_source{ get_filename() };
+    }
+
+    read_args<table> get_args() const {
+        read_args<table> args;
+        args.set_data_type(data_type::float64);
+        return args;
+    }
+
+    void write_file(const std::string &text) const {
+        std::ofstream file(get_filename(), std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+
+    /// Writes the rows of the values i + j / 4 with the blank lines and the CRLF
+    /// endings in between, returns the values in the row-major order
+    std::vector<double> write_rows(std::int64_t row_count, std::int64_t column_count) {
+        std::vector<double> values;
+        std::string text;
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            if (i % 100 == 0) {
+                text += "\r\n";
+            }
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                values.push_back(i + j / 4.0);
+                text += std::to_string(values.back()) + (j + 1 < column_count ? "," : "");
+            }
+            text += (i % 2 == 0) ? "\r\n" : "\n";
+        }
+        write_file(text);
+        return values;
+    }
+
+    /// Takes all the chunks of the stream and checks their shapes
+    std::vector<double> read_stream(std::int64_t chunk_row_count,
+                                    std::int64_t prefetch_count,
+                                    std::int64_t column_count) {
+        table_stream stream{ get_data_source(), chunk_row_count, get_args(), prefetch_count };
+        REQUIRE(stream.get_chunk_row_count() == chunk_row_count);
+        REQUIRE(stream.get_column_count() == column_count);
+
+        std::vector<double> values;
+        table chunk;
+        bool is_last = false;
+        while (stream.read_next(chunk)) {
+            REQUIRE_FALSE(is_last);
+            REQUIRE(chunk.get_column_count() == column_count);
+            REQUIRE(chunk.get_row_count() <= chunk_row_count);
+            is_last = (chunk.get_row_count() < chunk_row_count);
+            append(values, chunk);
+        }
+        REQUIRE_FALSE(stream.read_next(chunk));
+        return values;
+    }
+
+    void append(std::vector<double> &values, const table &chunk) {
+        const auto rows = row_accessor<const double>(chunk).pull();
+        values.insert(values.end(), rows.get_data(), rows.get_data() + rows.get_count());
+    }
+
+    /// Writes the rows with the malformed one at the given position, so the
+    /// chunks before it are read and the chunk with it fails
+    void write_rows_with_bad_row(std::int64_t row_count,
+                                 std::int64_t bad_row,
+                                 const std::string &bad_line) {
+        std::string text;
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            text += (i == bad_row) ? bad_line : std::to_string(i) + ",1,2";
+            text += '\n';
+        }
+        write_file(text);
+    }
+
+    void check_error_after_chunks(std::int64_t chunk_row_count,
+                                  std::int64_t expected_chunk_count) {
+        table_stream stream{ get_data_source(), chunk_row_count, get_args() };
+        table chunk;
+        for (std::int64_t i = 0; i < expected_chunk_count; ++i) {
+            REQUIRE(stream.read_next(chunk));
+            REQUIRE(chunk.get_row_count() == chunk_row_count);
+        }
+        REQUIRE_THROWS_AS(stream.read_next(chunk), invalid_argument);
+        REQUIRE_FALSE(stream.read_next(chunk));
+    }
+};
+
+TEST_M(csv_read_stream_test, "chunks are the same as the whole file", "[csv][stream]") {
+    const std::int64_t row_count = 5000;
+    const std::int64_t column_count = 3;
+    const auto expected = write_rows(row_count, column_count);
+
+    const std::int64_t chunk_row_count = GENERATE(1, 7, 1000, 2048, 5000, 10000);
+    const std::int64_t prefetch_count = GENERATE(1, 2);
+    CAPTURE(chunk_row_count, prefetch_count);
+    REQUIRE(read_stream(chunk_row_count, prefetch_count, column_count) == expected);
+}
+
+TEST_M(csv_read_stream_test, "chunks are passed to the callback in order", "[csv][stream]") {
+    const auto expected = write_rows(1234, 4);
+
+    std::vector<double> values;
+    std::int64_t chunk_count = 0;
+    read_chunks(
+        get_data_source(),
+        100,
+        [&](const table &chunk) {
+            append(values, chunk);
+            ++chunk_count;
+        },
+        get_args());
+    REQUIRE(chunk_count == 13);
+    REQUIRE(values == expected);
+}
+
+TEST_M(csv_read_stream_test, "empty file has no chunks", "[csv][stream]") {
+    write_file("\n\r\n");
+    table_stream stream{ get_data_source(), 10, get_args() };
+    table chunk;
+    REQUIRE_FALSE(stream.read_next(chunk));
+}
+
+TEST_M(csv_read_stream_test,
+       "error of the chunk is thrown after the previous chunks",
+       "[csv][stream]") {
+    SECTION("non-numeric value") {
+        write_rows_with_bad_row(500, 120, "120,abc,2");
+        check_error_after_chunks(50, 2);
+    }
+    SECTION("row with another number of columns") {
+        write_rows_with_bad_row(500, 120, "120,1");
+        check_error_after_chunks(50, 2);
+    }
+}
+
+TEST_M(csv_read_stream_test, "stream is stopped before the end of the file", "[csv][stream]") {
+    write_rows(5000, 2);
+    table_stream stream{ get_data_source(), 10, get_args(), 1 };
+    table chunk;
+    REQUIRE(stream.read_next(chunk));
+    REQUIRE(chunk.get_row_count() == 10);
+}
+
+TEST_M(csv_read_stream_test, "invalid parameters are rejected", "[csv][stream]") {
+    write_rows(10, 2);
+    const std::int64_t count = GENERATE(0, -1);
+    REQUIRE_THROWS_AS(table_stream(get_data_source(), count, get_args()), invalid_argument);
+    REQUIRE_THROWS_AS(table_stream(get_data_source(), 10, get_args(), count), invalid_argument);
+}
+
+} // namespace oneapi::dal::csv::test
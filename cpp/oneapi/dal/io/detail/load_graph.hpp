@@ -17,96 +17,280 @@
 #pragma once
 
 #include <algorithm>
-#include <atomic>
-#include <fstream>
+#include <cstring>
+#include <type_traits>
+#include <vector>
 
+#include "oneapi/dal/detail/mapped_file.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/graph/common.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/io/detail/load_graph_service.hpp"
+#include "oneapi/dal/io/detail/parse_digits.hpp"
 #include "oneapi/dal/io/common.hpp"
 #include "oneapi/dal/io/graph_csv_data_source.hpp"
 #include "oneapi/dal/io/load_graph_descriptor.hpp"
 
 namespace oneapi::dal::preview::load_graph::detail {
 
-template <typename EdgeList>
-inline void load_edge_list(const std::string &name, EdgeList &elist);
+/// Minimal number of bytes of the edge list file parsed by one task
+constexpr std::int64_t edge_list_min_chunk_size = 1 << 20;
 
-template <>
-inline void load_edge_list(const std::string &name, edge_list<std::int32_t> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
+/// Number of chunks the edge list file is split into per available thread
+constexpr std::int64_t edge_list_chunks_per_thread = 4;
+
+inline bool is_edge_list_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char *skip_edge_list_blanks(const char *p, const char *end) {
+    while (p < end && is_edge_list_blank(*p)) {
+        ++p;
     }
+    return p;
+}
+
+inline bool is_edge_list_digit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
 
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32];
-    while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
-        elist.push_back(edge);
+inline bool is_edge_list_number_begin(const char *p, const char *end) {
+    return p < end && (is_edge_list_digit(*p) || *p == '-' || *p == '+');
+}
+
+/// Parses the decimal integer starting at p and returns the pointer past its last digit
+template <typename T>
+inline const char *parse_edge_list_integer(const char *p, const char *end, T &value) {
+    bool is_negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        is_negative = (*p == '-');
+        ++p;
     }
 
-    file.close();
+    std::uint64_t result = 0;
+    while (end - p >= 8) {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if (!dal::detail::are_eight_digits(word)) {
+            break;
+        }
+        result = result * 100000000ull + dal::detail::parse_eight_digits(word);
+        p += 8;
+    }
+    for (; p < end; ++p) {
+        const std::uint64_t digit = static_cast<unsigned char>(*p - '0');
+        if (digit > 9) {
+            break;
+        }
+        result = result * 10 + digit;
+    }
+
+    value = is_negative ? static_cast<T>(-static_cast<std::int64_t>(result))
+                        : static_cast<T>(result);
+    return p;
+}
+
+template <typename T>
+inline const char *parse_edge_list_value(const char *p, const char *end, T &value) {
+    if constexpr (std::is_integral_v<T>) {
+        return parse_edge_list_integer(p, end, value);
+    }
+    else {
+        // The mapped file is not null-terminated, copy the token
+        // to let the conversion routine stop at its end
+        char token[64];
+        std::int64_t length = 0;
+        while (p + length < end && length < 63 && !is_edge_list_blank(p[length])) {
+            token[length] = p[length];
+            ++length;
+        }
+        token[length] = '\0';
+        value = daal_string_to<T>(&token[0], 0);
+        return p + length;
+    }
+}
+
+template <typename Vertex>
+inline bool parse_edge(const char *p, const char *end, std::pair<Vertex, Vertex> &edge) {
+    p = skip_edge_list_blanks(p, end);
+    if (!is_edge_list_number_begin(p, end)) {
+        return false;
+    }
+    p = parse_edge_list_integer(p, end, edge.first);
+
+    p = skip_edge_list_blanks(p, end);
+    if (!is_edge_list_number_begin(p, end)) {
+        return false;
+    }
+    parse_edge_list_integer(p, end, edge.second);
+    return true;
 }
 
 template <typename Vertex, typename Weight>
-inline void load_edge_list(const std::string &name, weighted_edge_list<Vertex, Weight> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
+inline bool parse_edge(const char *p, const char *end, std::tuple<Vertex, Vertex, Weight> &edge) {
+    p = skip_edge_list_blanks(p, end);
+    if (!is_edge_list_number_begin(p, end)) {
+        return false;
+    }
+    p = parse_edge_list_integer(p, end, std::get<0>(edge));
+
+    p = skip_edge_list_blanks(p, end);
+    if (!is_edge_list_number_begin(p, end)) {
+        return false;
     }
+    p = parse_edge_list_integer(p, end, std::get<1>(edge));
 
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32], edge_value[64];
-    while (file >> source_vertex >> destination_vertex >> edge_value) {
-        auto edge =
-            std::tuple<Vertex, Vertex, Weight>(daal_string_to<Vertex>(&source_vertex[0], 0),
-                                               daal_string_to<Vertex>(&destination_vertex[0], 0),
-                                               daal_string_to<Weight>(&edge_value[0], 0));
-        elist.push_back(edge);
+    p = skip_edge_list_blanks(p, end);
+    if (p == end) {
+        return false;
     }
-    file.close();
+    parse_edge_list_value(p, end, std::get<2>(edge));
+    return true;
 }
 
-template <typename EdgeList>
-std::int64_t get_vertex_count_from_edge_list(const EdgeList &edges) {
-    auto max_id = std::get<0>(edges[0]);
-    for (std::int64_t i = 0; i < edges.size(); i++) {
-        auto edge_max = std::max(std::get<0>(edges[i]), std::get<1>(edges[i]));
-        max_id = std::max(max_id, edge_max);
+/// Splits the file into newline-aligned chunks, chunk i is [bounds[i], bounds[i + 1])
+inline std::vector<std::int64_t> get_edge_list_chunk_bounds(const char *data, std::int64_t size) {
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t max_chunk_count =
+        std::max<std::int64_t>(1, size / edge_list_min_chunk_size);
+    const std::int64_t chunk_count =
+        std::min<std::int64_t>(max_chunk_count, edge_list_chunks_per_thread * thread_count);
+
+    std::vector<std::int64_t> bounds(chunk_count + 1, size);
+    bounds[0] = 0;
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        const std::int64_t approximate_bound = std::max(bounds[i - 1], i * (size / chunk_count));
+        const void *line_end =
+            std::memchr(data + approximate_bound, '\n', size - approximate_bound);
+        bounds[i] = line_end ? (static_cast<const char *>(line_end) - data) + 1 : size;
     }
+    return bounds;
+}
 
-    const std::int64_t vertex_count = max_id + 1;
-    return vertex_count;
+inline std::int64_t count_edge_list_lines(const char *begin, const char *end) {
+    if (begin == end) {
+        return 0;
+    }
+    const std::int64_t newline_count = std::count(begin, end, '\n');
+    return newline_count + (*(end - 1) != '\n');
 }
 
-template <typename Graph, bool IsDirected = is_directed<Graph>>
-struct collect_degrees_from_edge_list;
+/// Loads the edge list from the memory-mapped file. Each line holds one edge,
+/// lines that do not start with a number are skipped.
+/// The file is split into newline-aligned chunks that are parsed in parallel:
+/// the first pass counts lines in every chunk to pre-size the edge list, the
+/// second pass parses each chunk directly into its part of the edge list.
+template <typename EdgeList>
+inline void load_edge_list_parallel(const std::string &name, EdgeList &elist) {
+    using edge_t = std::remove_reference_t<decltype(elist[0])>;
 
-template <typename Graph>
-struct collect_degrees_from_edge_list<Graph, /* IsDirected = */ false> {
-    template <typename EdgeList, typename AtomicType>
-    auto operator()(const EdgeList &edges, AtomicType *degrees_cv) {
-        dal::detail::threader_for_int64(edges.size(), [&](std::int64_t u) {
-            ++degrees_cv[std::get<0>(edges[u])];
-            ++degrees_cv[std::get<1>(edges[u])];
-        });
+    const dal::detail::mapped_file file(name);
+    const char *data = file.get_data();
+    const std::int64_t size = file.get_size();
+
+    const auto bounds = get_edge_list_chunk_bounds(data, size);
+    const std::int64_t chunk_count = static_cast<std::int64_t>(bounds.size()) - 1;
+
+    std::vector<std::int64_t> chunk_offsets(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        chunk_offsets[i + 1] = count_edge_list_lines(data + bounds[i], data + bounds[i + 1]);
+    });
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        chunk_offsets[i + 1] += chunk_offsets[i];
     }
-};
 
-template <typename Graph>
-struct collect_degrees_from_edge_list<Graph, /* IsDirected = */ true> {
-    template <typename EdgeList, typename AtomicType>
-    auto operator()(const EdgeList &edges, AtomicType *degrees_cv) {
-        dal::detail::threader_for_int64(edges.size(), [&](std::int64_t u) {
-            ++degrees_cv[std::get<0>(edges[u])];
-        });
+    elist.resize(chunk_offsets[chunk_count]);
+    edge_t *edges = elist.get_mutable_data();
+
+    std::vector<std::int64_t> chunk_edge_counts(chunk_count, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        const char *line = data + bounds[i];
+        const char *chunk_end = data + bounds[i + 1];
+        edge_t *chunk_edges = edges + chunk_offsets[i];
+        std::int64_t edge_count = 0;
+        while (line < chunk_end) {
+            const char *line_end =
+                static_cast<const char *>(std::memchr(line, '\n', chunk_end - line));
+            if (line_end == nullptr) {
+                line_end = chunk_end;
+            }
+            edge_count += parse_edge(line, line_end, chunk_edges[edge_count]);
+            line = line_end + 1;
+        }
+        chunk_edge_counts[i] = edge_count;
+    });
+
+    // Blank and malformed lines leave gaps at the chunk tails, close them
+    std::int64_t edge_count = chunk_edge_counts[0];
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        if (edge_count != chunk_offsets[i]) {
+            std::copy(edges + chunk_offsets[i],
+                      edges + chunk_offsets[i] + chunk_edge_counts[i],
+                      edges + edge_count);
+        }
+        edge_count += chunk_edge_counts[i];
     }
-};
+    elist.resize(edge_count);
+}
+
+template <typename EdgeList>
+inline void load_edge_list(const std::string &name, EdgeList &elist);
+
+template <typename Vertex>
+inline void load_edge_list(const std::string &name, edge_list<Vertex> &elist) {
+    load_edge_list_parallel(name, elist);
+}
+
+template <typename Vertex, typename Weight>
+inline void load_edge_list(const std::string &name, weighted_edge_list<Vertex, Weight> &elist) {
+    load_edge_list_parallel(name, elist);
+}
+
+/// Minimal number of elements processed by one task of the CSR construction
+constexpr std::int64_t csr_min_block_size = 1 << 14;
+
+/// Number of blocks the CSR construction input is split into per available thread
+constexpr std::int64_t csr_blocks_per_thread = 4;
+
+inline std::int64_t get_csr_block_count(std::int64_t element_count) {
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t max_block_count =
+        std::max<std::int64_t>(1, element_count / csr_min_block_size);
+    return std::min<std::int64_t>(max_block_count, csr_blocks_per_thread * thread_count);
+}
+
+/// Range of the i-th out of block_count equal blocks of [0, element_count)
+inline std::pair<std::int64_t, std::int64_t> get_csr_block_range(std::int64_t i,
+                                                                 std::int64_t block_count,
+                                                                 std::int64_t element_count) {
+    const std::int64_t block_size = element_count / block_count;
+    const std::int64_t remainder = element_count % block_count;
+    const std::int64_t begin = i * block_size + std::min(i, remainder);
+    return std::make_pair(begin, begin + block_size + (i < remainder));
+}
+
+template <typename EdgeList>
+std::int64_t get_vertex_count_from_edge_list(const EdgeList &edges) {
+    using vertex_t = std::remove_cv_t<std::remove_reference_t<decltype(std::get<0>(edges[0]))>>;
+
+    const std::int64_t block_count = get_csr_block_count(edges.size());
+    std::vector<vertex_t> block_max_ids(block_count, std::get<0>(edges[0]));
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const auto [begin, end] = get_csr_block_range(b, block_count, edges.size());
+        vertex_t max_id = block_max_ids[b];
+        for (std::int64_t i = begin; i < end; i++) {
+            const auto edge_max = std::max(std::get<0>(edges[i]), std::get<1>(edges[i]));
+            max_id = std::max(max_id, edge_max);
+        }
+        block_max_ids[b] = max_id;
+    });
+
+    const auto max_id = *std::max_element(block_max_ids.begin(), block_max_ids.end());
+    const std::int64_t vertex_count = max_id + 1;
+    return vertex_count;
+}
 
 template <typename Graph, bool IsDirected = is_directed<Graph>>
 struct get_edges_count;
@@ -127,30 +311,49 @@ struct get_edges_count<Graph, /* IsDirected = */ true> {
     }
 };
 
-template <typename EdgeIndex, typename AtomicVertex, typename AtomicEdge>
-EdgeIndex compute_prefix_sum_atomic(const AtomicVertex *degrees,
-                                    std::int64_t degrees_count,
-                                    AtomicEdge *edge_offsets_atomic) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets_atomic[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i].load();
-        edge_offsets_atomic[i + 1] = total_sum_degrees;
+/// Computes edge_offsets[i + 1] = degrees[0] + ... + degrees[i] with the two-pass
+/// blocked scan: block sums are computed in parallel, scanned serially and then
+/// used as the starting values of the parallel per-block scans.
+/// degrees may alias edge_offsets + 1.
+template <typename EdgeIndex, typename VertexIndex>
+EdgeIndex compute_prefix_sum_impl(const VertexIndex *degrees,
+                                  std::int64_t degrees_count,
+                                  EdgeIndex *edge_offsets) {
+    const std::int64_t block_count = get_csr_block_count(degrees_count);
+    std::vector<EdgeIndex> block_offsets(block_count + 1, 0);
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const auto [begin, end] = get_csr_block_range(b, block_count, degrees_count);
+        EdgeIndex block_sum = 0;
+        for (std::int64_t i = begin; i < end; ++i) {
+            block_sum += degrees[i];
+        }
+        block_offsets[b + 1] = block_sum;
+    });
+
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        block_offsets[b + 1] += block_offsets[b];
     }
-    return total_sum_degrees;
+
+    edge_offsets[0] = 0;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const auto [begin, end] = get_csr_block_range(b, block_count, degrees_count);
+        EdgeIndex total_sum_degrees = block_offsets[b];
+        for (std::int64_t i = begin; i < end; ++i) {
+            total_sum_degrees += degrees[i];
+            edge_offsets[i + 1] = total_sum_degrees;
+        }
+    });
+
+    return block_offsets[block_count];
 }
 
+/// The scan of the 32-bit degrees is dispatched by the CPU, see load_graph.cpp
 template <typename EdgeIndex, typename VertexIndex>
 EdgeIndex compute_prefix_sum(const VertexIndex *degrees,
                              std::int64_t degrees_count,
                              EdgeIndex *edge_offsets) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return compute_prefix_sum_impl(degrees, degrees_count, edge_offsets);
 }
 
 template <>
@@ -159,50 +362,154 @@ ONEDAL_EXPORT std::int64_t compute_prefix_sum<std::int64_t, std::int32_t>(
     std::int64_t degrees_count,
     std::int64_t *edge_offsets);
 
-template <typename Index, typename AtomicIndex>
-void fill_from_atomics(Index *arr, AtomicIndex *atomic_arr, std::int64_t elements_count) {
-    dal::detail::threader_for_int64(elements_count, [&](std::int64_t n) {
-        arr[n] = atomic_arr[n].load();
-    });
+/// Entries of the CSR under construction: the source vertex and the element
+/// stored in its adjacency, which is the neighbor or the neighbor with the edge value
+template <typename Vertex>
+inline std::pair<Vertex, Vertex> get_forward_entry(const std::pair<Vertex, Vertex> &edge) {
+    return edge;
 }
 
-template <typename Graph, bool IsDirected = is_directed<Graph>>
-struct fill_unfiltered_neighs;
+template <typename Vertex>
+inline std::pair<Vertex, Vertex> get_backward_entry(const std::pair<Vertex, Vertex> &edge) {
+    return std::make_pair(edge.second, edge.first);
+}
 
-template <typename Graph>
-struct fill_unfiltered_neighs<Graph, /* IsDirected = */ false> {
-    template <typename Vertex, typename AtomicEdge>
-    auto operator()(const edge_list<Vertex> &edges,
-                    AtomicEdge *rows_vec_atomic,
-                    Vertex *unfiltered_neighs) {
-        dal::detail::threader_for_int64(edges.size(), [&](std::int64_t u) {
-            unfiltered_neighs[++rows_vec_atomic[edges[u].first] - 1] = edges[u].second;
-            unfiltered_neighs[++rows_vec_atomic[edges[u].second] - 1] = edges[u].first;
-        });
-    }
-};
+template <typename Vertex, typename Weight>
+inline std::pair<Vertex, std::pair<Vertex, Weight>> get_forward_entry(
+    const std::tuple<Vertex, Vertex, Weight> &edge) {
+    return std::make_pair(std::get<0>(edge),
+                          std::make_pair(std::get<1>(edge), std::get<2>(edge)));
+}
+
+template <typename Vertex, typename Weight>
+inline std::pair<Vertex, std::pair<Vertex, Weight>> get_backward_entry(
+    const std::tuple<Vertex, Vertex, Weight> &edge) {
+    return std::make_pair(std::get<1>(edge),
+                          std::make_pair(std::get<0>(edge), std::get<2>(edge)));
+}
 
+/// Number of adjacency entries produced by the edge list: every edge of the
+/// undirected graph is stored in the adjacencies of both its ends
 template <typename Graph>
-struct fill_unfiltered_neighs<Graph, /* IsDirected = */ true> {
-    template <typename Vertex, typename AtomicEdge>
-    auto operator()(const edge_list<Vertex> &edges,
-                    AtomicEdge *rows_vec_atomic,
-                    Vertex *unfiltered_neighs) {
-        dal::detail::threader_for_int64(edges.size(), [&](std::int64_t u) {
-            unfiltered_neighs[++rows_vec_atomic[edges[u].first] - 1] = edges[u].second;
-        });
+std::int64_t get_unfiltered_neighs_count(std::int64_t edge_count) {
+    return is_directed<Graph> ? edge_count : 2 * edge_count;
+}
+
+/// Groups the edge list entries by the source vertex without atomics.
+///
+/// Vertices are split into contiguous buckets of a power-of-two width. The edge
+/// list is split into blocks, every block builds its own histogram of entries
+/// per bucket, and the histograms scanned in bucket-major order give every block
+/// exclusive ranges to scatter its entries to. After that each bucket is owned by
+/// a single task which counts the degrees of its vertices, and, once the offsets
+/// are known from the parallel prefix sum, places the entries into the adjacencies.
+///
+/// Fills unfiltered_offsets[0, vertex_count] and unfiltered_neighs[0, entries count).
+template <typename Graph,
+          typename EdgeList,
+          typename Neighbor,
+          typename EdgeIndex,
+          typename Allocator>
+void fill_unfiltered_neighs(const EdgeList &edges,
+                            std::int64_t vertex_count,
+                            EdgeIndex *unfiltered_offsets,
+                            Neighbor *unfiltered_neighs,
+                            const Allocator &allocator) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using entry_t = std::pair<vertex_t, Neighbor>;
+    using entry_allocator_type =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<entry_t>;
+    using edge_allocator_type =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<EdgeIndex>;
+    constexpr bool is_directed_graph = is_directed<Graph>;
+
+    const std::int64_t edge_count = edges.size();
+    const std::int64_t entry_count = get_unfiltered_neighs_count<Graph>(edge_count);
+
+    const std::int64_t block_count = get_csr_block_count(edge_count);
+    const std::int64_t target_bucket_count =
+        csr_blocks_per_thread * dal::detail::threader_get_max_threads();
+    std::int64_t bucket_shift = 0;
+    while ((std::int64_t(1) << bucket_shift) * target_bucket_count < vertex_count) {
+        ++bucket_shift;
     }
+    const std::int64_t bucket_width = std::int64_t(1) << bucket_shift;
+    const std::int64_t bucket_count = (vertex_count + bucket_width - 1) / bucket_width;
+
+    // histograms[b * bucket_count + k] is the number of entries of the block b
+    // that fall into the bucket k
+    std::vector<std::int64_t> histograms(block_count * bucket_count, 0);
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const auto [begin, end] = get_csr_block_range(b, block_count, edge_count);
+        std::int64_t *histogram = histograms.data() + b * bucket_count;
+        for (std::int64_t i = begin; i < end; ++i) {
+            ++histogram[get_forward_entry(edges[i]).first >> bucket_shift];
+            if constexpr (!is_directed_graph) {
+                ++histogram[get_backward_entry(edges[i]).first >> bucket_shift];
+            }
+        }
+    });
 
-    template <typename Vertex, typename Weight, typename AtomicEdge>
-    auto operator()(const weighted_edge_list<Vertex, Weight> &edges,
-                    AtomicEdge *rows_vec_atomic,
-                    std::pair<Vertex, Weight> *unfiltered_neighs_vals) {
-        dal::detail::threader_for_int64(edges.size(), [&](std::int64_t u) {
-            unfiltered_neighs_vals[++rows_vec_atomic[std::get<0>(edges[u])] - 1] =
-                std::make_pair(std::get<1>(edges[u]), std::get<2>(edges[u]));
-        });
+    std::vector<std::int64_t> bucket_offsets(bucket_count + 1, 0);
+    std::int64_t position = 0;
+    for (std::int64_t k = 0; k < bucket_count; ++k) {
+        bucket_offsets[k] = position;
+        for (std::int64_t b = 0; b < block_count; ++b) {
+            const std::int64_t count = histograms[b * bucket_count + k];
+            histograms[b * bucket_count + k] = position;
+            position += count;
+        }
     }
-};
+    bucket_offsets[bucket_count] = position;
+
+    entry_allocator_type entry_allocator(allocator);
+    entry_t *entries = oneapi::dal::preview::detail::allocate(entry_allocator, entry_count);
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const auto [begin, end] = get_csr_block_range(b, block_count, edge_count);
+        std::int64_t *cursors = histograms.data() + b * bucket_count;
+        for (std::int64_t i = begin; i < end; ++i) {
+            const auto forward_entry = get_forward_entry(edges[i]);
+            entries[cursors[forward_entry.first >> bucket_shift]++] = forward_entry;
+            if constexpr (!is_directed_graph) {
+                const auto backward_entry = get_backward_entry(edges[i]);
+                entries[cursors[backward_entry.first >> bucket_shift]++] = backward_entry;
+            }
+        }
+    });
+
+    // Degrees are accumulated in place of the offsets they are scanned into
+    EdgeIndex *degrees = unfiltered_offsets + 1;
+    dal::detail::threader_for(bucket_count, bucket_count, [&](std::int32_t k) {
+        const std::int64_t vertex_begin = k * bucket_width;
+        const std::int64_t vertex_end = std::min(vertex_begin + bucket_width, vertex_count);
+        for (std::int64_t v = vertex_begin; v < vertex_end; ++v) {
+            degrees[v] = 0;
+        }
+        for (std::int64_t i = bucket_offsets[k]; i < bucket_offsets[k + 1]; ++i) {
+            ++degrees[entries[i].first];
+        }
+    });
+
+    compute_prefix_sum(degrees, vertex_count, unfiltered_offsets);
+
+    edge_allocator_type edge_allocator(allocator);
+    EdgeIndex *cursors = oneapi::dal::preview::detail::allocate(edge_allocator, vertex_count);
+
+    dal::detail::threader_for(bucket_count, bucket_count, [&](std::int32_t k) {
+        const std::int64_t vertex_begin = k * bucket_width;
+        const std::int64_t vertex_end = std::min(vertex_begin + bucket_width, vertex_count);
+        for (std::int64_t v = vertex_begin; v < vertex_end; ++v) {
+            cursors[v] = unfiltered_offsets[v];
+        }
+        for (std::int64_t i = bucket_offsets[k]; i < bucket_offsets[k + 1]; ++i) {
+            unfiltered_neighs[cursors[entries[i].first]++] = entries[i].second;
+        }
+    });
+
+    oneapi::dal::preview::detail::deallocate(edge_allocator, cursors, vertex_count);
+    oneapi::dal::preview::detail::deallocate(entry_allocator, entries, entry_count);
+}
 
 template <typename VertexIndex, typename EdgeIndex>
 void fill_filtered_neighs(const EdgeIndex *unfiltered_offsets,
@@ -298,6 +605,37 @@ ONEDAL_EXPORT void filter_neighbors_and_fill_new_degrees<std::int32_t, std::int6
     std::int32_t *new_degrees,
     std::int64_t vertex_count);
 
+/// Fills the copy of the edge offsets in the vertex index type used by the vector
+/// kernels. The copy is skipped if the offsets do not fit the vertex index type, or if
+/// the type is 64-bit and the copy would only duplicate the offsets
+template <typename Graph, typename EdgeIndex>
+void fill_rows_vertex(Graph &g,
+                      const EdgeIndex *edge_offsets_data,
+                      std::int64_t vertex_count,
+                      EdgeIndex total_sum_degrees) {
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+    using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
+    using vertex_edge_allocator_type =
+        typename graph_traits<Graph>::impl_type::vertex_edge_allocator_type;
+
+    if constexpr (sizeof(vertex_edge_t) < sizeof(EdgeIndex)) {
+        if (total_sum_degrees >= oneapi::dal::detail::limits<vertex_edge_t>::max()) {
+            return;
+        }
+        auto &graph_impl = oneapi::dal::detail::get_impl(g);
+        vertex_edge_allocator_type vertex_edge_allocator = graph_impl._vertex_edge_allocator;
+        vertex_edge_t *rows_vertex =
+            oneapi::dal::preview::detail::allocate(vertex_edge_allocator, vertex_count + 1);
+
+        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t u) {
+            rows_vertex[u] = static_cast<vertex_edge_t>(edge_offsets_data[u]);
+        });
+
+        graph_impl.get_topology()._rows_vertex =
+            vertex_edge_set::wrap(rows_vertex, vertex_count + 1);
+    }
+}
+
 template <typename Graph>
 void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_type> &edges,
                          Graph &g) {
@@ -309,15 +647,6 @@ void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_ty
     using vertex_size_type = typename graph_traits<Graph>::vertex_size_type;
     using edge_t = typename graph_traits<Graph>::edge_type;
 
-    using atomic_vertex_t = typename std::atomic<vertex_t>;
-    using atomic_edge_t = typename std::atomic<edge_t>;
-
-    using allocator_type = typename graph_traits<Graph>::allocator_type;
-    using atomic_vertex_allocator_type =
-        typename std::allocator_traits<allocator_type>::template rebind_alloc<atomic_vertex_t>;
-    using atomic_edge_allocator_type =
-        typename std::allocator_traits<allocator_type>::template rebind_alloc<atomic_edge_t>;
-
     const vertex_size_type vertex_count = get_vertex_count_from_edge_list(edges);
     if (vertex_count < 0) {
         throw range_error(dal::detail::error_messages::overflow_found_in_sum_of_two_values());
@@ -326,43 +655,24 @@ void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_ty
     auto &graph_impl = oneapi::dal::detail::get_impl(g);
     auto &vertex_allocator = graph_impl._vertex_allocator;
     auto &edge_allocator = graph_impl._edge_allocator;
-    atomic_vertex_allocator_type atomic_vertex_allocator(vertex_allocator);
-    atomic_edge_allocator_type atomic_edge_allocator(edge_allocator);
-
-    atomic_vertex_t *degrees_cv =
-        oneapi::dal::preview::detail::allocate(atomic_vertex_allocator, vertex_count);
-
-    degrees_cv = new (degrees_cv) atomic_vertex_t[vertex_count]();
-
-    collect_degrees_from_edge_list<Graph>{}(edges, degrees_cv);
 
     const vertex_size_type rows_vec_count = vertex_count + 1;
     if ((rows_vec_count - vertex_count) != static_cast<vertex_size_type>(1)) {
         throw range_error(dal::detail::error_messages::overflow_found_in_sum_of_two_values());
     }
 
-    atomic_edge_t *rows_vec_atomic =
-        oneapi::dal::preview::detail::allocate(atomic_edge_allocator, rows_vec_count);
-
-    rows_vec_atomic = new (rows_vec_atomic) atomic_edge_t[rows_vec_count]();
-
-    edge_t total_sum_degrees =
-        compute_prefix_sum_atomic<edge_t>(degrees_cv, vertex_count, rows_vec_atomic);
-
-    oneapi::dal::preview::detail::deallocate(atomic_vertex_allocator, degrees_cv, vertex_count);
+    const edge_t total_sum_degrees = get_unfiltered_neighs_count<Graph>(edges.size());
 
     vertex_t *unfiltered_neighs =
         oneapi::dal::preview::detail::allocate(vertex_allocator, total_sum_degrees);
     edge_t *unfiltered_offsets =
         oneapi::dal::preview::detail::allocate(edge_allocator, rows_vec_count);
 
-    fill_from_atomics(unfiltered_offsets, rows_vec_atomic, rows_vec_count);
-
-    fill_unfiltered_neighs<Graph>{}(edges, rows_vec_atomic, unfiltered_neighs);
-
-    oneapi::dal::preview::detail::deallocate(atomic_edge_allocator,
-                                             rows_vec_atomic,
-                                             rows_vec_count);
+    fill_unfiltered_neighs<Graph>(edges,
+                                  vertex_count,
+                                  unfiltered_offsets,
+                                  unfiltered_neighs,
+                                  graph_impl._allocator);
 
     vertex_t *degrees_data = oneapi::dal::preview::detail::allocate(vertex_allocator, vertex_count);
 
@@ -398,25 +708,7 @@ void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_ty
                             filtered_total_sum_degrees,
                             degrees_data);
 
-    if (filtered_total_sum_degrees < oneapi::dal::detail::limits<std::int32_t>::max()) {
-        using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
-        using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
-        using vertex_edge_allocator_type =
-            typename graph_traits<Graph>::impl_type::vertex_edge_allocator_type;
-
-        vertex_edge_allocator_type vertex_edge_allocator = graph_impl._vertex_edge_allocator;
-        vertex_edge_t *rows_vertex =
-            oneapi::dal::preview::detail::allocate(vertex_edge_allocator, vertex_count + 1);
-
-        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t u) {
-            rows_vertex[u] = static_cast<vertex_edge_t>(edge_offsets_data[u]);
-        });
-
-        graph_impl.get_topology()._rows_vertex =
-            vertex_edge_set::wrap(rows_vertex, vertex_count + 1);
-    }
-
-    return;
+    fill_rows_vertex(g, edge_offsets_data, vertex_count, filtered_total_sum_degrees);
 }
 
 template <typename Graph>
@@ -434,15 +726,7 @@ void convert_to_csr_impl(
 
     using edge_value_type = typename graph_traits<Graph>::edge_user_value_type;
 
-    using atomic_vertex_t = typename std::atomic<vertex_t>;
-    using atomic_edge_t = typename std::atomic<edge_t>;
-
     using allocator_type = typename graph_traits<Graph>::allocator_type;
-    using atomic_vertex_allocator_type =
-        typename std::allocator_traits<allocator_type>::template rebind_alloc<atomic_vertex_t>;
-    using atomic_edge_allocator_type =
-        typename std::allocator_traits<allocator_type>::template rebind_alloc<atomic_edge_t>;
-
     using vertex_weight_pair = std::pair<vertex_t, edge_value_type>;
     using vertex_weight_pair_allocator_type =
         typename std::allocator_traits<allocator_type>::template rebind_alloc<vertex_weight_pair>;
@@ -456,31 +740,14 @@ void convert_to_csr_impl(
     auto &vertex_allocator = graph_impl._vertex_allocator;
     auto &edge_allocator = graph_impl._edge_allocator;
     auto &edge_value_allocator = graph_impl._edge_user_value_allocator;
-    atomic_vertex_allocator_type atomic_vertex_allocator(vertex_allocator);
-    atomic_edge_allocator_type atomic_edge_allocator(edge_allocator);
     vertex_weight_pair_allocator_type vertex_weight_pair_allocator(edge_value_allocator);
 
-    atomic_vertex_t *degrees_cv =
-        oneapi::dal::preview::detail::allocate(atomic_vertex_allocator, vertex_count);
-
-    degrees_cv = new (degrees_cv) atomic_vertex_t[vertex_count]();
-
-    collect_degrees_from_edge_list<Graph>{}(edges, degrees_cv);
-
     const vertex_size_type rows_vec_count = vertex_count + 1;
     if ((rows_vec_count - vertex_count) != static_cast<vertex_size_type>(1)) {
         throw range_error(dal::detail::error_messages::overflow_found_in_sum_of_two_values());
     }
 
-    atomic_edge_t *rows_vec_atomic =
-        oneapi::dal::preview::detail::allocate(atomic_edge_allocator, rows_vec_count);
-
-    rows_vec_atomic = new (rows_vec_atomic) atomic_edge_t[rows_vec_count]();
-
-    edge_t total_sum_degrees =
-        compute_prefix_sum_atomic<edge_t>(degrees_cv, vertex_count, rows_vec_atomic);
-
-    oneapi::dal::preview::detail::deallocate(atomic_vertex_allocator, degrees_cv, vertex_count);
+    const edge_t total_sum_degrees = get_unfiltered_neighs_count<Graph>(edges.size());
 
     vertex_weight_pair *unfiltered_neighs_and_vals =
         oneapi::dal::preview::detail::allocate(vertex_weight_pair_allocator, total_sum_degrees);
@@ -491,13 +758,11 @@ void convert_to_csr_impl(
     edge_t *unfiltered_offsets =
         oneapi::dal::preview::detail::allocate(edge_allocator, rows_vec_count);
 
-    fill_from_atomics(unfiltered_offsets, rows_vec_atomic, rows_vec_count);
-
-    fill_unfiltered_neighs<Graph>{}(edges, rows_vec_atomic, unfiltered_neighs_and_vals);
-
-    oneapi::dal::preview::detail::deallocate(atomic_edge_allocator,
-                                             rows_vec_atomic,
-                                             rows_vec_count);
+    fill_unfiltered_neighs<Graph>(edges,
+                                  vertex_count,
+                                  unfiltered_offsets,
+                                  unfiltered_neighs_and_vals,
+                                  graph_impl._allocator);
 
     vertex_t *degrees_data = oneapi::dal::preview::detail::allocate(vertex_allocator, vertex_count);
 
@@ -539,25 +804,7 @@ void convert_to_csr_impl(
                             degrees_data);
     graph_impl.set_edge_values(vals, get_edges_count<Graph>{}(filtered_total_sum_degrees));
 
-    if (filtered_total_sum_degrees < oneapi::dal::detail::limits<std::int32_t>::max()) {
-        using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
-        using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
-        using vertex_edge_allocator_type =
-            typename graph_traits<Graph>::impl_type::vertex_edge_allocator_type;
-
-        vertex_edge_allocator_type vertex_edge_allocator = graph_impl._vertex_edge_allocator;
-        vertex_edge_t *rows_vertex =
-            oneapi::dal::preview::detail::allocate(vertex_edge_allocator, vertex_count + 1);
-
-        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t u) {
-            rows_vertex[u] = static_cast<vertex_edge_t>(edge_offsets_data[u]);
-        });
-
-        graph_impl.get_topology()._rows_vertex =
-            vertex_edge_set::wrap(rows_vertex, vertex_count + 1);
-    }
-
-    return;
+    fill_rows_vertex(g, edge_offsets_data, vertex_count, filtered_total_sum_degrees);
 }
 
 template <typename Descriptor, typename DataSource>
@@ -0,0 +1,386 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
+#include "oneapi/dal/io/load_graph_descriptor.hpp"
+
+namespace oneapi::dal::preview::load_graph::detail {
+
+/// Layout of the binary CSR snapshot:
+///
+///   snapshot_header | offsets | neighbors | degrees | [rows_vertex] | [edge values]
+///
+/// Every section starts at the multiple of snapshot_alignment bytes so the
+/// mapped sections are suitably aligned to be used in place.
+constexpr char snapshot_magic[8] = { 'O', 'D', 'A', 'L', 'C', 'S', 'R', '\0' };
+constexpr std::uint32_t snapshot_version = 1;
+constexpr std::int64_t snapshot_alignment = 64;
+
+enum snapshot_flags : std::uint32_t {
+    snapshot_flag_directed = 1u << 0,
+    snapshot_flag_edge_values = 1u << 1,
+    snapshot_flag_rows_vertex = 1u << 2
+};
+
+enum class snapshot_value_kind : std::uint32_t { none = 0, int32 = 1, float64 = 2 };
+
+struct snapshot_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t flags;
+    std::uint32_t vertex_size;
+    std::uint32_t edge_size;
+    std::uint32_t value_kind;
+    std::uint32_t reserved;
+    std::int64_t vertex_count;
+    std::int64_t edge_count;
+    std::int64_t neighbor_count;
+    std::int64_t value_count;
+    std::int64_t offsets_position;
+    std::int64_t neighbors_position;
+    std::int64_t degrees_position;
+    std::int64_t rows_vertex_position;
+    std::int64_t values_position;
+    std::int64_t file_size;
+};
+
+template <typename Value>
+constexpr snapshot_value_kind get_snapshot_value_kind() {
+    if constexpr (std::is_same_v<Value, std::int32_t>) {
+        return snapshot_value_kind::int32;
+    }
+    else if constexpr (std::is_same_v<Value, double>) {
+        return snapshot_value_kind::float64;
+    }
+    else {
+        return snapshot_value_kind::none;
+    }
+}
+
+inline std::int64_t align_snapshot_position(std::int64_t position) {
+    return (position + snapshot_alignment - 1) / snapshot_alignment * snapshot_alignment;
+}
+
+template <typename Graph>
+snapshot_header make_snapshot_header(const Graph &g) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using value_t = typename graph_traits<Graph>::edge_user_value_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+    constexpr auto value_kind = get_snapshot_value_kind<value_t>();
+
+    const auto &graph_impl = oneapi::dal::detail::get_impl(g);
+    const auto topology = graph_impl.get_topology();
+    const auto edge_values = graph_impl.get_edge_values();
+
+    snapshot_header header = {};
+    std::memcpy(header.magic, snapshot_magic, sizeof(snapshot_magic));
+    header.version = snapshot_version;
+    header.flags = is_directed<Graph> ? snapshot_flag_directed : 0u;
+    header.vertex_size = sizeof(vertex_t);
+    header.edge_size = sizeof(edge_t);
+    header.value_kind = static_cast<std::uint32_t>(value_kind);
+    header.vertex_count = topology.get_vertex_count();
+    header.edge_count = topology.get_edge_count();
+    header.neighbor_count = topology._cols.get_count();
+
+    std::int64_t position = align_snapshot_position(sizeof(snapshot_header));
+    header.offsets_position = position;
+    position = align_snapshot_position(position + (header.vertex_count + 1) * sizeof(edge_t));
+    header.neighbors_position = position;
+    position = align_snapshot_position(position + header.neighbor_count * sizeof(vertex_t));
+    header.degrees_position = position;
+    position = align_snapshot_position(position + header.vertex_count * sizeof(vertex_t));
+    if (topology._rows_vertex.get_count() == header.vertex_count + 1) {
+        header.flags |= snapshot_flag_rows_vertex;
+        header.rows_vertex_position = position;
+        position = align_snapshot_position(position +
+                                           (header.vertex_count + 1) * sizeof(vertex_edge_t));
+    }
+    if constexpr (value_kind != snapshot_value_kind::none) {
+        if (edge_values.get_count() > 0) {
+            header.flags |= snapshot_flag_edge_values;
+            header.value_count = edge_values.get_count();
+            header.values_position = position;
+            position = align_snapshot_position(position + header.value_count * sizeof(value_t));
+        }
+    }
+    header.file_size = position;
+    return header;
+}
+
+template <typename T>
+void write_snapshot_section(std::ofstream &file,
+                            std::int64_t position,
+                            const T *data,
+                            std::int64_t count) {
+    file.seekp(position);
+    file.write(reinterpret_cast<const char *>(data), count * sizeof(T));
+}
+
+/// Writes the CSR topology and the edge values of the graph into the binary snapshot
+template <typename Graph>
+void save_snapshot_impl(const Graph &g, const graph_binary_data_source &data_source) {
+    using value_t = typename graph_traits<Graph>::edge_user_value_type;
+
+    const auto header = make_snapshot_header(g);
+    const auto &graph_impl = oneapi::dal::detail::get_impl(g);
+    const auto topology = graph_impl.get_topology();
+
+    std::ofstream file(data_source.get_filename(), std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw invalid_argument(dal::detail::error_messages::file_write_failed());
+    }
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    write_snapshot_section(file,
+                           header.offsets_position,
+                           topology._rows.get_data(),
+                           header.vertex_count + 1);
+    write_snapshot_section(file,
+                           header.neighbors_position,
+                           topology._cols.get_data(),
+                           header.neighbor_count);
+    write_snapshot_section(file,
+                           header.degrees_position,
+                           topology._degrees.get_data(),
+                           header.vertex_count);
+    if (header.flags & snapshot_flag_rows_vertex) {
+        write_snapshot_section(file,
+                               header.rows_vertex_position,
+                               topology._rows_vertex.get_data(),
+                               header.vertex_count + 1);
+    }
+    if constexpr (get_snapshot_value_kind<value_t>() != snapshot_value_kind::none) {
+        if (header.flags & snapshot_flag_edge_values) {
+            write_snapshot_section(file,
+                                   header.values_position,
+                                   graph_impl.get_edge_values().get_data(),
+                                   header.value_count);
+        }
+    }
+
+    // Pad the file up to the aligned end of the last section
+    const std::int64_t written = file.tellp();
+    if (written < header.file_size) {
+        file.seekp(header.file_size - 1);
+        file.put('\0');
+    }
+
+    file.close();
+    if (file.fail()) {
+        throw internal_error(dal::detail::error_messages::file_write_failed());
+    }
+}
+
+/// Checks that the section fits the file. The size of the section is compared
+/// with the space left after its position, so the check does not overflow
+inline bool is_snapshot_section_valid(const snapshot_header &header,
+                                      std::int64_t position,
+                                      std::int64_t count,
+                                      std::int64_t element_size) {
+    return position >= static_cast<std::int64_t>(sizeof(snapshot_header)) &&
+           position % snapshot_alignment == 0 && position <= header.file_size && count >= 0 &&
+           count <= (header.file_size - position) / element_size;
+}
+
+template <typename Graph>
+void check_snapshot_header(const snapshot_header &header, std::int64_t file_size) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using value_t = typename graph_traits<Graph>::edge_user_value_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+
+    if (file_size < static_cast<std::int64_t>(sizeof(snapshot_header)) ||
+        std::memcmp(header.magic, snapshot_magic, sizeof(snapshot_magic)) != 0) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+    if (header.version != snapshot_version) {
+        throw invalid_argument(
+            dal::detail::error_messages::graph_snapshot_version_is_not_supported());
+    }
+
+    const bool is_directed_snapshot = (header.flags & snapshot_flag_directed) != 0;
+    const bool has_values = (header.flags & snapshot_flag_edge_values) != 0;
+    constexpr auto value_kind = get_snapshot_value_kind<value_t>();
+    if (is_directed_snapshot != is_directed<Graph> || header.vertex_size != sizeof(vertex_t) ||
+        header.edge_size != sizeof(edge_t) ||
+        (has_values && header.value_kind != static_cast<std::uint32_t>(value_kind))) {
+        throw invalid_argument(
+            dal::detail::error_messages::graph_snapshot_type_does_not_match_graph_type());
+    }
+
+    // The vertex identifiers are less than the vertex count and shall fit the vertex type
+    const std::int64_t vertex_count = header.vertex_count;
+    constexpr std::int64_t max_vertex_count =
+        sizeof(vertex_t) < sizeof(std::int64_t)
+            ? static_cast<std::int64_t>(std::numeric_limits<vertex_t>::max()) + 1
+            : std::numeric_limits<std::int64_t>::max() - 1;
+    if (header.file_size != file_size || vertex_count < 0 || vertex_count > max_vertex_count ||
+        header.edge_count < 0 || header.edge_count > header.neighbor_count ||
+        !is_snapshot_section_valid(header,
+                                   header.offsets_position,
+                                   vertex_count + 1,
+                                   sizeof(edge_t)) ||
+        !is_snapshot_section_valid(header,
+                                   header.neighbors_position,
+                                   header.neighbor_count,
+                                   sizeof(vertex_t)) ||
+        !is_snapshot_section_valid(header,
+                                   header.degrees_position,
+                                   vertex_count,
+                                   sizeof(vertex_t)) ||
+        ((header.flags & snapshot_flag_rows_vertex) &&
+         !is_snapshot_section_valid(header,
+                                    header.rows_vertex_position,
+                                    vertex_count + 1,
+                                    sizeof(vertex_edge_t))) ||
+        (has_values && !is_snapshot_section_valid(header,
+                                                  header.values_position,
+                                                  header.value_count,
+                                                  sizeof(value_t)))) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+}
+
+/// Checks the CSR arrays of the snapshot: the offsets go from zero up to the
+/// number of the neighbors. The full scan also checks that the offsets grow,
+/// the degrees and the 32-bit offsets match them and the neighbors are the
+/// identifiers of the vertices. It reads the whole topology, so it is optional
+template <typename Edge, typename Vertex, typename VertexEdge>
+void check_snapshot_topology(const snapshot_header &header,
+                             const Edge *offsets,
+                             const Vertex *neighbors,
+                             const Vertex *degrees,
+                             const VertexEdge *rows_vertex,
+                             bool full_scan) {
+    const std::int64_t vertex_count = header.vertex_count;
+    const std::int64_t neighbor_count = header.neighbor_count;
+    std::int32_t is_corrupted =
+        offsets[0] != 0 || offsets[vertex_count] != neighbor_count ||
+        (rows_vertex != nullptr &&
+         static_cast<std::int64_t>(rows_vertex[vertex_count]) != neighbor_count);
+
+    if (!is_corrupted && full_scan) {
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+            const std::int64_t begin = offsets[v];
+            const std::int64_t end = offsets[v + 1];
+            bool is_valid = begin >= 0 && begin <= end && end <= neighbor_count &&
+                            static_cast<std::int64_t>(degrees[v]) == end - begin &&
+                            (rows_vertex == nullptr ||
+                             static_cast<std::int64_t>(rows_vertex[v]) == begin);
+            for (std::int64_t e = begin; is_valid && e < end; ++e) {
+                is_valid = neighbors[e] >= 0 && neighbors[e] < vertex_count;
+            }
+            if (!is_valid) {
+                dal::detail::atomic_store_relaxed(is_corrupted, std::int32_t(1));
+            }
+        });
+    }
+
+    if (is_corrupted) {
+        throw invalid_argument(dal::detail::error_messages::graph_snapshot_is_corrupted());
+    }
+}
+
+/// Wraps the section of the mapped snapshot into the array which keeps the
+/// mapping alive for as long as the array or any of its copies exists
+template <typename T>
+dal::array<T> wrap_snapshot_section(const dal::detail::mapped_file &file,
+                                    std::int64_t position,
+                                    std::int64_t count) {
+    const T *data = reinterpret_cast<const T *>(file.get_data() + position);
+    return dal::array<T>(data, count, [file](const T *) {});
+}
+
+/// Maps the binary snapshot into memory and builds the graph on top of it
+/// without copying: the graph arrays point directly into the mapping.
+template <typename Descriptor>
+output_type<Descriptor> load_impl(const Descriptor &desc,
+                                  const graph_binary_data_source &data_source) {
+    using graph_type = output_type<Descriptor>;
+    using vertex_t = typename graph_traits<graph_type>::vertex_type;
+    using edge_t = typename graph_traits<graph_type>::edge_type;
+    using value_t = typename graph_traits<graph_type>::edge_user_value_type;
+    using vertex_edge_t = typename graph_traits<graph_type>::impl_type::vertex_edge_type;
+
+    const dal::detail::mapped_file file(data_source.get_filename());
+
+    snapshot_header header;
+    if (file.get_size() >= static_cast<std::int64_t>(sizeof(snapshot_header))) {
+        std::memcpy(&header, file.get_data(), sizeof(snapshot_header));
+    }
+    else {
+        std::memset(&header, 0, sizeof(snapshot_header));
+    }
+    check_snapshot_header<graph_type>(header, file.get_size());
+
+    graph_type graph;
+    auto &graph_impl = oneapi::dal::detail::get_impl(graph);
+    auto &topology = graph_impl.get_topology();
+
+    const std::int64_t vertex_count = header.vertex_count;
+    topology._rows =
+        wrap_snapshot_section<edge_t>(file, header.offsets_position, vertex_count + 1);
+    topology._cols =
+        wrap_snapshot_section<vertex_t>(file, header.neighbors_position, header.neighbor_count);
+    topology._degrees =
+        wrap_snapshot_section<vertex_t>(file, header.degrees_position, vertex_count);
+    topology._rows_ptr = topology._rows.get_data();
+    topology._cols_ptr = topology._cols.get_data();
+    topology._degrees_ptr = topology._degrees.get_data();
+    topology._vertex_count = vertex_count;
+    topology._edge_count = header.edge_count;
+
+    if (header.flags & snapshot_flag_rows_vertex) {
+        topology._rows_vertex =
+            wrap_snapshot_section<vertex_edge_t>(file,
+                                                 header.rows_vertex_position,
+                                                 vertex_count + 1);
+    }
+    check_snapshot_topology(header,
+                            topology._rows_ptr,
+                            topology._cols_ptr,
+                            topology._degrees_ptr,
+                            (header.flags & snapshot_flag_rows_vertex)
+                                ? topology._rows_vertex.get_data()
+                                : nullptr,
+                            data_source.get_check_topology());
+    if constexpr (get_snapshot_value_kind<value_t>() != snapshot_value_kind::none) {
+        if (header.flags & snapshot_flag_edge_values) {
+            graph_impl.get_edge_values() =
+                wrap_snapshot_section<value_t>(file, header.values_position, header.value_count);
+        }
+    }
+    return graph;
+}
+
+} // namespace oneapi::dal::preview::load_graph::detail
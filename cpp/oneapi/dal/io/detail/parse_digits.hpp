@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace oneapi::dal::detail {
+
+/// Checks that all eight bytes packed into the word are decimal digits
+inline bool are_eight_digits(std::uint64_t word) {
+    return ((word & 0xF0F0F0F0F0F0F0F0ull) |
+            (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ==
+           0x3333333333333333ull;
+}
+
+/// Converts eight packed decimal digits into their value using the
+/// SIMD-within-a-register reduction. The word is expected in little-endian order.
+inline std::uint64_t parse_eight_digits(std::uint64_t word) {
+    word -= 0x3030303030303030ull;
+    word = (word * 10 + (word >> 8)) & 0x00FF00FF00FF00FFull;
+    word = (word * 100 + (word >> 16)) & 0x0000FFFF0000FFFFull;
+    word = (word * 10000 + (word >> 32)) & 0x00000000FFFFFFFFull;
+    return word;
+}
+
+} // namespace oneapi::dal::detail
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+namespace oneapi::dal::preview {
+
+/// Data source of the graph stored in the binary CSR snapshot format.
+/// Snapshots are produced by load_graph::save and loaded without parsing
+/// or rebuilding of the CSR topology.
+class ONEDAL_EXPORT graph_binary_data_source {
+public:
+    graph_binary_data_source(std::string filename) : _file_name(filename) {}
+    std::string get_filename() const {
+        return _file_name;
+    }
+
+    /// Whether every offset and neighbor of the snapshot is checked on load.
+    /// By default only the header and the section bounds are checked, so the
+    /// load does not read the mapped topology. Set it for the untrusted files
+    bool get_check_topology() const {
+        return _check_topology;
+    }
+
+    graph_binary_data_source& set_check_topology(bool value) {
+        _check_topology = value;
+        return *this;
+    }
+
+private:
+    std::string _file_name;
+    bool _check_topology = false;
+};
+
+} // namespace oneapi::dal::preview
@@ -20,6 +20,8 @@
 #pragma once
 
 #include "oneapi/dal/io/detail/load_graph.hpp"
+#include "oneapi/dal/io/detail/load_graph_snapshot.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
 #include "oneapi/dal/io/graph_csv_data_source.hpp"
 #include "oneapi/dal/io/load_graph_descriptor.hpp"
 
@@ -39,4 +41,15 @@ ONEDAL_EXPORT output_type<Descriptor> load(const Descriptor &desc, const DataSou
     return detail::load_impl(desc, data_source);
 }
 
+/// Writes the topology and the edge values of the graph into the binary
+/// snapshot, which can be loaded back with the graph_binary_data_source
+///
+/// @tparam Graph Type of the graph
+/// @param [in] g           The graph to save
+/// @param [in] data_source The data source of the snapshot to write
+template <typename Graph>
+ONEDAL_EXPORT void save(const Graph &g, const graph_binary_data_source &data_source) {
+    detail::save_snapshot_impl(g, data_source);
+}
+
 } // namespace oneapi::dal::preview::load_graph
@@ -0,0 +1,308 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/loader.hpp"
+
+namespace oneapi::dal::io::test {
+
+namespace te = dal::test::engine;
+
+template <typename EdgeValue, typename Index>
+using directed_graph_t = dal::preview::directed_adjacency_vector_graph<dal::preview::empty_value,
+                                                                       EdgeValue,
+                                                                       dal::preview::empty_value,
+                                                                       Index>;
+
+template <typename Index>
+using undirected_graph_t =
+    dal::preview::undirected_adjacency_vector_graph<dal::preview::empty_value,
+                                                    dal::preview::empty_value,
+                                                    dal::preview::empty_value,
+                                                    Index>;
+
+class load_graph_test {
+public:
+    std::string get_filename() const {
+        return "load_graph_test.csv";
+    }
+
+    std::string get_text_filename() const {
+        return "load_graph_test_text.csv";
+    }
+
+    template <typename Expected, typename Actual>
+    void check_same_array(const dal::array<Expected> &expected, const dal::array<Actual> &actual) {
+        REQUIRE(expected.get_count() == actual.get_count());
+        for (std::int64_t i = 0; i < expected.get_count(); ++i) {
+            REQUIRE(expected[i] == Expected(actual[i]));
+        }
+    }
+
+    /// Checks that the graphs have the same topology and edge values regardless
+    /// of the types of the vertex indices
+    template <typename Expected, typename Actual>
+    void check_same_graph(const Expected &expected, const Actual &actual) {
+        const auto &expected_impl = dal::detail::get_impl(expected);
+        const auto &actual_impl = dal::detail::get_impl(actual);
+        const auto &expected_topology = expected_impl.get_topology();
+        const auto &actual_topology = actual_impl.get_topology();
+        REQUIRE(dal::preview::get_vertex_count(actual) == dal::preview::get_vertex_count(expected));
+        REQUIRE(dal::preview::get_edge_count(actual) == dal::preview::get_edge_count(expected));
+        check_same_array(expected_topology._rows, actual_topology._rows);
+        check_same_array(expected_topology._cols, actual_topology._cols);
+        check_same_array(expected_topology._degrees, actual_topology._degrees);
+        check_same_array(expected_topology._rows_vertex, actual_topology._rows_vertex);
+        if constexpr (!std::is_same_v<dal::preview::edge_user_value_type<Expected>,
+                                      dal::preview::empty_value>) {
+            check_same_array(expected_impl.get_edge_values(), actual_impl.get_edge_values());
+        }
+    }
+
+    std::vector<double> generate_values(std::int64_t count) const {
+        std::vector<double> values(count);
+        for (std::int64_t i = 0; i < count; ++i) {
+            values[i] = double(i % 17) / 4;
+        }
+        return values;
+    }
+
+    /// Writes the edges with the comments, the blank lines, the tabs, the leading
+    /// spaces and the CRLF line endings in between
+    std::string write_irregular_text(const te::edge_list_t &edges,
+                                     const std::vector<double> &values) const {
+        std::ostringstream text;
+        text.precision(std::numeric_limits<double>::max_digits10);
+        text << "% source destination value\r\n";
+        for (std::size_t i = 0; i < edges.size(); ++i) {
+            if (i % 100 == 0) {
+                text << "# " << i << "\r\n\r\n";
+            }
+            text << (i % 3 == 0 ? "  " : "") << edges[i].first << '\t' << edges[i].second;
+            if (!values.empty()) {
+                text << ' ' << values[i];
+            }
+            text << (i % 2 == 0 ? "\r\n" : " \n");
+        }
+        return text.str();
+    }
+
+    /// Edges with the duplicates, the self loops and the hub vertex 0 connected to
+    /// every third vertex, enough of them to be split into several CSR blocks
+    te::edge_list_t generate_irregular_edges(std::int64_t vertex_count,
+                                             std::int64_t edge_count) const {
+        auto edges = te::generate_edges(vertex_count, edge_count);
+        const std::int64_t random_edge_count = edges.size();
+        for (std::int64_t i = 0; i < random_edge_count; i += 5) {
+            edges.emplace_back(edges[i].second, edges[i].first);
+            edges.emplace_back(edges[i]);
+        }
+        for (std::int32_t v = 0; v < vertex_count; v += 7) {
+            edges.emplace_back(v, v);
+        }
+        for (std::int32_t v = 1; v < vertex_count; v += 3) {
+            edges.emplace_back(0, v);
+        }
+        return edges;
+    }
+
+    /// Serial CSR construction the loader must reproduce: the neighbor lists are
+    /// sorted, the self loops are removed and the duplicates keep the smallest value
+    void build_reference_csr(const te::edge_list_t &edges,
+                             const std::vector<double> &values,
+                             bool is_directed) {
+        std::int32_t max_vertex = 0;
+        for (const auto &[u, v] : edges) {
+            max_vertex = std::max({ max_vertex, u, v });
+        }
+        std::vector<std::vector<std::pair<std::int32_t, double>>> neighbors(max_vertex + 1);
+        for (std::size_t i = 0; i < edges.size(); ++i) {
+            const auto [u, v] = edges[i];
+            const double value = values.empty() ? 0.0 : values[i];
+            if (u != v) {
+                neighbors[u].emplace_back(v, value);
+                if (!is_directed) {
+                    neighbors[v].emplace_back(u, value);
+                }
+            }
+        }
+
+        rows_.assign(1, 0);
+        cols_.clear();
+        degrees_.clear();
+        values_.clear();
+        for (auto &list : neighbors) {
+            std::sort(list.begin(), list.end());
+            const auto end = std::unique(list.begin(), list.end(), [](auto &a, auto &b) {
+                return a.first == b.first;
+            });
+            for (auto it = list.begin(); it != end; ++it) {
+                cols_.push_back(it->first);
+                values_.push_back(it->second);
+            }
+            rows_.push_back(cols_.size());
+            degrees_.push_back(std::int32_t(end - list.begin()));
+        }
+    }
+
+    template <typename T>
+    void check_same_array(const std::vector<T> &expected, const dal::array<T> &actual) {
+        REQUIRE(std::int64_t(expected.size()) == actual.get_count());
+        for (std::int64_t i = 0; i < actual.get_count(); ++i) {
+            REQUIRE(expected[i] == actual[i]);
+        }
+    }
+
+    /// Compares the CSR arrays of the loaded graph with the reference ones
+    template <typename Graph>
+    void check_reference_csr(const Graph &g) {
+        const auto &impl = dal::detail::get_impl(g);
+        const auto &topology = impl.get_topology();
+        const std::int64_t vertex_count = degrees_.size();
+        const std::int64_t neighbor_count = cols_.size();
+        REQUIRE(dal::preview::get_vertex_count(g) == vertex_count);
+        REQUIRE(dal::preview::get_edge_count(g) ==
+                (dal::preview::is_directed<Graph> ? neighbor_count : neighbor_count / 2));
+        check_same_array(rows_, topology._rows);
+        check_same_array(cols_, topology._cols);
+        check_same_array(degrees_, topology._degrees);
+        if (topology._rows_vertex.get_count() > 0) {
+            check_same_array(topology._rows, topology._rows_vertex);
+        }
+        if constexpr (!std::is_same_v<dal::preview::edge_user_value_type<Graph>,
+                                      dal::preview::empty_value>) {
+            check_same_array(values_, impl.get_edge_values());
+        }
+    }
+
+private:
+    std::vector<std::int64_t> rows_;
+    std::vector<std::int32_t> cols_;
+    std::vector<std::int32_t> degrees_;
+    std::vector<double> values_;
+};
+
+TEST_M(load_graph_test, "graph with 64-bit vertex indices is loaded", "[load_graph][int64]") {
+    const std::int64_t vertex_count = GENERATE(10, 1000, 50000);
+    const auto edges = te::generate_edges(vertex_count, vertex_count * 8);
+
+    SECTION("undirected graph") {
+        const te::edge_list_file file{ get_filename(), edges };
+        check_same_graph(file.load<undirected_graph_t<std::int32_t>>(),
+                         file.load<undirected_graph_t<std::int64_t>>());
+    }
+    SECTION("directed graph with floating-point edge values") {
+        const te::edge_list_file file{ get_filename(), edges, generate_values(edges.size()) };
+        check_same_graph(file.load<directed_graph_t<double, std::int32_t>>(),
+                         file.load<directed_graph_t<double, std::int64_t>>());
+    }
+    SECTION("directed graph with integer edge values") {
+        std::vector<double> values(edges.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = double(i % 100);
+        }
+        const te::edge_list_file file{ get_filename(), edges, values };
+        check_same_graph(file.load<directed_graph_t<std::int32_t, std::int32_t>>(),
+                         file.load<directed_graph_t<std::int32_t, std::int64_t>>());
+    }
+}
+
+TEST_M(load_graph_test,
+       "comments, blank lines and line endings of the edge list are skipped",
+       "[load_graph]") {
+    const te::edge_list_t edges = { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 } };
+
+    SECTION("undirected graph") {
+        const te::edge_list_file expected{ get_filename(), edges };
+        const te::edge_list_file actual{ get_text_filename(),
+                                         std::string("# comment\n"
+                                                     "% comment\n"
+                                                     "\n"
+                                                     "0 1\r\n"
+                                                     "  1\t2\r\n"
+                                                     "\r\n"
+                                                     "2 3 \n"
+                                                     "   \n"
+                                                     "# 4 5\n"
+                                                     "3 0") };
+        check_same_graph(expected.load<undirected_graph_t<std::int32_t>>(),
+                         actual.load<undirected_graph_t<std::int32_t>>());
+    }
+    SECTION("directed graph with edge values") {
+        const te::edge_list_file expected{ get_filename(), edges, { 0.25, 1.5, 0.1, -2.0 } };
+        const te::edge_list_file actual{ get_text_filename(),
+                                         std::string("# source destination value\r\n"
+                                                     "0 1 0.25\r\n"
+                                                     "\t1 2\t1.5\r\n"
+                                                     "\r\n"
+                                                     "%\r\n"
+                                                     "2 3 1e-1\r\n"
+                                                     "3 0 -2\r\n") };
+        check_same_graph(expected.load<directed_graph_t<double, std::int32_t>>(),
+                         actual.load<directed_graph_t<double, std::int32_t>>());
+    }
+}
+
+TEST_M(load_graph_test,
+       "edge list with irregular lines split into several chunks is loaded",
+       "[load_graph]") {
+    const auto edges = te::generate_edges(20000, 200000);
+
+    SECTION("undirected graph") {
+        const te::edge_list_file expected{ get_filename(), edges };
+        const te::edge_list_file actual{ get_text_filename(), write_irregular_text(edges, {}) };
+        check_same_graph(expected.load<undirected_graph_t<std::int32_t>>(),
+                         actual.load<undirected_graph_t<std::int32_t>>());
+    }
+    SECTION("directed graph with edge values") {
+        const auto values = generate_values(edges.size());
+        const te::edge_list_file expected{ get_filename(), edges, values };
+        const te::edge_list_file actual{ get_text_filename(),
+                                         write_irregular_text(edges, values) };
+        check_same_graph(expected.load<directed_graph_t<double, std::int32_t>>(),
+                         actual.load<directed_graph_t<double, std::int32_t>>());
+    }
+}
+
+TEST_M(load_graph_test, "CSR of the loaded graph is the same as the reference", "[load_graph]") {
+    const std::int64_t vertex_count = 20000;
+    const auto edges = generate_irregular_edges(vertex_count, 200000);
+
+    SECTION("undirected graph") {
+        const te::edge_list_file file{ get_filename(), edges };
+        build_reference_csr(edges, {}, false);
+        check_reference_csr(file.load<undirected_graph_t<std::int32_t>>());
+    }
+    SECTION("directed graph with edge values") {
+        const auto values = generate_values(edges.size());
+        const te::edge_list_file file{ get_filename(), edges, values };
+        build_reference_csr(edges, values, true);
+        check_reference_csr(file.load<directed_graph_t<double, std::int32_t>>());
+    }
+}
+
+} // namespace oneapi::dal::io::test
@@ -0,0 +1,273 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+
+namespace oneapi::dal::io::test {
+
+namespace te = dal::test::engine;
+namespace lg = dal::preview::load_graph;
+
+using undirected_graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+using directed_graph_t = dal::preview::directed_adjacency_vector_graph<std::int32_t, double>;
+using snapshot_header_t = lg::detail::snapshot_header;
+
+class load_graph_snapshot_test {
+public:
+    ~load_graph_snapshot_test() {
+        std::remove(get_filename().c_str());
+    }
+
+    std::string get_filename() const {
+        return "load_graph_snapshot_test.bin";
+    }
+
+    dal::preview::graph_binary_data_source get_data_source(bool check_topology = false) const {
+        return dal::preview::graph_binary_data_source{ get_filename() }.set_check_topology(
+            check_topology);
+    }
+
+    template <typename Graph>
+    Graph load(bool check_topology = false) {
+        using value_t = dal::preview::edge_user_value_type<Graph>;
+        using edge_list_t =
+            std::conditional_t<std::is_same_v<value_t, dal::preview::empty_value>,
+                               dal::preview::edge_list<std::int32_t>,
+                               dal::preview::weighted_edge_list<std::int32_t, value_t>>;
+        return lg::load(lg::descriptor<edge_list_t, Graph>{}, get_data_source(check_topology));
+    }
+
+    undirected_graph_t create_undirected_graph() {
+        return undirected_builder_.build<undirected_graph_t>(
+            te::make_adjacency(1000, te::generate_edges(1000, 5000), false));
+    }
+
+    directed_graph_t create_directed_graph() {
+        const auto neighbors = te::make_adjacency(1000, te::generate_edges(1000, 5000), true);
+        values_.clear();
+        for (const auto &list : neighbors) {
+            for (const std::int32_t v : list) {
+                values_.push_back(0.5 * v);
+            }
+        }
+        return directed_builder_.build<directed_graph_t>(neighbors, values_);
+    }
+
+    template <typename T>
+    void check_same_array(const dal::array<T> &expected, const dal::array<T> &actual) {
+        REQUIRE(expected.get_count() == actual.get_count());
+        for (std::int64_t i = 0; i < expected.get_count(); ++i) {
+            REQUIRE(expected[i] == actual[i]);
+        }
+    }
+
+    template <typename Graph>
+    void check_same_graph(const Graph &expected, const Graph &actual) {
+        const auto &expected_impl = dal::detail::get_impl(expected);
+        const auto &actual_impl = dal::detail::get_impl(actual);
+        const auto expected_topology = expected_impl.get_topology();
+        const auto actual_topology = actual_impl.get_topology();
+        REQUIRE(dal::preview::get_vertex_count(actual) == dal::preview::get_vertex_count(expected));
+        REQUIRE(dal::preview::get_edge_count(actual) == dal::preview::get_edge_count(expected));
+        check_same_array(expected_topology._rows, actual_topology._rows);
+        check_same_array(expected_topology._cols, actual_topology._cols);
+        check_same_array(expected_topology._degrees, actual_topology._degrees);
+        if constexpr (!std::is_same_v<dal::preview::edge_user_value_type<Graph>,
+                                      dal::preview::empty_value>) {
+            check_same_array(expected_impl.get_edge_values(), actual_impl.get_edge_values());
+        }
+    }
+
+    std::vector<char> read_file() const {
+        std::ifstream file(get_filename(), std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>());
+    }
+
+    void write_file(const std::vector<char> &bytes) const {
+        std::ofstream file(get_filename(), std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), bytes.size());
+    }
+
+    snapshot_header_t read_header() const {
+        snapshot_header_t header;
+        const auto bytes = read_file();
+        REQUIRE(bytes.size() >= sizeof(header));
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        return header;
+    }
+
+    template <typename T>
+    void overwrite(std::int64_t position, const T &value) const {
+        auto bytes = read_file();
+        REQUIRE(position + sizeof(T) <= bytes.size());
+        std::memcpy(bytes.data() + position, &value, sizeof(T));
+        write_file(bytes);
+    }
+
+    template <typename Modify>
+    void overwrite_header(Modify &&modify) const {
+        auto header = read_header();
+        modify(header);
+        overwrite(0, header);
+    }
+
+private:
+    te::graph_builder undirected_builder_;
+    te::graph_builder directed_builder_;
+    std::vector<double> values_;
+};
+
+TEST_M(load_graph_snapshot_test, "saved graph is loaded back", "[load_graph][snapshot]") {
+    SECTION("undirected graph") {
+        const auto g = create_undirected_graph();
+        lg::save(g, get_data_source());
+        check_same_graph(g, load<undirected_graph_t>());
+    }
+    SECTION("directed graph with edge values") {
+        const auto g = create_directed_graph();
+        lg::save(g, get_data_source());
+        check_same_graph(g, load<directed_graph_t>());
+    }
+}
+
+TEST_M(load_graph_snapshot_test,
+       "snapshot of another graph type is rejected",
+       "[load_graph][snapshot]") {
+    lg::save(create_undirected_graph(), get_data_source());
+    REQUIRE_THROWS_AS(load<dal::preview::directed_adjacency_vector_graph<>>(), invalid_argument);
+}
+
+TEST_M(load_graph_snapshot_test, "truncated snapshot is rejected", "[load_graph][snapshot]") {
+    lg::save(create_undirected_graph(), get_data_source());
+    const auto bytes = read_file();
+    const std::int64_t size = GENERATE_COPY(std::int64_t(0),
+                                            std::int64_t(sizeof(snapshot_header_t) - 1),
+                                            std::int64_t(sizeof(snapshot_header_t)),
+                                            std::int64_t(bytes.size() - 1));
+    CAPTURE(size);
+    write_file(std::vector<char>(bytes.begin(), bytes.begin() + size));
+    REQUIRE_THROWS_AS(load<undirected_graph_t>(), invalid_argument);
+}
+
+TEST_M(load_graph_snapshot_test, "corrupted header is rejected", "[load_graph][snapshot]") {
+    lg::save(create_undirected_graph(), get_data_source());
+    constexpr std::int64_t max_int64 = std::numeric_limits<std::int64_t>::max();
+
+    SECTION("magic") {
+        overwrite_header([](snapshot_header_t &h) {
+            h.magic[0] = 'X';
+        });
+    }
+    SECTION("version") {
+        overwrite_header([](snapshot_header_t &h) {
+            h.version += 1;
+        });
+    }
+    SECTION("negative vertex count") {
+        overwrite_header([](snapshot_header_t &h) {
+            h.vertex_count = -1;
+        });
+    }
+    SECTION("vertex count not fitting the vertex type") {
+        overwrite_header([](snapshot_header_t &h) {
+            h.vertex_count = std::int64_t(std::numeric_limits<std::int32_t>::max()) + 2;
+        });
+    }
+    SECTION("section beyond the end of the file") {
+        overwrite_header([](snapshot_header_t &h) {
+            h.neighbor_count = h.file_size;
+        });
+    }
+    SECTION("section size overflowing the position") {
+        overwrite_header([](snapshot_header_t &h) {
+            h.neighbor_count = max_int64 / 2;
+        });
+    }
+    SECTION("section position overflowing the file size") {
+        overwrite_header([=](snapshot_header_t &h) {
+            h.degrees_position = max_int64 / lg::detail::snapshot_alignment *
+                                 lg::detail::snapshot_alignment;
+        });
+    }
+    SECTION("misaligned section") {
+        overwrite_header([](snapshot_header_t &h) {
+            h.offsets_position += 4;
+        });
+    }
+
+    REQUIRE_THROWS_AS(load<undirected_graph_t>(), invalid_argument);
+}
+
+TEST_M(load_graph_snapshot_test, "corrupted topology is rejected", "[load_graph][snapshot]") {
+    lg::save(create_undirected_graph(), get_data_source());
+    const auto header = read_header();
+
+    SECTION("offsets do not start from zero") {
+        overwrite(header.offsets_position, std::int64_t(1));
+    }
+    SECTION("offsets decrease") {
+        overwrite(header.offsets_position + 500 * sizeof(std::int64_t), std::int64_t(-5));
+    }
+    SECTION("offset exceeds the number of the neighbors") {
+        overwrite(header.offsets_position + 500 * sizeof(std::int64_t),
+                  std::int64_t(header.neighbor_count + 1));
+    }
+    SECTION("degree does not match the offsets") {
+        overwrite(header.degrees_position + 10 * sizeof(std::int32_t), std::int32_t(-1));
+    }
+    SECTION("neighbor is not a vertex") {
+        overwrite(header.neighbors_position + 7 * sizeof(std::int32_t),
+                  std::int32_t(header.vertex_count));
+    }
+    SECTION("negative neighbor") {
+        overwrite(header.neighbors_position, std::int32_t(-1));
+    }
+
+    REQUIRE_THROWS_AS(load<undirected_graph_t>(true), invalid_argument);
+}
+
+TEST_M(load_graph_snapshot_test,
+       "topology is not scanned unless requested",
+       "[load_graph][snapshot]") {
+    const auto g = create_undirected_graph();
+    lg::save(g, get_data_source());
+    check_same_graph(g, load<undirected_graph_t>(true));
+
+    const auto header = read_header();
+    overwrite(header.neighbors_position, std::int32_t(-1));
+    REQUIRE_NOTHROW(load<undirected_graph_t>());
+    REQUIRE_THROWS_AS(load<undirected_graph_t>(true), invalid_argument);
+
+    // The first and the last offsets are checked without the scan
+    overwrite(header.offsets_position, std::int64_t(1));
+    REQUIRE_THROWS_AS(load<undirected_graph_t>(), invalid_argument);
+}
+
+} // namespace oneapi::dal::io::test
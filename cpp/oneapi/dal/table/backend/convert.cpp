@@ -17,12 +17,142 @@
 #include "oneapi/dal/table/backend/convert.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/transfer.hpp"
 #include "oneapi/dal/backend/interop/data_conversion.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::backend {
 
+/// Storage of the bfloat16 value, the upper 16 bits of IEEE 754 float32
+struct bfloat16_storage {
+    std::uint16_t bits;
+};
+
+ONEDAL_FORCEINLINE std::uint32_t float_as_bits(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(float));
+    return bits;
+}
+
+ONEDAL_FORCEINLINE float bits_as_float(std::uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+ONEDAL_FORCEINLINE float bfloat16_to_float(bfloat16_storage value) {
+    return bits_as_float(std::uint32_t(value.bits) << 16);
+}
+
+/// Rounds to the nearest even, NaNs are kept quiet. The function is branchless
+/// to let compiler vectorize conversion loops
+ONEDAL_FORCEINLINE bfloat16_storage float_bits_to_bfloat16(std::uint32_t bits) {
+    const bool is_nan = (bits & 0x7fffffffu) > 0x7f800000u;
+    const std::uint32_t rounded = bits + 0x7fffu + ((bits >> 16) & 1u);
+    return { std::uint16_t(is_nan ? ((bits >> 16) | 0x40u) : (rounded >> 16)) };
+}
+
+ONEDAL_FORCEINLINE bfloat16_storage double_to_bfloat16(double value) {
+    // Rounding to float32 and then to bfloat16 may round twice. Rounding
+    // to float32 to odd instead keeps the final result correctly rounded
+    const float narrowed = static_cast<float>(value);
+    std::uint32_t bits = float_as_bits(narrowed);
+    if (static_cast<double>(narrowed) != value && !std::isnan(value)) {
+        bits -= std::uint32_t(std::fabs(double(narrowed)) > std::fabs(value));
+        bits |= 1u;
+    }
+    return float_bits_to_bfloat16(bits);
+}
+
+template <typename Dst, typename Src>
+ONEDAL_FORCEINLINE Dst convert_element(Src value) {
+    if constexpr (std::is_same_v<Src, Dst>) {
+        return value;
+    }
+    else if constexpr (std::is_same_v<Src, bfloat16_storage>) {
+        return static_cast<Dst>(bfloat16_to_float(value));
+    }
+    else if constexpr (std::is_same_v<Dst, bfloat16_storage> && std::is_same_v<Src, float>) {
+        return float_bits_to_bfloat16(float_as_bits(value));
+    }
+    else if constexpr (std::is_same_v<Dst, bfloat16_storage>) {
+        return double_to_bfloat16(static_cast<double>(value));
+    }
+    else {
+        return static_cast<Dst>(value);
+    }
+}
+
+/// Extends `dispatch_by_data_type` with the storage types that have no
+/// arithmetic C++ counterpart
+template <typename Op>
+inline auto dispatch_by_storage_type(data_type dtype, Op&& op) {
+    if (dtype == data_type::bfloat16) {
+        return op(bfloat16_storage{});
+    }
+    return dispatch_by_data_type(dtype, std::forward<Op>(op));
+}
+
+/// Minimal number of elements converted by one task of the bfloat16 conversion
+constexpr std::int64_t bfloat16_block_size = 1 << 14;
+
+template <typename Src, typename Dst>
+static void convert_block(const Src* src,
+                          Dst* dst,
+                          std::int64_t src_stride,
+                          std::int64_t dst_stride,
+                          std::int64_t element_count) {
+    if (src_stride == 1 && dst_stride == 1) {
+        for (std::int64_t i = 0; i < element_count; i++) {
+            dst[i] = convert_element<Dst>(src[i]);
+        }
+    }
+    else {
+        for (std::int64_t i = 0; i < element_count; i++) {
+            dst[i * dst_stride] = convert_element<Dst>(src[i * src_stride]);
+        }
+    }
+}
+
+/// DAAL conversion routines are not aware of bfloat16, so vectors of
+/// bfloat16 are widened or narrowed here block by block in parallel
+static void convert_vector_bfloat16(const void* src,
+                                    void* dst,
+                                    data_type src_type,
+                                    data_type dst_type,
+                                    std::int64_t src_stride,
+                                    std::int64_t dst_stride,
+                                    std::int64_t element_count) {
+    dispatch_by_storage_type(src_type, [&](auto src_type_id) {
+        dispatch_by_storage_type(dst_type, [&](auto dst_type_id) {
+            using src_t = decltype(src_type_id);
+            using dst_t = decltype(dst_type_id);
+            const auto src_data = static_cast<const src_t*>(src);
+            const auto dst_data = static_cast<dst_t*>(dst);
+
+            const std::int64_t block_count =
+                (element_count + bfloat16_block_size - 1) / bfloat16_block_size;
+            if (block_count <= 1) {
+                convert_block(src_data, dst_data, src_stride, dst_stride, element_count);
+                return;
+            }
+
+            detail::threader_for_int64(block_count, [&](std::int64_t block) {
+                const std::int64_t first = block * bfloat16_block_size;
+                convert_block(src_data + first * src_stride,
+                              dst_data + first * dst_stride,
+                              src_stride,
+                              dst_stride,
+                              std::min(bfloat16_block_size, element_count - first));
+            });
+        });
+    });
+}
+
 static void convert_vector(const void* src,
                            void* dst,
                            data_type src_type,
@@ -30,7 +160,16 @@ static void convert_vector(const void* src,
                            std::int64_t src_stride,
                            std::int64_t dst_stride,
                            std::int64_t element_count) {
-    if (src_stride == 1 && dst_stride == 1) {
+    if (src_type == data_type::bfloat16 || dst_type == data_type::bfloat16) {
+        convert_vector_bfloat16(src,
+                                dst,
+                                src_type,
+                                dst_type,
+                                src_stride,
+                                dst_stride,
+                                element_count);
+    }
+    else if (src_stride == 1 && dst_stride == 1) {
         interop::daal_convert(src, dst, src_type, dst_type, element_count);
     }
     else {
@@ -65,24 +204,97 @@ void convert_vector(const detail::default_host_policy& policy,
                     std::int64_t src_stride,
                     std::int64_t dst_stride,
                     std::int64_t element_count) {
-    if (src_stride == 1 && dst_stride == 1) {
-        interop::daal_convert(src, dst, src_type, dst_type, element_count);
+    convert_vector(src, dst, src_type, dst_type, src_stride, dst_stride, element_count);
+}
+
+/// Size of the square tile of the transposition, the tile of the largest
+/// data types fits L1 cache together with its transposed copy
+constexpr std::int64_t transpose_tile_size = 32;
+
+/// Minimal number of elements processed by one task of the transposition
+constexpr std::int64_t transpose_min_elements_per_task = 1 << 14;
+
+template <typename Src, typename Dst>
+static void convert_tile_transposed(const Src* src,
+                                    Dst* dst,
+                                    std::int64_t row_count,
+                                    std::int64_t column_count,
+                                    std::int64_t src_row_stride,
+                                    std::int64_t dst_row_stride) {
+    // Writes are contiguous, strided reads stay within the tile rows loaded to cache
+    for (std::int64_t j = 0; j < column_count; j++) {
+        const Src* src_column = src + j;
+        Dst* dst_row = dst + j * dst_row_stride;
+        for (std::int64_t i = 0; i < row_count; i++) {
+            dst_row[i] = convert_element<Dst>(src_column[i * src_row_stride]);
+        }
+    }
+}
+
+template <typename Src, typename Dst>
+static void convert_matrix_transposed(const Src* src,
+                                      Dst* dst,
+                                      std::int64_t row_count,
+                                      std::int64_t column_count,
+                                      std::int64_t src_row_stride,
+                                      std::int64_t dst_row_stride) {
+    const std::int64_t row_tile_count =
+        (row_count + transpose_tile_size - 1) / transpose_tile_size;
+    const std::int64_t column_tile_count =
+        (column_count + transpose_tile_size - 1) / transpose_tile_size;
+
+    const auto convert_tile = [&](std::int64_t tile) {
+        const std::int64_t row_begin = (tile / column_tile_count) * transpose_tile_size;
+        const std::int64_t column_begin = (tile % column_tile_count) * transpose_tile_size;
+        convert_tile_transposed(src + row_begin * src_row_stride + column_begin,
+                                dst + column_begin * dst_row_stride + row_begin,
+                                std::min(transpose_tile_size, row_count - row_begin),
+                                std::min(transpose_tile_size, column_count - column_begin),
+                                src_row_stride,
+                                dst_row_stride);
+    };
+
+    // Split the whole grid of tiles, so the blocks with a single row or a single
+    // column of tiles are converted in parallel as well
+    const std::int64_t tile_count = row_tile_count * column_tile_count;
+    if (row_count * column_count < transpose_min_elements_per_task) {
+        for (std::int64_t tile = 0; tile < tile_count; tile++) {
+            convert_tile(tile);
+        }
     }
     else {
-        const std::int64_t src_element_size = dal::detail::get_data_type_size(src_type);
-        const std::int64_t dst_element_size = dal::detail::get_data_type_size(dst_type);
-        ONEDAL_ASSERT_MUL_OVERFLOW(std::int64_t, src_stride, src_element_size);
-        ONEDAL_ASSERT_MUL_OVERFLOW(std::int64_t, dst_stride, dst_element_size);
-        interop::daal_convert(src,
-                              dst,
-                              src_type,
-                              dst_type,
-                              src_stride * src_element_size,
-                              dst_stride * dst_element_size,
-                              element_count);
+        detail::threader_for_int64(tile_count, convert_tile);
     }
 }
 
+void convert_matrix_transposed(const detail::default_host_policy& policy,
+                               const void* src,
+                               void* dst,
+                               data_type src_type,
+                               data_type dst_type,
+                               std::int64_t row_count,
+                               std::int64_t column_count,
+                               std::int64_t src_row_stride,
+                               std::int64_t dst_row_stride) {
+    ONEDAL_ASSERT(row_count >= 0);
+    ONEDAL_ASSERT(column_count >= 0);
+    ONEDAL_ASSERT(src_row_stride >= column_count);
+    ONEDAL_ASSERT(dst_row_stride >= row_count);
+
+    dispatch_by_storage_type(src_type, [&](auto src_type_id) {
+        dispatch_by_storage_type(dst_type, [&](auto dst_type_id) {
+            using src_t = decltype(src_type_id);
+            using dst_t = decltype(dst_type_id);
+            convert_matrix_transposed(static_cast<const src_t*>(src),
+                                      static_cast<dst_t*>(dst),
+                                      row_count,
+                                      column_count,
+                                      src_row_stride,
+                                      dst_row_stride);
+        });
+    });
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 
 template <typename Src, typename Dst>
@@ -37,6 +37,20 @@ void convert_vector(const detail::default_host_policy& policy,
                     std::int64_t dst_stride,
                     std::int64_t element_count);
 
+/// Converts `row_count` x `column_count` row-major matrix `src` with the stride
+/// `src_row_stride` between rows to the transposed `column_count` x `row_count`
+/// row-major matrix `dst` with the stride `dst_row_stride` between rows.
+/// The matrix is processed in cache-sized tiles in parallel.
+void convert_matrix_transposed(const detail::default_host_policy& policy,
+                               const void* src,
+                               void* dst,
+                               data_type src_type,
+                               data_type dst_type,
+                               std::int64_t row_count,
+                               std::int64_t column_count,
+                               std::int64_t src_row_stride,
+                               std::int64_t dst_row_stride);
+
 #ifdef ONEDAL_DATA_PARALLEL
 
 void convert_vector(const detail::data_parallel_policy& policy,
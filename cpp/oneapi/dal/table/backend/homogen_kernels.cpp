@@ -192,6 +192,21 @@ static void pull_column_major_impl(const Policy& policy,
     auto src_data = origin_data.get_data() + origin_offset * origin_dtype_size;
     auto dst_data = block_data.get_mutable_data();
 
+    if constexpr (std::is_same_v<Policy, detail::default_host_policy>) {
+        // Block is the transposed part of origin, convert it tile by tile to
+        // avoid strided access to the whole origin columns
+        backend::convert_matrix_transposed(policy,
+                                           src_data,
+                                           dst_data,
+                                           origin_info.get_data_type(),
+                                           block_dtype,
+                                           block_info.get_column_count(),
+                                           block_info.get_row_count(),
+                                           origin_info.get_row_count(),
+                                           block_info.get_column_count());
+        return;
+    }
+
     for (std::int64_t i = 0; i < block_info.get_row_count(); i++) {
         backend::convert_vector(policy,
                                 src_data + i * origin_dtype_size,
@@ -306,6 +321,19 @@ static void push_column_major_impl(const Policy& policy,
     auto src_data = block_data.get_data();
     auto dst_data = origin_data.get_mutable_data() + origin_offset * origin_dtype_size;
 
+    if constexpr (std::is_same_v<Policy, detail::default_host_policy>) {
+        backend::convert_matrix_transposed(policy,
+                                           src_data,
+                                           dst_data,
+                                           block_dtype,
+                                           origin_info.get_data_type(),
+                                           block_info.get_row_count(),
+                                           block_info.get_column_count(),
+                                           block_info.get_column_count(),
+                                           origin_info.get_row_count());
+        return;
+    }
+
     for (std::int64_t row_idx = 0; row_idx < block_info.get_row_count(); row_idx++) {
         backend::convert_vector(policy,
                                 src_data + row_idx * block_info.get_column_count(),
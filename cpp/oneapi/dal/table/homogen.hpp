@@ -115,6 +115,27 @@ public:
         return homogen_table{ data, row_count, column_count, layout };
     }
 
+    /// Creates a new ``homogen_table`` instance from an array of raw bytes that
+    /// stores elements of the given data type. Enables the storage types that
+    /// have no C++ counterpart, for example :literal:`data_type::bfloat16`.
+    /// The created table shares data ownership with the given array.
+    ///
+    /// @param data         The array that stores a homogeneous data block.
+    /// @param row_count    The number of rows in the table.
+    /// @param column_count The number of columns in the table.
+    /// @param dtype        The type of elements in the data block.
+    /// @param layout       The layout of the data. Should be :literal:`data_layout::row_major` or
+    ///                     :literal:`data_layout::column_major`.
+    static homogen_table wrap(const dal::array<byte_t>& data,
+                              std::int64_t row_count,
+                              std::int64_t column_count,
+                              data_type dtype,
+                              data_layout layout = data_layout::row_major) {
+        homogen_table result;
+        result.init_impl(data, row_count, column_count, dtype, layout);
+        return result;
+    }
+
     /// Creates a new ``homogen_table`` instance with zero number of rows and columns.
     homogen_table();
 
@@ -265,6 +286,25 @@ private:
         });
     }
 
+    void init_impl(const dal::array<byte_t>& data,
+                   std::int64_t row_count,
+                   std::int64_t column_count,
+                   data_type dtype,
+                   data_layout layout) {
+        validate_input_dimensions(row_count, column_count);
+
+        const std::int64_t element_count = detail::check_mul_overflow(row_count, column_count);
+        const std::int64_t dtype_size = detail::get_data_type_size(dtype);
+        if (data.get_count() < detail::check_mul_overflow(element_count, dtype_size)) {
+            using msg = detail::error_messages;
+            throw invalid_argument{ msg::rc_and_cc_do_not_match_element_count_in_array() };
+        }
+
+        detail::dispath_by_policy(data, [&](auto policy) {
+            init_impl(policy, row_count, column_count, data, dtype, layout);
+        });
+    }
+
     template <typename Policy>
     void init_impl(const Policy& policy,
                    std::int64_t row_count,
@@ -18,6 +18,9 @@
 //       Test for conversion should be moved to dal/table/backend
 
 #include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/test/engine/linalg.hpp"
@@ -199,6 +202,143 @@ TEST_M(convert_test, "convert types of the different sizes host2host", "[host2ho
     }
 }
 
+template <typename Src, typename Dst>
+void test_host_transposed_conversion(std::int64_t row_count,
+                                     std::int64_t column_count,
+                                     std::int64_t src_row_stride,
+                                     std::int64_t dst_row_stride) {
+    std::vector<Src> src(row_count * src_row_stride);
+    for (std::int64_t i = 0; i < row_count * src_row_stride; i++) {
+        src[i] = Src(i % 1000) - Src(500);
+    }
+
+    const Dst padding = Dst(-1);
+    std::vector<Dst> dst(column_count * dst_row_stride, padding);
+
+    convert_matrix_transposed(dal::detail::default_host_policy{},
+                              src.data(),
+                              dst.data(),
+                              dal::detail::make_data_type<Src>(),
+                              dal::detail::make_data_type<Dst>(),
+                              row_count,
+                              column_count,
+                              src_row_stride,
+                              dst_row_stride);
+
+    for (std::int64_t j = 0; j < column_count; j++) {
+        for (std::int64_t i = 0; i < dst_row_stride; i++) {
+            const Dst expected = (i < row_count) ? Dst(src[i * src_row_stride + j]) : padding;
+            REQUIRE(dst[j * dst_row_stride + i] == expected);
+        }
+    }
+}
+
+TEST("host convert transposed matrix", "[host2host]") {
+    const auto [row_count, column_count] = GENERATE(std::make_pair(1, 1),
+                                                    std::make_pair(7, 3),
+                                                    std::make_pair(33, 65),
+                                                    std::make_pair(1000, 100),
+                                                    std::make_pair(3, 5000),
+                                                    std::make_pair(20, 5000),
+                                                    std::make_pair(5000, 20));
+    const std::int64_t padding = GENERATE(0, 5);
+    SECTION(fmt::format("{}x{}, padding = {}", row_count, column_count, padding)) {
+        SECTION("float -> float") {
+            test_host_transposed_conversion<float, float>(row_count,
+                                                          column_count,
+                                                          column_count + padding,
+                                                          row_count + padding);
+        }
+        SECTION("std::int32_t -> double") {
+            test_host_transposed_conversion<std::int32_t, double>(row_count,
+                                                                  column_count,
+                                                                  column_count + padding,
+                                                                  row_count + padding);
+        }
+        SECTION("double -> float") {
+            test_host_transposed_conversion<double, float>(row_count,
+                                                           column_count,
+                                                           column_count + padding,
+                                                           row_count + padding);
+        }
+    }
+}
+
+TEST("host convert to bfloat16 rounds to nearest even", "[host2host][bfloat16]") {
+    // 1 + 2^-8 is a tie between 1 and 1 + 2^-7, 1 + 3 * 2^-8 is a tie
+    // between 1 + 2^-7 and 1 + 2^-6, the values above ties round up
+    const std::array<float, 7> src = { 1.f,
+                                       1.f + 0x1p-8f,
+                                       1.f + 3 * 0x1p-8f,
+                                       1.f + 0x1p-8f + 0x1p-20f,
+                                       -2.f,
+                                       std::numeric_limits<float>::infinity(),
+                                       std::numeric_limits<float>::quiet_NaN() };
+    const std::array<std::uint16_t, 7> expected = { 0x3f80, 0x3f80, 0x3f82, 0x3f81,
+                                                    0xc000, 0x7f80, 0x7fc0 };
+
+    std::array<std::uint16_t, 7> dst_from_float;
+    convert_vector(dal::detail::default_host_policy{},
+                   src.data(),
+                   dst_from_float.data(),
+                   data_type::float32,
+                   data_type::bfloat16,
+                   src.size());
+
+    std::array<double, 7> src_double;
+    std::copy(src.begin(), src.end(), src_double.begin());
+    // The value is a tie in float32, but it is above the tie in float64
+    src_double[1] = 1. + 0x1p-8 + 0x1p-40;
+
+    std::array<std::uint16_t, 7> dst_from_double;
+    convert_vector(dal::detail::default_host_policy{},
+                   src_double.data(),
+                   dst_from_double.data(),
+                   data_type::float64,
+                   data_type::bfloat16,
+                   src_double.size());
+
+    for (std::size_t i = 0; i < src.size(); i++) {
+        REQUIRE(dst_from_float[i] == expected[i]);
+        REQUIRE(dst_from_double[i] == (i == 1 ? 0x3f81 : expected[i]));
+    }
+}
+
+TEST("host convert bfloat16 back and forth", "[host2host][bfloat16]") {
+    const std::int64_t element_count = GENERATE(7, 100000);
+    const std::int64_t stride = GENERATE(1, 3);
+
+    std::vector<float> src(element_count * stride);
+    for (std::int64_t i = 0; i < element_count * stride; i++) {
+        src[i] = float(i) - 0.25f;
+    }
+
+    std::vector<std::uint16_t> bf16(element_count * stride);
+    convert_vector(dal::detail::default_host_policy{},
+                   src.data(),
+                   bf16.data(),
+                   data_type::float32,
+                   data_type::bfloat16,
+                   stride,
+                   stride,
+                   element_count);
+
+    std::vector<double> dst(element_count * stride);
+    convert_vector(dal::detail::default_host_policy{},
+                   bf16.data(),
+                   dst.data(),
+                   data_type::bfloat16,
+                   data_type::float64,
+                   stride,
+                   stride,
+                   element_count);
+
+    for (std::int64_t i = 0; i < element_count * stride; i += stride) {
+        // bfloat16 keeps 8 significant bits
+        REQUIRE(std::abs(dst[i] - src[i]) <= std::abs(src[i]) * 0x1p-8);
+    }
+}
+
 // device -> device tests
 #ifdef ONEDAL_DATA_PARALLEL
 TEST_M(convert_test, "device2device convert identical types", "[device2device]") {
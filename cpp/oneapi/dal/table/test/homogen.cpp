@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
 #include "oneapi/dal/test/engine/common.hpp"
 
 namespace oneapi::dal::test {
@@ -204,4 +206,59 @@ TEST("create table from array") {
     REQUIRE(t.get_column_count() == column_count);
 }
 
+TEST("create bfloat16 table from array of bytes") {
+    constexpr std::int64_t row_count = 3;
+    constexpr std::int64_t column_count = 2;
+    // bfloat16 values of { 1, -2, 0.5, 3, 1.5, 1024 }
+    std::uint16_t data_bf16[row_count * column_count] = { 0x3f80, 0xc000, 0x3f00,
+                                                          0x4040, 0x3fc0, 0x4480 };
+    const double expected[row_count * column_count] = { 1., -2., 0.5, 3., 1.5, 1024. };
+
+    const auto data_bytes = array<byte_t>::wrap(reinterpret_cast<const byte_t*>(data_bf16),
+                                                row_count * column_count * sizeof(std::uint16_t));
+
+    SECTION("row major") {
+        auto t = homogen_table::wrap(data_bytes, row_count, column_count, data_type::bfloat16);
+
+        REQUIRE(t.get_data() == data_bf16);
+        REQUIRE(t.get_row_count() == row_count);
+        REQUIRE(t.get_column_count() == column_count);
+        for (std::int64_t i = 0; i < column_count; i++) {
+            REQUIRE(t.get_metadata().get_data_type(i) == data_type::bfloat16);
+            REQUIRE(t.get_metadata().get_feature_type(i) == feature_type::ratio);
+        }
+
+        const auto rows = row_accessor<const float>(t).pull({ 1, -1 });
+        for (std::int64_t i = 0; i < rows.get_count(); i++) {
+            REQUIRE(rows[i] == float(expected[column_count + i]));
+        }
+
+        const auto column = column_accessor<const double>(t).pull(1);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            REQUIRE(column[i] == expected[i * column_count + 1]);
+        }
+    }
+
+    SECTION("column major") {
+        auto t = homogen_table::wrap(data_bytes,
+                                     column_count,
+                                     row_count,
+                                     data_type::bfloat16,
+                                     data_layout::column_major);
+
+        const auto rows = row_accessor<const double>(t).pull();
+        for (std::int64_t i = 0; i < column_count; i++) {
+            for (std::int64_t j = 0; j < row_count; j++) {
+                REQUIRE(rows[i * row_count + j] == expected[j * column_count + i]);
+            }
+        }
+    }
+
+    SECTION("array is too small") {
+        REQUIRE_THROWS_AS(
+            homogen_table::wrap(data_bytes, row_count + 1, column_count, data_type::bfloat16),
+            invalid_argument);
+    }
+}
+
 } // namespace oneapi::dal::test
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+
+namespace oneapi::dal::test::engine {
+
+using edge_list_t = std::vector<std::pair<std::int32_t, std::int32_t>>;
+using adjacency_t = std::vector<std::vector<std::int32_t>>;
+
+/// Draws `edge_count` random pairs of the vertices and drops the self loops
+inline edge_list_t generate_edges(std::int64_t vertex_count,
+                                  std::int64_t edge_count,
+                                  std::uint32_t seed = 7777) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<std::int32_t> vertex(0, vertex_count - 1);
+    edge_list_t edges;
+    for (std::int64_t i = 0; i < edge_count; ++i) {
+        const std::int32_t u = vertex(generator);
+        const std::int32_t v = vertex(generator);
+        if (u != v) {
+            edges.emplace_back(u, v);
+        }
+    }
+    return edges;
+}
+
+/// Puts every edge to the neighbor list of its source and, for the undirected graph,
+/// to the list of its destination. The lists keep the order of the edges
+inline adjacency_t make_adjacency(std::int64_t vertex_count,
+                                  const edge_list_t& edges,
+                                  bool is_directed) {
+    adjacency_t neighbors(vertex_count);
+    for (const auto& [u, v] : edges) {
+        neighbors[u].push_back(v);
+        if (!is_directed) {
+            neighbors[v].push_back(u);
+        }
+    }
+    return neighbors;
+}
+
+/// Keeps the CSR arrays of the graph built from the neighbor lists. The graph refers
+/// to the arrays, so the builder must outlive it and build one graph at a time
+class graph_builder {
+public:
+    template <typename Graph>
+    Graph build(const adjacency_t& neighbors) {
+        rows_.assign(1, 0);
+        cols_.clear();
+        degrees_.clear();
+        for (const auto& list : neighbors) {
+            cols_.insert(cols_.end(), list.begin(), list.end());
+            rows_.push_back(cols_.size());
+            degrees_.push_back(list.size());
+        }
+
+        const std::int64_t vertex_count = neighbors.size();
+        const std::int64_t edge_count =
+            dal::preview::is_directed<Graph> ? cols_.size() : cols_.size() / 2;
+
+        Graph g;
+        const std::int64_t* rows = rows_.data();
+        const std::int32_t* cols = cols_.data();
+        const std::int32_t* degrees = degrees_.data();
+        dal::detail::get_impl(g).set_topology(vertex_count,
+                                              edge_count,
+                                              rows,
+                                              cols,
+                                              std::int64_t(cols_.size()),
+                                              degrees);
+        return g;
+    }
+
+    /// Builds the graph with the edge values given in the order of the concatenated
+    /// neighbor lists. The graph refers to the values, they must outlive it
+    template <typename Graph>
+    Graph build(const adjacency_t& neighbors,
+                const std::vector<dal::preview::edge_user_value_type<Graph>>& values) {
+        auto g = build<Graph>(neighbors);
+        ONEDAL_ASSERT(values.size() == cols_.size());
+        dal::detail::get_impl(g).set_edge_values(values.data(), std::int64_t(values.size()));
+        return g;
+    }
+
+    const std::vector<std::int64_t>& get_rows() const {
+        return rows_;
+    }
+
+    const std::vector<std::int32_t>& get_cols() const {
+        return cols_;
+    }
+
+private:
+    std::vector<std::int64_t> rows_;
+    std::vector<std::int32_t> cols_;
+    std::vector<std::int32_t> degrees_;
+};
+
+} // namespace oneapi::dal::test::engine
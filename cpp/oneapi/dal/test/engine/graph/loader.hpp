@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/test/engine/graph/builder.hpp"
+
+namespace oneapi::dal::test::engine {
+
+/// Text edge list file in the working directory, which is removed together with
+/// the object. The graphs are loaded from it by the edge list loader, so they
+/// are built the same way as the graphs of the users
+class edge_list_file {
+public:
+    edge_list_file(const std::string& filename, const edge_list_t& edges)
+            : edge_list_file(filename, edges, {}) {}
+
+    /// Writes the edges with the values given in the order of the edges
+    edge_list_file(const std::string& filename,
+                   const edge_list_t& edges,
+                   const std::vector<double>& values)
+            : filename_(filename) {
+        ONEDAL_ASSERT(values.empty() || values.size() == edges.size());
+        std::ofstream file(filename_, std::ios::trunc);
+        file.precision(std::numeric_limits<double>::max_digits10);
+        for (std::size_t i = 0; i < edges.size(); ++i) {
+            file << edges[i].first << ' ' << edges[i].second;
+            if (!values.empty()) {
+                file << ' ' << values[i];
+            }
+            file << '\n';
+        }
+    }
+
+    /// Writes the text as is, so the parsing of the comments, the blank lines and
+    /// the line endings can be checked
+    edge_list_file(const std::string& filename, const std::string& text) : filename_(filename) {
+        std::ofstream file(filename_, std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+
+    edge_list_file(const edge_list_file&) = delete;
+    edge_list_file& operator=(const edge_list_file&) = delete;
+
+    ~edge_list_file() {
+        std::remove(filename_.c_str());
+    }
+
+    const std::string& get_filename() const {
+        return filename_;
+    }
+
+    /// Loads the graph of the given type, the weighted edge list is read for the
+    /// graphs with the edge values
+    template <typename Graph>
+    Graph load() const {
+        using vertex_t = dal::preview::vertex_type<Graph>;
+        using value_t = dal::preview::edge_user_value_type<Graph>;
+        using edge_list_t =
+            std::conditional_t<std::is_same_v<value_t, dal::preview::empty_value>,
+                               dal::preview::edge_list<vertex_t>,
+                               dal::preview::weighted_edge_list<vertex_t, value_t>>;
+        namespace lg = dal::preview::load_graph;
+        return lg::load(lg::descriptor<edge_list_t, Graph>{},
+                        dal::preview::graph_csv_data_source{ filename_ });
+    }
+
+private:
+    std::string filename_;
+};
+
+} // namespace oneapi::dal::test::engine
@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+#include "daal/src/externals/service_profiler.h"
+
+namespace oneapi::dal::test {
+
+using ::daal::internal::Profiler;
+using ::daal::internal::ProfilerMode;
+
+struct report_line {
+    std::int64_t depth = -1;
+    std::uint64_t call_count = 0;
+    double total_time = 0.0;
+    std::int64_t thread_count = 0;
+    double imbalance = 0.0;
+};
+
+struct trace_event {
+    std::string name;
+    double start = 0.0;
+    double duration = 0.0;
+};
+
+/// Records the tasks in the trace mode, which also collects the call tree of the
+/// report, and restores the mode set by the environment afterwards. The tasks of
+/// the tests have unique names, as the recorded tasks are kept by the profiler
+class profiler_test {
+public:
+    profiler_test() : previous_mode_(Profiler::getMode()) {
+        Profiler::setMode(ProfilerMode::trace);
+    }
+
+    ~profiler_test() {
+        Profiler::setMode(previous_mode_);
+    }
+
+    template <typename Writer>
+    std::string write(Writer &&writer) const {
+        FILE *file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        writer(file);
+        std::rewind(file);
+        std::string text;
+        char buffer[4096];
+        for (std::size_t size; (size = std::fread(buffer, 1, sizeof(buffer), file)) > 0;) {
+            text.append(buffer, size);
+        }
+        std::fclose(file);
+        return text;
+    }
+
+    /// Finds the line of the task in the report, the depth is given by the indent
+    report_line find_report_line(const std::string &report, const std::string &name) const {
+        std::istringstream lines(report);
+        for (std::string line; std::getline(lines, line);) {
+            const std::size_t name_begin = line.find_first_not_of(' ');
+            if (name_begin == std::string::npos ||
+                line.compare(name_begin, name.size() + 1, name + ' ') != 0) {
+                continue;
+            }
+            report_line result;
+            result.depth = std::int64_t(name_begin / 2);
+            double average_time;
+            std::istringstream fields(line.substr(name_begin + name.size()));
+            fields >> result.call_count >> result.total_time >> average_time >>
+                result.thread_count >> result.imbalance;
+            REQUIRE_FALSE(fields.fail());
+            return result;
+        }
+        FAIL("Task " << name << " is not found in the report");
+        return report_line{};
+    }
+
+    std::vector<trace_event> find_trace_events(const std::string &trace,
+                                               const std::string &name) const {
+        const std::regex event_regex("\\{\"name\":\"" + name +
+                                     "\",\"ph\":\"X\",\"pid\":0,\"tid\":[0-9]+,"
+                                     "\"ts\":([0-9.]+),\"dur\":([0-9.]+)\\}");
+        std::vector<trace_event> events;
+        for (std::sregex_iterator it(trace.begin(), trace.end(), event_regex), end; it != end;
+             ++it) {
+            events.push_back({ name, std::stod((*it)[1]), std::stod((*it)[2]) });
+        }
+        return events;
+    }
+
+private:
+    ProfilerMode previous_mode_;
+};
+
+TEST_M(profiler_test, "report has the call tree of the tasks", "[profiler]") {
+    {
+        auto outer = Profiler::startTask("profiler_test_report_outer");
+        for (std::int32_t i = 0; i < 3; ++i) {
+            auto inner = Profiler::startTask("profiler_test_report_inner");
+        }
+    }
+    const std::int32_t parallel_count = 1000;
+    detail::threader_for(parallel_count, parallel_count, [](std::int32_t) {
+        auto task = Profiler::startTask("profiler_test_report_parallel");
+    });
+
+    const auto report = write(Profiler::writeReport);
+    CAPTURE(report);
+    REQUIRE(report.compare(0, 4, "task") == 0);
+
+    const auto outer = find_report_line(report, "profiler_test_report_outer");
+    REQUIRE(outer.depth == 0);
+    REQUIRE(outer.call_count == 1);
+    REQUIRE(outer.thread_count == 1);
+    REQUIRE(outer.imbalance == 1.0);
+
+    const auto inner = find_report_line(report, "profiler_test_report_inner");
+    REQUIRE(inner.depth == 1);
+    REQUIRE(inner.call_count == 3);
+    REQUIRE(inner.total_time <= outer.total_time);
+
+    const auto parallel = find_report_line(report, "profiler_test_report_parallel");
+    REQUIRE(parallel.depth == 0);
+    REQUIRE(parallel.call_count == parallel_count);
+    REQUIRE(parallel.thread_count >= 1);
+    REQUIRE(parallel.thread_count <= detail::threader_get_max_threads());
+    REQUIRE(parallel.imbalance >= 1.0);
+}
+
+TEST_M(profiler_test, "trace has an event for each task", "[profiler]") {
+    {
+        auto outer = Profiler::startTask("profiler_test_trace_outer");
+        for (std::int32_t i = 0; i < 3; ++i) {
+            auto inner = Profiler::startTask("profiler_test_trace_inner");
+        }
+    }
+
+    const auto trace = write(Profiler::writeTrace);
+    CAPTURE(trace);
+    REQUIRE(trace.compare(0, 16, "{\"traceEvents\":[") == 0);
+    REQUIRE(trace.compare(trace.size() - 4, 4, "\n]}\n") == 0);
+
+    const auto outer = find_trace_events(trace, "profiler_test_trace_outer");
+    const auto inner = find_trace_events(trace, "profiler_test_trace_inner");
+    REQUIRE(outer.size() == 1);
+    REQUIRE(inner.size() == 3);
+
+    // The times are printed in microseconds with three decimal places
+    const double precision = 0.002;
+    for (const auto &event : inner) {
+        REQUIRE(event.start + precision >= outer[0].start);
+        REQUIRE(event.start + event.duration <=
+                outer[0].start + outer[0].duration + precision);
+    }
+}
+
+TEST_M(profiler_test, "disabled profiler does not record the tasks", "[profiler]") {
+    Profiler::setMode(ProfilerMode::disabled);
+    REQUIRE_FALSE(Profiler::isEnabled());
+    {
+        auto task = Profiler::startTask("profiler_test_disabled");
+    }
+    Profiler::setMode(ProfilerMode::trace);
+
+    REQUIRE(write(Profiler::writeReport).find("profiler_test_disabled") == std::string::npos);
+    REQUIRE(write(Profiler::writeTrace).find("profiler_test_disabled") == std::string::npos);
+}
+
+TEST_M(profiler_test, "task started before disabling the profiler is ended", "[profiler]") {
+    {
+        auto task = Profiler::startTask("profiler_test_switched_off");
+        Profiler::setMode(ProfilerMode::disabled);
+    }
+    Profiler::setMode(ProfilerMode::trace);
+    {
+        auto task = Profiler::startTask("profiler_test_after_switch");
+    }
+
+    const auto report = write(Profiler::writeReport);
+    CAPTURE(report);
+    REQUIRE(find_report_line(report, "profiler_test_switched_off").call_count == 1);
+    REQUIRE(find_report_line(report, "profiler_test_after_switch").depth == 0);
+}
+
+} // namespace oneapi::dal::test
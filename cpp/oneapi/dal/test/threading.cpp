@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::test {
+
+using block_list_t = std::vector<std::pair<std::int32_t, std::int32_t>>;
+
+/// Returns the number of the threads that run the iterations of the parallel loop
+/// and the maximal number of the threads seen by the iterations
+inline std::pair<std::int64_t, std::int64_t> count_loop_threads(
+    std::int32_t threads_request = 100000) {
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    std::int64_t max_thread_count = 0;
+    detail::threader_for(100000, threads_request, [&](std::int32_t) {
+        const std::int64_t thread_count = detail::threader_get_max_threads();
+        std::lock_guard<std::mutex> lock(mutex);
+        thread_ids.insert(std::this_thread::get_id());
+        max_thread_count = std::max(max_thread_count, thread_count);
+    });
+    return { std::int64_t(thread_ids.size()), max_thread_count };
+}
+
+/// Calls the blocked loop and returns its blocks sorted by the beginning
+inline block_list_t get_blocks(std::int32_t n,
+                               std::int32_t threads_request,
+                               std::int32_t grain_size) {
+    std::mutex mutex;
+    block_list_t blocks;
+    detail::threader_for_blocked(n,
+                                 threads_request,
+                                 grain_size,
+                                 [&](std::int32_t begin, std::int32_t end) {
+                                     std::lock_guard<std::mutex> lock(mutex);
+                                     blocks.emplace_back(begin, end);
+                                 });
+    std::sort(blocks.begin(), blocks.end());
+    return blocks;
+}
+
+TEST("threader_for with grain size visits each index once", "[threading]") {
+    const std::int32_t n = GENERATE(0, 1, 5, 1000, 100000);
+    const std::int32_t threads_request = GENERATE(0, 1, 3);
+    const std::int32_t grain_size = GENERATE(0, 1, 7, 1024);
+    CAPTURE(n, threads_request, grain_size);
+
+    std::vector<std::atomic<std::int32_t>> counts(n);
+    detail::threader_for(n, threads_request, grain_size, [&](std::int32_t i) {
+        counts[i].fetch_add(1, std::memory_order_relaxed);
+    });
+    for (std::int32_t i = 0; i < n; ++i) {
+        REQUIRE(counts[i].load() == 1);
+    }
+}
+
+TEST("threader_for_blocked blocks cover the loop", "[threading]") {
+    const std::int32_t n = GENERATE(1, 5, 1000, 100000);
+    const std::int32_t grain_size = GENERATE(1, 7, 1024);
+    CAPTURE(n, grain_size);
+
+    // The whole loop is a single block if only one thread is available
+    const bool is_parallel = detail::threader_get_max_threads() > 1;
+    const auto blocks = get_blocks(n, 0, grain_size);
+    REQUIRE(blocks.front().first == 0);
+    REQUIRE(blocks.back().second == n);
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        REQUIRE(blocks[i].first < blocks[i].second);
+        if (is_parallel) {
+            REQUIRE(blocks[i].second - blocks[i].first <= grain_size);
+        }
+        if (i > 0) {
+            REQUIRE(blocks[i].first == blocks[i - 1].second);
+        }
+    }
+}
+
+TEST("threader_for_blocked splits the loop into threads_request blocks", "[threading]") {
+    const std::int32_t n = GENERATE(1000, 100001);
+    const std::int32_t threads_request = GENERATE(2, 3, 7);
+    CAPTURE(n, threads_request);
+
+    if (detail::threader_get_max_threads() == 1) {
+        return;
+    }
+    const auto blocks = get_blocks(n, threads_request, 1);
+    REQUIRE(std::int32_t(blocks.size()) == threads_request);
+    for (std::int32_t i = 0; i < threads_request; ++i) {
+        REQUIRE(blocks[i].first == std::int64_t(n) * i / threads_request);
+        REQUIRE(blocks[i].second == std::int64_t(n) * (i + 1) / threads_request);
+    }
+}
+
+TEST("loops of a single block or a single thread run in the calling thread", "[threading]") {
+    const auto params = GENERATE(std::make_tuple(100, 0, 100),
+                                 std::make_tuple(10, 0, 1000),
+                                 std::make_tuple(100000, 1, 1));
+    const std::int32_t n = std::get<0>(params);
+    const std::int32_t threads_request = std::get<1>(params);
+    const std::int32_t grain_size = std::get<2>(params);
+    CAPTURE(n, threads_request, grain_size);
+
+    const auto caller_id = std::this_thread::get_id();
+    std::atomic<std::int32_t> other_thread_count{ 0 };
+    detail::threader_for(n, threads_request, grain_size, [&](std::int32_t) {
+        if (std::this_thread::get_id() != caller_id) {
+            other_thread_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    REQUIRE(other_thread_count.load() == 0);
+
+    const auto blocks = get_blocks(n, threads_request, grain_size);
+    REQUIRE(blocks.size() == 1);
+}
+
+TEST("threader_for without grain size limits the threads to threads_request", "[threading]") {
+    const std::int32_t threads_request = GENERATE(1, 2, 3);
+    CAPTURE(threads_request);
+
+    const std::int64_t max_thread_count = detail::threader_get_max_threads();
+    const auto loop_thread_counts = count_loop_threads(threads_request);
+    REQUIRE(loop_thread_counts.first <= threads_request);
+    REQUIRE(loop_thread_counts.second == std::min<std::int64_t>(threads_request, max_thread_count));
+}
+
+TEST("threader_execute_in_arena limits the number of threads", "[threading]") {
+    const std::int32_t max_concurrency = GENERATE(1, 2, 3);
+    CAPTURE(max_concurrency);
+
+    std::int64_t arena_thread_count = 0;
+    std::pair<std::int64_t, std::int64_t> loop_thread_counts;
+    detail::threader_execute_in_arena(max_concurrency, -1, [&]() {
+        arena_thread_count = detail::threader_get_max_threads();
+        loop_thread_counts = count_loop_threads();
+    });
+    REQUIRE(arena_thread_count == max_concurrency);
+    REQUIRE(loop_thread_counts.first <= max_concurrency);
+    REQUIRE(loop_thread_counts.second == max_concurrency);
+}
+
+TEST("threader_execute_in_arena without limits uses all threads", "[threading]") {
+    const std::int64_t max_thread_count = detail::threader_get_max_threads();
+    std::int64_t arena_thread_count = 0;
+    detail::threader_execute_in_arena(0, -1, [&]() {
+        arena_thread_count = detail::threader_get_max_threads();
+    });
+    REQUIRE(arena_thread_count == max_thread_count);
+}
+
+TEST("host_policy with max thread count limits the threads of the call", "[threading]") {
+    const std::int64_t max_thread_count = GENERATE(1, 2);
+    CAPTURE(max_thread_count);
+
+    detail::host_policy policy;
+    REQUIRE(policy.get_max_thread_count() == 0);
+    policy.set_max_thread_count(max_thread_count);
+    REQUIRE(policy.get_max_thread_count() == max_thread_count);
+
+    const auto loop_thread_counts = backend::execute_in_policy_arena(policy, []() {
+        return count_loop_threads();
+    });
+    REQUIRE(loop_thread_counts.first <= max_thread_count);
+    REQUIRE(loop_thread_counts.second == max_thread_count);
+}
+
+TEST("host_policy without limits runs the call in the calling arena", "[threading]") {
+    const std::int64_t max_thread_count = detail::threader_get_max_threads();
+    detail::threader_execute_in_arena(1, -1, [&]() {
+        const auto loop_thread_counts =
+            backend::execute_in_policy_arena(detail::host_policy{}, []() {
+                return count_loop_threads();
+            });
+        REQUIRE(loop_thread_counts.first == 1);
+        REQUIRE(loop_thread_counts.second == 1);
+    });
+    REQUIRE(detail::threader_get_max_threads() == max_thread_count);
+}
+
+TEST("host_policy rejects negative max thread count", "[threading]") {
+    detail::host_policy policy;
+    REQUIRE_THROWS_AS(policy.set_max_thread_count(-1), invalid_argument);
+    REQUIRE(policy.get_max_thread_count() == 0);
+}
+
+} // namespace oneapi::dal::test